@@ -67,10 +67,49 @@ void ExperimentEnvironment::TestEnvironment(){
 	simulation_mode->get_alteration_mode()->TestAlterationMode();
 }
 
+std::string ExperimentEnvironment::GetParsingFingerprint(){
+	std::string fingerprint = "";
+	for( auto const &us : unalterable_statements ){
+		fingerprint += "unalterable_statement:" + us + "\n";
+	}
+	for( auto const &un : unalterable_nodes ){
+		fingerprint += "unalterable_node:" + un + "\n";
+	}
+	for( auto const &pn : primitive_names ){
+		fingerprint += "primitive:" + pn + "\n";
+	}
+	for( auto const &rw : reserved_words ){
+		fingerprint += "reserved_word:" + rw + "\n";
+	}
+	for( auto const &at : analysis_types ){
+		fingerprint += "analysis:" + at->get_master_name() + ":"
+			+ number2String( at->get_advanced_analysis() ) + "\n";
+	}
+	for( auto const &cst : control_statement_types ){
+		fingerprint += "control:" + cst->get_master_name() + ":"
+			+ number2String( cst->get_advanced_control_statement() ) + ":"
+			+ number2String( cst->get_special_syntax_control_statement() ) + "\n";
+	}
+	for( auto const &tst : transistor_statement_types ){
+		fingerprint += "transistor:" + tst->get_master_name() + "\n";
+	}
+	fingerprint += "regex:" + kAnalysisStatementRegEx + "\n" + kTransistorStatementRegEx + "\n"
+		+ kControlStatementRegEx + "\n" + kControlStatementRegExSpecial + "\n";
+	// injection/substitution properties
+	AlterationMode* alterationMode = simulation_mode->get_alteration_mode();
+	fingerprint += "alteration:" + number2String( alterationMode->get_perform_alteration() ) + ":"
+		+ number2String( alterationMode->get_inject_all_mode() ) + "\n";
+	for( auto const &as : *alterationMode->get_alterable_statements() ){
+		fingerprint += "alterable:" + as.first + ":" + as.second + "\n";
+	}
+	return fingerprint;
+}
+
 
 
 void ExperimentEnvironment::AddUnalterableStatement( std::string unalterableStatement){
 	unalterable_statements.push_back(unalterableStatement);
+	unalterable_statements_set.insert(unalterableStatement);
 }
 
 void ExperimentEnvironment::AddExcludedCanonicalFolder( std::string excluded_canonical_folder ){
@@ -79,20 +118,16 @@ void ExperimentEnvironment::AddExcludedCanonicalFolder( std::string excluded_can
 
 void ExperimentEnvironment::AddPrimitiveName( std::string primitive_name ){
 	primitive_names.push_back( primitive_name );
+	primitive_names_set.insert( primitive_name );
 }
 
 void ExperimentEnvironment::AddReservedWord( std::string reserved_word ) {
 	this->reserved_words.push_back( reserved_word );
+	this->reserved_words_set.insert( reserved_word );
 }
 
 void ExperimentEnvironment::AddGlobalNode( Node* node ) {
-	bool alreadyInserted = false;
-	for( auto const &n : global_nodes ){
-		if( n->get_name().compare(node->get_name()) == 0 ){
-			alreadyInserted = true;
-		}
-	}
-	if( !alreadyInserted ){
+	if( global_nodes_names.insert( node->get_name() ).second ){
 		this->global_nodes.push_back( new Node( node->get_name(),
 			!TestUnalterableNode( node->get_name()) ) );
 		log_io->ReportPlainStandard( k3Tab
@@ -115,18 +150,11 @@ void ExperimentEnvironment::AddControlStatementType( ControlStatement* control_s
 
 void ExperimentEnvironment::AddUnalterableNode( std::string unalterable_node ){
 	this->unalterable_nodes.push_back( unalterable_node );
+	this->unalterable_nodes_set.insert( unalterable_node );
 }
 
 bool ExperimentEnvironment::TestUnalterableStatement( const std::string& masterName){
-	if( unalterable_statements.size()==0 ){
-		return false;
-	}
-	for(auto const & us : unalterable_statements ) {
-		if( us.compare( masterName )==0 ) {
-			return true;
-		}
-	}
-	return false;
+	return unalterable_statements_set.find( masterName )!=unalterable_statements_set.end();
 }
 
 bool ExperimentEnvironment::TestCanBeInjected(const std::string& master_name){
@@ -138,12 +166,9 @@ bool ExperimentEnvironment::TestCanBeInjected(const std::string& master_name){
 		return true;
 	}
 	// The statements that are going to be injected are specified in the experiment_conf.xml file
-	for( auto const & as : *(simulation_mode->get_alteration_mode()->get_alterable_statements()) ) {
-		if( (as.first).compare( master_name )==0 ) {
-			return true;
-		}
-	}
-	return false;
+	std::map<std::string,std::string>* alterableStatements =
+		simulation_mode->get_alteration_mode()->get_alterable_statements();
+	return alterableStatements->find( master_name )!=alterableStatements->end();
 }
 
 bool ExperimentEnvironment::TestCanBeSubstituted(const std::string& master_name,
@@ -152,11 +177,12 @@ bool ExperimentEnvironment::TestCanBeSubstituted(const std::string& master_name,
 	if(! simulation_mode->get_alteration_mode()->get_perform_alteration() ){
 		return false;
 	}
-	for( auto const & as : (*simulation_mode->get_alteration_mode()->get_alterable_statements()) ) {
-		if( (as.first).compare( master_name )==0 ) {
-			new_master_name = as.second;
-			return true;
-		}
+	std::map<std::string,std::string>* alterableStatements =
+		simulation_mode->get_alteration_mode()->get_alterable_statements();
+	auto const it = alterableStatements->find( master_name );
+	if( it!=alterableStatements->end() ){
+		new_master_name = it->second;
+		return true;
 	}
 	return false;
 }
@@ -175,39 +201,15 @@ bool ExperimentEnvironment::TestIsCanonicalFolderExcluded( const std::string& ex
 }
 
 bool ExperimentEnvironment::TestIsInstanceOfPrimitive( const std::string& master_name ){
-	if( primitive_names.size() ==0 ){
-		return false;
-	}
-	for( auto const &pn : primitive_names ) {
-		if( pn.compare( master_name )== 0 ) {
-			return true;
-		}
-	}
-	return false;
+	return primitive_names_set.find( master_name )!=primitive_names_set.end();
 }
 
 bool ExperimentEnvironment::TestUnalterableNode(const std::string& node_name){
-	if( unalterable_nodes.size() ==0 ){
-		return false;
-	}
-	for( auto const &un : unalterable_nodes ){
-		if( un.compare( node_name ) == 0 ){
-			return true;
-		}
-	}
-	return false;
+	return unalterable_nodes_set.find( node_name )!=unalterable_nodes_set.end();
 }
 
 bool ExperimentEnvironment::TestReservedStatement(const std::string& start){
-	if( reserved_words.size() ==0 ){
-		return false;
-	}
-	for( auto const &rw : reserved_words ){
-		if( rw.compare(start) == 0 ){
-			return true;
-		}
-	}
-	return false;
+	return reserved_words_set.find( start )!=reserved_words_set.end();
 }
 
 // fgarcia
@@ -245,8 +247,10 @@ void ExperimentEnvironment::UpdatekAnalysisStatementRegEx(){
 
 	kAnalysisStatementRegEx = "";
 	std::string analysis_names = "";
+	std::vector<std::string> analysis_master_names;
 	for( auto const &at : analysis_types ){
 		analysis_names += "\\b" + at->get_master_name() + "\\b|";
+		analysis_master_names.push_back( at->get_master_name() );
 		//analysis_names += "\\s+" + (*it_a)->get_master_name() +"\\s+|";
 	}
 	boost::replace_last( analysis_names, "|", kEmptyWord);
@@ -260,6 +264,8 @@ void ExperimentEnvironment::UpdatekAnalysisStatementRegEx(){
 		+ "(?:\\b" + kSuportedNamesCharsRegEx
 		+ "\\b\\s+\\(?(?:\\s*\\b" + kSuportedNamesCharsRegEx + "\\b\\s+)*\\)?\\s*)("
 		+ analysis_names + ")(?=(\\s*\\{)|$)"; // 1, 2
+	analysis_statement_regex = boost::regex( kAnalysisStatementRegEx );
+	analysis_lexer.SetKeywords( analysis_master_names );
 	#ifdef VERBOSE_REGEX
 		log_io->ReportPlain2Log( kEmptyLine + kEmptyLine + kTab
 			+ "kAnalysisStatementRegEx:'" + kAnalysisStatementRegEx + "'"
@@ -268,30 +274,22 @@ void ExperimentEnvironment::UpdatekAnalysisStatementRegEx(){
 }
 
 bool ExperimentEnvironment::TestAnalysisStatement( const std::string& statementCode ){
-	boost::regex ip_regex(kAnalysisStatementRegEx);
+	if( !analysis_lexer.MayContainKeyword( statementCode ) ){
+		return false;
+	}
 	boost::smatch what;
 	#ifdef VERBOSE_REGEX
 		log_io->ReportPlain2Log( "analysis statement regex");
 	#endif
-	return boost::regex_search(statementCode, what, ip_regex);
+	return boost::regex_search(statementCode, what, analysis_statement_regex);
 }
 
 bool ExperimentEnvironment::TestIsNonSpectreLanguage( const std::string& statementCode ){
-	boost::regex ip_regex(kNonSpectreLanguageRegEx);
-	boost::smatch what;
-	#ifdef VERBOSE_REGEX
-		log_io->ReportPlain2Log( "non spectre language regex");
-	#endif
-	return boost::regex_search(statementCode, what, ip_regex);
+	return NetlistLexer::TestSimulatorLanguage( statementCode, false );
 }
 
 bool ExperimentEnvironment::TestIsSpectreLanguage( const std::string& statementCode ){
-	boost::regex ip_regex(kSpectreLanguageRegEx);
-	boost::smatch what;
-	#ifdef VERBOSE_REGEX
-		log_io->ReportPlain2Log( "spectre language regex");
-	#endif
-	return boost::regex_search(statementCode, what, ip_regex);
+	return NetlistLexer::TestSimulatorLanguage( statementCode, true );
 }
 
 bool ExperimentEnvironment::TestIsAnalysisStatementAdvanced(const std::string& analysis_master_name){
@@ -308,8 +306,10 @@ void ExperimentEnvironment::UpdatekTransistorStatementRegEx(){
 
 	kTransistorStatementRegEx = "";
 	std::string transistor_master_names = "";
+	std::vector<std::string> transistor_names;
 	for( auto const & tst : transistor_statement_types ){
 		transistor_master_names += "\\b" + tst->get_master_name() + "\\b|";
+		transistor_names.push_back( tst->get_master_name() );
 	}
 	boost::replace_last( transistor_master_names, "|", kEmptyWord);
 
@@ -317,6 +317,8 @@ void ExperimentEnvironment::UpdatekTransistorStatementRegEx(){
 		"(?:" + kSuportedNamesCharsRegEx
 		+ "\\s+\\(?(?:\\s*" + kSuportedNamesCharsRegEx + "\\s+)*\\)?\\s*)("
 		+ transistor_master_names + ")(?=(\\s*)|$)"; // 1
+	transistor_statement_regex = boost::regex( kTransistorStatementRegEx );
+	transistor_lexer.SetKeywords( transistor_names );
 	#ifdef VERBOSE_REGEX
 		log_io->ReportPlain2Log( kEmptyLine + kEmptyLine + kTab
 			+ "kTransistorStatementRegEx:'" + kTransistorStatementRegEx + "'"
@@ -326,12 +328,14 @@ void ExperimentEnvironment::UpdatekTransistorStatementRegEx(){
 
 bool ExperimentEnvironment::TestTransistorStatement(
 		const std::string& statementCode){
-	boost::regex ip_regex(kTransistorStatementRegEx);
+	if( !transistor_lexer.MayContainKeyword( statementCode ) ){
+		return false;
+	}
 	boost::smatch what;
 	#ifdef VERBOSE_REGEX
 		log_io->ReportPlain2Log( "transistor regex");
 	#endif
-	return boost::regex_search(statementCode, what, ip_regex);
+	return boost::regex_search(statementCode, what, transistor_statement_regex);
 }
 
 void ExperimentEnvironment::UpdatekControlStatementRegEx(){
@@ -345,11 +349,15 @@ void ExperimentEnvironment::UpdatekControlStatementRegEx(){
 
 	std::string control_statement_names = "";
 	std::string special_control_statement_names = "";
+	std::vector<std::string> control_names;
+	std::vector<std::string> special_control_names;
 	for( auto const & cst : control_statement_types ){
 		if(cst->get_special_syntax_control_statement()){
 			special_control_statement_names += "\\b" + cst->get_master_name() + "\\b|";
+			special_control_names.push_back( cst->get_master_name() );
 		}else{
 			control_statement_names += "\\b" + cst->get_master_name() + "\\b|";
+			control_names.push_back( cst->get_master_name() );
 		}
 	}
 	boost::replace_last( special_control_statement_names, "|", kEmptyWord);
@@ -395,6 +403,10 @@ void ExperimentEnvironment::UpdatekControlStatementRegEx(){
 		+ "(\\s+|^)(" + special_control_statement_names + ")(?=$)" //5
 		+ "|" //6
 		+ "(^\\s*)(" + special_control_statement_names + ")(?=\\s*\\{)"; //6
+	control_statement_regex = boost::regex( kControlStatementRegEx );
+	control_statement_regex_special = boost::regex( kControlStatementRegExSpecial );
+	control_lexer.SetKeywords( control_names );
+	control_lexer_special.SetKeywords( special_control_names );
 	#ifdef VERBOSE_REGEX
 		log_io->ReportPlain2Log( kEmptyLine + kEmptyLine + kTab
 			+ "kControlStatementRegEx:'" + kControlStatementRegEx + "'"
@@ -408,17 +420,17 @@ void ExperimentEnvironment::UpdatekControlStatementRegEx(){
 bool ExperimentEnvironment::TestControlStatement( const std::string& statementCode,
 		bool& special_syntax_control_statement){
 
-	boost::regex ip_regex(kControlStatementRegEx);
-	boost::regex ip_regex_special(kControlStatementRegExSpecial);
 	boost::smatch what;
 	#ifdef VERBOSE_REGEX
 		log_io->ReportPlain2Log( "ControlStatement regex");
 	#endif
-	bool standard_syntax_control_statement = boost::regex_search(statementCode, what, ip_regex);
+	bool standard_syntax_control_statement = control_lexer.MayContainKeyword( statementCode )
+		&& boost::regex_search(statementCode, what, control_statement_regex);
 	#ifdef VERBOSE_REGEX
 		log_io->ReportPlain2Log( "ControlStatement Special regex");
 	#endif
-	special_syntax_control_statement = boost::regex_search(statementCode, what, ip_regex_special);
+	special_syntax_control_statement = control_lexer_special.MayContainKeyword( statementCode )
+		&& boost::regex_search(statementCode, what, control_statement_regex_special);
 	return standard_syntax_control_statement || special_syntax_control_statement;
 
 
@@ -32,6 +32,9 @@
 // c++ std libraries includes
 #include <string>
 #include <vector>
+#include <unordered_set>
+// Boost
+#include <boost/regex.hpp>
 // radiation io simulator includes
 #include "io_handling/log_io.hpp"
 // Radiation Simulator includes
@@ -43,6 +46,7 @@
 #include "netlist_modeling/statements/transistor_statement.hpp"
 #include "netlist_modeling/statements/radiation_source_subcircuit_statement.hpp"
 #include "netlist_modeling/node.hpp"
+#include "netlist_modeling/netlist_lexer.hpp"
 
 class ExperimentEnvironment {
 public:
@@ -295,6 +299,15 @@ public:
 	/// Test the environment
 	void TestEnvironment();
 
+	/**
+	 * @brief Environment settings on which the parsed statements depend
+	 * @details Netlists parsed with the same fingerprint (and content)
+	 * produce the same statements, used to validate the parsed netlists cache.
+	 *
+	 * @return fingerprint string
+	 */
+	std::string GetParsingFingerprint();
+
 private:
 	/// Mode
 	SimulationMode* simulation_mode;
@@ -310,6 +323,12 @@ private:
 	std::vector<std::string> primitive_names;
 	/// Reserved words list
 	std::vector<std::string> reserved_words;
+	/// Hashed copies of the lists above, used by the Test* methods.
+	/// Updated by the Add* methods, the lists must not be modified elsewhere.
+	std::unordered_set<std::string> unalterable_statements_set;
+	std::unordered_set<std::string> unalterable_nodes_set;
+	std::unordered_set<std::string> primitive_names_set;
+	std::unordered_set<std::string> reserved_words_set;
 	/// Analysis list
 	std::vector<AnalysisStatement*> analysis_types;
 	/// Control statements list
@@ -318,6 +337,8 @@ private:
 	std::vector<TransistorStatement*> transistor_statement_types;
 	/// Global Nodes list
 	std::vector<Node*> global_nodes;
+	/// Global nodes names
+	std::unordered_set<std::string> global_nodes_names;
 	/// Technology name
 	std::string technology_name;
 	/// technology model files
@@ -337,11 +358,22 @@ private:
 	std::string kControlStatementRegEx;
 	/// Control statements regex with special sintax
 	std::string kControlStatementRegExSpecial;
-	/// Spectre lang regex
+	/// Spectre lang regex (NetlistLexer::TestSimulatorLanguage)
 	std::string kSpectreLanguageRegEx = "\\s*\\bsimulator\\b\\s+\\blang\\b\\s*=\\s*\\bspectre\\b";
-	/// Non spectre lang regex
+	/// Non spectre lang regex (NetlistLexer::TestSimulatorLanguage)
 	std::string kNonSpectreLanguageRegEx = "\\s*\\bsimulator\\b\\s+\\blang\\b\\s*=\\s*";
 
+	/// Compiled regex, updated with the string ones
+	boost::regex analysis_statement_regex;
+	boost::regex transistor_statement_regex;
+	boost::regex control_statement_regex;
+	boost::regex control_statement_regex_special;
+	/// Master names lexers, discard statements before the regex search
+	NetlistLexer analysis_lexer;
+	NetlistLexer transistor_lexer;
+	NetlistLexer control_lexer;
+	NetlistLexer control_lexer_special;
+
 };
 
 #endif /* EXPERIMENT_ENVIRONMENT_H */
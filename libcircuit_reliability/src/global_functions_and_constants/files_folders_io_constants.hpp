@@ -21,6 +21,7 @@ static const std::string kMCDATASufix = ".mcdata";
 static const std::string kProcessedPrefix = "processed_";
 
 static const std::string kDataSufix = ".data";
+static const std::string kBinaryDataSufix = ".bdata";
 static const std::string kGnuPlotScriptSufix = ".gnuplot";
 static const std::string kCsvSufix = ".csv";
 static const std::string kSvgSufix = ".svg";
@@ -30,6 +31,7 @@ static const std::string kSummaryFile = "main_summary.data";
 static const std::string kProfilesSummaryFile = "profiles_list.txt";
 
 static const std::string kProcessedTransientFile = "processed" + kDataSufix;
+static const std::string kProcessedBinaryTransientFile = "processed" + kBinaryDataSufix;
 static const std::string kGnuplotTransientSVGSufix = "_tran" + kSvgSufix;
 // Simulation Folders
 static const std::string kSimulationsFolder = "simulations";
@@ -42,6 +44,7 @@ static const std::string kXMLFolder = "xml";
 static const std::string kAlterationScenariosFolder = "altered_scenarios";
 static const std::string kAlterationInjectorName = "radiation_source_injector";
 static const std::string kAlterationScenarioFolderPrefix = "altered_scenario";
+static const std::string kSharedScenarioNetlistsFolder = "shared_scenario_netlists";
 static const std::string kAlterationSourceCircuitFolder = "radiation_source_circuit";
 
 // Netlist files
@@ -50,11 +53,21 @@ static const std::string kAlterationSourceNetlistFile = kAlterationSourcesCircui
 static const std::string kAlteredStatementsNetlistFile = kAlteredStatementsCircuitStringId + kCircutFileSufix;
 static const std::string kMainNetlistFile = kMainCircuitStringId + kCircutFileSufix;
 static const std::string kParametersCircuitFile = kParametersCircuitStringId + kCircutFileSufix;
+// main netlist of a batch of critical parameter probes, the original one is renamed
+static const std::string kBatchedMainNetlistFile = kMainCircuitStringId + "_batched" + kCircutFileSufix;
+static const std::string kBatchedProbeSufix = "_probe_";
 
 // Transient export formats
 static const int kMatlab = 0;
 static const int kGnuPlot = 1;
 static const int kCSV = 2;
+// float64 columns, see ProcessedResultsFile
+static const int kBinary = 3;
+
+// Spectre raw (transient) formats, detected by header sniffing
+static const int kRawFormatUnknown = -1;
+static const int kRawFormatPSFASCII = 0; // -f psfascii
+static const int kRawFormatNutBin = 1; // -f nutbin
 
 // results
 static const std::string kResultsFolder = "results";
@@ -115,4 +128,10 @@ static const std::string kLatexSimulationResultsFile ="simulation_results.tex";
 static const std::string kLatexSimulationResultsAppendixFile ="simulation_results_appendix.tex";
 static const std::string kLatexDefinitionsFile ="definitions.tex";
 
+// parsed netlists cache
+static const std::string kParsedNetlistCacheFileSufix = ".pnc";
+static const std::string kParsedNetlistCacheMagic = "parsed_netlist_cache";
+// increase when the statements (or their parsing) change
+static const int kParsedNetlistCacheVersion = 1;
+
 #endif /* FILES_FOLDERS_IO_CONSTANTS_H */
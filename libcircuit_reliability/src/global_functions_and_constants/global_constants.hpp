@@ -30,6 +30,16 @@
 // #define DESTRUCTORS_VERBOSE ;
 
 static const double kSpectreMaxAllowedSimDiffCoeff = 2e-10;
+// Spectre expected memory (MB), weights of the spectre resource tokens
+static const double kSpectreBaseMemoryMB = 256;
+static const double kSpectreMemoryMBPerNetlistKB = 0.5;
+// Warm started critical parameter search, initial bracket [value/(1+margin), value*(1+margin)]
+static const double kCriticalParameterWarmStartMargin = 0.25;
+// Root finding critical parameter search, min |failure distance| and min regula falsi step (bracket ratio)
+static const double kCriticalParameterMinFailureDistance = 1e-3;
+static const double kCriticalParameterMinRegulaFalsiRatio = 0.01;
+// Adaptive ND sweeps, sweep steps between the coarse grid profiles
+static const unsigned int kAdaptiveSweepCoarseStride = 4;
 
 static const std::string kSpectreHandlerLibTitle = "Circuit Reliability Framework";
 static const std::string kSpectreHandlerLibVersion = "v3.3.3";
@@ -22,7 +22,7 @@ std::string GetCurrentDateTime( const any_string_like_type& myFormat ) {
 	time_t	 now = time(0);
 	struct tm tstruct;
 	char	 buf[80];
-	tstruct = *localtime(&now);
+	localtime_r( &now, &tstruct );
 	// Visit http://en.cppreference.com/w/cpp/chrono/c/strftime
 	// for more information about date/time format
 	strftime(buf, sizeof(buf), myFormat, &tstruct);
@@ -15,6 +15,7 @@
 //#define BOOST_NO_CXX11_SCOPED_ENUMS // needed for copy file
 #include "boost/filesystem.hpp" // includes all needed Boost.Filesystem declarations
 #include <boost/algorithm/string.hpp>
+#include <boost/bind.hpp>
 // radiation simulator includes
 #include "circuit_io_handler.hpp"
 #include "../metric_modeling/ocean_eval_metric.hpp"
@@ -105,10 +106,8 @@ bool CircuitIOHandler::ReadMainNetlist( int stateNumber, std::string netlistFile
 			+ pn.string() + "', file does not exist." );
 		return false;
 	}
-	std::string mainCircuitFolder = pn.parent_path().c_str();
 
-	success = ReadNetlist(netlistFile, mainCircuitFolder,
-		mainCircuit, mainCircuit, true, circuitCount, statementCount,
+	success = ReadNetlist(netlistFile, mainCircuit, circuitCount, statementCount,
 		parsingSpectreCode, permissiveParsingMode );
 	if( success ){
 		log_io->ReportPlainStandard( k2Tab + "-> Main circuit read." );
@@ -119,115 +118,225 @@ bool CircuitIOHandler::ReadMainNetlist( int stateNumber, std::string netlistFile
 	return success;
 }
 
-bool CircuitIOHandler::ReadNetlist( std::string netlistAbsolutePath,
-	std::string folderFromWhichIsInstantiated,
-	CircuitStatement& circuit, CircuitStatement& parentCircuit,
-	bool isMain, int& circuitCount, int& statementCount,
+bool CircuitIOHandler::ReadNetlist( std::string netlistAbsolutePath, CircuitStatement& mainCircuit,
+	int& circuitCount, int& statementCount,
 	bool& parsingSpectreCode, const bool permissiveParsingMode ){
 
 	bool success = true;
-	std::string s_circuitCount = number2String(circuitCount);
-	if( isMain ) {
-		log_io->ReportPlainStandard( kTab + "* Reading Main netlist..." );
-	}else{
-		log_io->ReportPlainStandard( kTab + + "* Parsing included circuit #" + s_circuitCount + ", reading netlist..." );
-	}
+	log_io->ReportPlainStandard( kTab + "* Reading Main netlist..." );
 	// Path relative/absolute alterations
 	boost::filesystem::path pn( netlistAbsolutePath );
-	if( isMain || pn.is_absolute() ){
-		log_io->ReportPlain2Log( kTab + "Absolute path: " + netlistAbsolutePath );
-		folderFromWhichIsInstantiated = pn.parent_path().c_str();
-		parsed_circuits.push_back( boost::filesystem::canonical(pn).c_str() );
-		log_io->ReportPlain2Log( kTab + "Marked canonical path: " + parsed_circuits.back() );
-	}else{
-		log_io->ReportError2AllLogs( "Found relative path where there should be an absolute one: '"
-			+ netlistAbsolutePath + "'");
+	log_io->ReportPlain2Log( kTab + "Absolute path: " + netlistAbsolutePath );
+	std::string folderFromWhichIsInstantiated = pn.parent_path().c_str();
+	std::string mainCanonicalPath = boost::filesystem::canonical(pn).c_str();
+	parsed_circuits.insert( mainCanonicalPath );
+	claimed_netlists.insert( mainCanonicalPath );
+	log_io->ReportPlain2Log( kTab + "Marked canonical path: " + mainCanonicalPath );
+	// parsed netlists cache
+	if( parsed_netlist_cache.get_enabled() ){
+		if( boost::filesystem::is_directory( parsed_netlist_cache.get_cache_folder() )
+			|| CreateFolder( parsed_netlist_cache.get_cache_folder(), false ) ){
+			parsing_fingerprint = experiment_environment->GetParsingFingerprint()
+				+ "permissive:" + number2String( permissiveParsingMode ) + "\n";
+		}else{
+			log_io->ReportError2AllLogs( k2Tab + "Error creating the parsed netlists cache folder '"
+				+ parsed_netlist_cache.get_cache_folder() + "', included netlists will not be cached." );
+			parsed_netlist_cache.set_cache_folder( "" );
+		}
 	}
 	//parse netlist
-	success = circuit.ParseNetlist( netlistAbsolutePath, statementCount,
+	success = mainCircuit.ParseNetlist( netlistAbsolutePath, statementCount,
 		parsingSpectreCode, permissiveParsingMode );
 	if( !success ){
 		log_io->ReportError2AllLogs( k2Tab + "Error parsing '"
-			+ s_circuitCount + "' circuit !!!." );
+			+ number2String(circuitCount) + "' circuit !!!." );
 		return false;
 	}
-
-	log_io->ReportPlainStandard( k2Tab + "-> '" + s_circuitCount +
+	log_io->ReportPlainStandard( k2Tab + "-> '" + number2String(circuitCount) +
 		"' circuit parsed. Scanning for instances child of (inline) subcircuits." );
-	// parse included netlist
+	// parse included netlists concurrently
+	std::vector<std::string> includeCanonicalPaths;
+	ParseIncludedNetlists( folderFromWhichIsInstantiated, mainCircuit,
+		includeCanonicalPaths, permissiveParsingMode );
+	// the include tree is complete, place it as the sequential parsing would do
+	success = PlaceIncludedNetlists( mainCircuit, mainCircuit, includeCanonicalPaths,
+		circuitCount, statementCount );
+	for( auto const &pn : parsed_netlists ){
+		if( !pn.second->placed ){
+			delete pn.second->circuit;
+		}
+		delete pn.second;
+	}
+	parsed_netlists.clear();
+	claimed_netlists.clear();
+	if( success ){
+		log_io->ReportPlainStandard( k2Tab + "Circuit '0' and children correctly parsed." );
+	}else{
+		log_io->ReportError2AllLogs( k2Tab + "Error reading '0' circuit !!!." );
+	}
+	return success;
+}
+
+void CircuitIOHandler::ParseIncludedNetlists( const std::string& folderFromWhichIsInstantiated,
+	CircuitStatement& circuit, std::vector<std::string>& includeCanonicalPaths,
+	const bool permissiveParsingMode ){
+	SimulationsTaskGroup tg( &parsing_thread_pool, parsing_thread_pool.get_max_parallel_instances() );
 	for( auto const & is : *circuit.get_referenced_include_statements() ){
 		std::string canonical_path = "";
-		if(  boost::starts_with( is->get_raw_content(), "/")
-			|| boost::starts_with( is->get_raw_content(), "\\")) {
-			if(  boost::filesystem::exists( is->get_raw_content() ) ){
-				canonical_path = boost::filesystem::canonical(is->get_raw_content()).c_str();
-			}else{
-				log_io->ReportError2AllLogs( k2Tab + "Error reading '"
-					+ is->get_raw_content() + "' circuit !!!. File does not exist." );
-				return false;
-			}
-		}else{
-			if( boost::filesystem::exists(
-				folderFromWhichIsInstantiated + kFolderSeparator + is->get_raw_content() ) ){
-				canonical_path = boost::filesystem::canonical(
-					folderFromWhichIsInstantiated + kFolderSeparator + is->get_raw_content()).c_str();
-			}else{
-				log_io->ReportError2AllLogs( k2Tab + "Error reading '"
-					+ is->get_raw_content() + "' circuit !!!. File does not exist." );
-				return false;
-			}
+		std::string includePath = is->get_raw_content();
+		if( !boost::starts_with( is->get_raw_content(), "/")
+			&& !boost::starts_with( is->get_raw_content(), "\\") ) {
+			includePath = folderFromWhichIsInstantiated + kFolderSeparator + is->get_raw_content();
+		}
+		if( boost::filesystem::exists( includePath ) ){
+			canonical_path = boost::filesystem::canonical( includePath ).c_str();
+		}
+		includeCanonicalPaths.push_back( canonical_path );
+		if( canonical_path.empty()
+			|| experiment_environment->TestIsCanonicalFolderExcluded( canonical_path ) ){
+			continue;
 		}
-		if( boost::filesystem::exists(canonical_path) ){
-			if( !NetlistAlreadyParsed( canonical_path )
-				&& !experiment_environment->TestIsCanonicalFolderExcluded( canonical_path ) ){
-				CircuitStatement* includedCircuit = new CircuitStatement( true );
-				// Preincrement!
-				includedCircuit->set_circuit_id( ++circuitCount );
-				includedCircuit->set_id( statementCount++ );
-				includedCircuit->set_post_parsing_statement_handler( post_parsing_statement_handler );
-				// logger
-				includedCircuit->set_log_io( log_io );
-				// includedCircuit->.set_post_parsing_statement_handler( post_parsing_statement_handler );
-				includedCircuit->set_experiment_environment( experiment_environment );
-				includedCircuit->set_master_name("circuit");
-				includedCircuit->set_name( kIncludedPrefixId + number2String(circuitCount) );
-				includedCircuit->set_description( is->get_raw_content() );
-				success = success && ReadNetlist( canonical_path, folderFromWhichIsInstantiated,
-					*includedCircuit, circuit, false, circuitCount,
-					statementCount, parsingSpectreCode, permissiveParsingMode);
-				parentCircuit.AddReferencedCircuitStatement( includedCircuit );
-				is->set_scanned( true );
-				is->set_refered_circuit_id( kIncludedPrefixId + number2String(includedCircuit->get_circuit_id()) );
-				is->set_export_canonical_path( false );
-			}else{
-				log_io->ReportPlain2Log(  kTab + "Netlist '" + canonical_path + "' parsing has been ommited." );
-				is->set_export_canonical_path( true );
-				is->set_scanned( true );
-				is->set_raw_content( canonical_path );
+		ParsedNetlist* parsedNetlist = nullptr;
+		{
+			boost::mutex::scoped_lock lock( parsed_netlists_mutex );
+			if( claimed_netlists.insert( canonical_path ).second ){
+				parsedNetlist = new ParsedNetlist();
+				parsedNetlist->circuit = nullptr;
+				parsedNetlist->statement_count = 0;
+				parsedNetlist->success = false;
+				parsedNetlist->placed = false;
+				parsed_netlists[canonical_path] = parsedNetlist;
 			}
-		}else{
-			log_io->ReportError2AllLogs( k2Tab + "Error reading '"
-				+ is->get_raw_content() + "' circuit !!!. File does not exist." );
-			return false;
+		}
+		// netlists are parsed once, whoever includes them first
+		if( parsedNetlist!=nullptr ){
+			tg.Run( boost::bind( &CircuitIOHandler::ParseIncludedNetlist, this,
+				canonical_path, parsedNetlist, permissiveParsingMode ) );
 		}
 	}
-	if( success ){
-		log_io->ReportPlainStandard( k2Tab + "Circuit '"
-			+ s_circuitCount + "' and children correctly parsed." );
+	tg.Wait();
+}
+
+void CircuitIOHandler::ParseIncludedNetlist( const std::string canonicalPath, ParsedNetlist* parsedNetlist,
+	const bool permissiveParsingMode ){
+	CircuitStatement* includedCircuit = CreateIncludedCircuit( parsedNetlist );
+	uint64_t contentHash = 0;
+	bool cacheable = parsed_netlist_cache.get_enabled()
+		&& parsed_netlist_cache.HashNetlist( canonicalPath, contentHash );
+	if( cacheable && parsed_netlist_cache.Load( canonicalPath, contentHash, parsing_fingerprint,
+		*includedCircuit, parsedNetlist->statements_found, parsedNetlist->statement_count ) ){
+		log_io->ReportPlainStandard( kTab + "* Included netlist '" + canonicalPath + "' restored from cache." );
+		parsedNetlist->success = true;
 	}else{
-		log_io->ReportError2AllLogs( k2Tab + "Error reading '"
-			+ s_circuitCount + "' circuit !!!." );
+		if( cacheable ){
+			// discard the circuit, it may be partially restored
+			delete includedCircuit;
+			includedCircuit = CreateIncludedCircuit( parsedNetlist );
+		}
+		log_io->ReportPlainStandard( kTab + "* Parsing included netlist '" + canonicalPath + "'..." );
+		bool parsingSpectreCode = false;
+		parsedNetlist->success = includedCircuit->ParseNetlist( canonicalPath,
+			parsedNetlist->statement_count, parsingSpectreCode, permissiveParsingMode );
+		if( !parsedNetlist->success ){
+			log_io->ReportError2AllLogs( k2Tab + "Error parsing '" + canonicalPath + "' !!!." );
+			return;
+		}
+		// stored before placing it (statement ids starting at 0)
+		if( cacheable && !parsed_netlist_cache.Store( canonicalPath, contentHash, parsing_fingerprint,
+			*includedCircuit, parsedNetlist->statements_found, parsedNetlist->statement_count ) ){
+			log_io->ReportPlain2Log( k2Tab + "Included netlist '" + canonicalPath + "' has not been cached." );
+		}
 	}
-	return success;
+	boost::filesystem::path pn( canonicalPath );
+	ParseIncludedNetlists( pn.parent_path().c_str(), *includedCircuit,
+		parsedNetlist->include_canonical_paths, permissiveParsingMode );
+}
+
+CircuitStatement* CircuitIOHandler::CreateIncludedCircuit( ParsedNetlist* parsedNetlist ){
+	CircuitStatement* includedCircuit = new CircuitStatement( true );
+	includedCircuit->set_post_parsing_statement_handler( &parsedNetlist->statements_found );
+	includedCircuit->set_defer_global_nodes( true );
+	// logger
+	includedCircuit->set_log_io( log_io );
+	includedCircuit->set_experiment_environment( experiment_environment );
+	includedCircuit->set_master_name("circuit");
+	parsedNetlist->circuit = includedCircuit;
+	return includedCircuit;
 }
 
-bool CircuitIOHandler::NetlistAlreadyParsed( std::string path ){
-	for( auto& pc : parsed_circuits ){
-		if( path.compare( pc )==0 ){
-			return true;
+bool CircuitIOHandler::PlaceIncludedNetlists( CircuitStatement& circuit, CircuitStatement& parentCircuit,
+	const std::vector<std::string>& includeCanonicalPaths, int& circuitCount, int& statementCount ){
+	bool success = true;
+	std::vector<IncludeStatement*>& includeStatements = *circuit.get_referenced_include_statements();
+	for( unsigned int i=0; i<includeStatements.size(); ++i ){
+		IncludeStatement* is = includeStatements.at(i);
+		const std::string& canonical_path = includeCanonicalPaths.at(i);
+		if( canonical_path.empty() ){
+			log_io->ReportError2AllLogs( k2Tab + "Error reading '"
+				+ is->get_raw_content() + "' circuit !!!. File does not exist." );
+			return false;
+		}
+		if( !NetlistAlreadyParsed( canonical_path )
+			&& !experiment_environment->TestIsCanonicalFolderExcluded( canonical_path ) ){
+			ParsedNetlist* parsedNetlist = parsed_netlists.at( canonical_path );
+			CircuitStatement* includedCircuit = parsedNetlist->circuit;
+			// Preincrement!
+			includedCircuit->set_circuit_id( ++circuitCount );
+			includedCircuit->set_id( statementCount++ );
+			includedCircuit->set_name( kIncludedPrefixId + number2String(circuitCount) );
+			includedCircuit->set_description( is->get_raw_content() );
+			if( success ){
+				std::string s_circuitCount = number2String(circuitCount);
+				log_io->ReportPlainStandard( kTab + "* Placing included circuit #" + s_circuitCount + "..." );
+				parsed_circuits.insert( canonical_path );
+				log_io->ReportPlain2Log( kTab + "Marked canonical path: " + canonical_path );
+				if( !parsedNetlist->success ){
+					log_io->ReportError2AllLogs( k2Tab + "Error parsing '"
+						+ s_circuitCount + "' circuit !!!." );
+					success = false;
+				}else{
+					// statement ids, numbered from 0 while parsing
+					for( auto const &c : *includedCircuit->get_children() ){
+						c->ShiftIds( statementCount );
+					}
+					statementCount += parsedNetlist->statement_count;
+					includedCircuit->UpdateOwnScope();
+					// dependencies and global nodes, in the sequential parsing order
+					includedCircuit->set_post_parsing_statement_handler( post_parsing_statement_handler );
+					post_parsing_statement_handler->AppendStatementsFound( parsedNetlist->statements_found );
+					includedCircuit->set_defer_global_nodes( false );
+					for( auto const &n : *includedCircuit->get_deferred_global_nodes() ){
+						experiment_environment->AddGlobalNode( n );
+					}
+					includedCircuit->get_deferred_global_nodes()->clear();
+					success = PlaceIncludedNetlists( *includedCircuit, circuit,
+						parsedNetlist->include_canonical_paths, circuitCount, statementCount );
+					if( success ){
+						log_io->ReportPlainStandard( k2Tab + "Circuit '"
+							+ s_circuitCount + "' and children correctly parsed." );
+					}else{
+						log_io->ReportError2AllLogs( k2Tab + "Error reading '"
+							+ s_circuitCount + "' circuit !!!." );
+					}
+				}
+			}
+			parsedNetlist->placed = true;
+			parentCircuit.AddReferencedCircuitStatement( includedCircuit );
+			is->set_scanned( true );
+			is->set_refered_circuit_id( kIncludedPrefixId + number2String(includedCircuit->get_circuit_id()) );
+			is->set_export_canonical_path( false );
+		}else{
+			log_io->ReportPlain2Log(  kTab + "Netlist '" + canonical_path + "' parsing has been ommited." );
+			is->set_export_canonical_path( true );
+			is->set_scanned( true );
+			is->set_raw_content( canonical_path );
 		}
 	}
-	return false;
+	return success;
+}
+
+bool CircuitIOHandler::NetlistAlreadyParsed( const std::string& path ){
+	return parsed_circuits.find( path )!=parsed_circuits.end();
 }
 
 bool CircuitIOHandler::ExportSingularNetlist( std::string singularFolder, CircuitStatement& singularCircuit ){
@@ -287,6 +396,38 @@ bool CircuitIOHandler::ExportNonAlteredNetlist( CircuitStatement& circuit, bool
 	return success;
 }
 
+bool CircuitIOHandler::ExportSharedScenarioNetlists( CircuitStatement& radiationCircuit,
+	CircuitStatement& mainCircuit, std::string folder ){
+	bool success = true;
+	// Export radiation netlist.
+	success = success && radiationCircuit.ExportCircuit2SCS( folder + kFolderSeparator + kAlterationSourceNetlistFile );
+	// Export non-altered netlists
+	success = success && ExportNonAlteredNetlist( mainCircuit, true, folder );
+	if( success ){
+		shared_scenario_netlists_folder = folder;
+		log_io->ReportPlainStandard( k2Tab + "-> Shared scenario netlists exported: '" + folder + "'" );
+	}else{
+		log_io->ReportError2AllLogs( k2Tab + "Error exporting shared scenario netlists !!! '" + folder + "'" );
+	}
+	return success;
+}
+
+bool CircuitIOHandler::StageSharedScenarioNetlists( CircuitStatement& alteredCircuit,
+	CircuitStatement& mainCircuit, const std::string& folder ){
+	if( !scenario_stager.StageFolder( shared_scenario_netlists_folder, folder ) ){
+		log_io->ReportError2AllLogs( k2Tab + "Error staging shared scenario netlists in '" + folder + "'" );
+		return false;
+	}
+	// Non-altered netlist of the altered circuit, not exported in altered scenarios
+	boost::system::error_code ec;
+	if( alteredCircuit.get_circuit_id()==mainCircuit.get_circuit_id() ) {
+		boost::filesystem::remove( folder + kFolderSeparator + kMainNetlistFile, ec );
+	}
+	// The altered netlist is exported afterwards, it must not overwrite the shared file (hardlink)
+	boost::filesystem::remove( folder + kFolderSeparator + alteredCircuit.get_name() + kCircutFileSufix, ec );
+	return true;
+}
+
 bool CircuitIOHandler::ExportSimpleAlteredScenario( CircuitStatement& radiationCircuit,
 	CircuitStatement& alteredCircuit, CircuitStatement& mainCircuit, std::string folder ){
 	bool success = true;
@@ -295,6 +436,12 @@ bool CircuitIOHandler::ExportSimpleAlteredScenario( CircuitStatement& radiationC
 	#ifdef NETLIST_EXPORT_VERBOSE
 		log_io->ReportPlain2Log( k2Tab + "Exporting altered scenario." );
 	#endif
+	if( !shared_scenario_netlists_folder.empty() ){
+		// radiation and non-altered netlists already exported
+		success = StageSharedScenarioNetlists( alteredCircuit, mainCircuit, folder );
+		oScsFile = folder + kFolderSeparator + alteredCircuit.get_name() + kCircutFileSufix;
+		return success && alteredCircuit.ExportCircuit2SCS( oScsFile );
+	}
 	// Export radiation netlist.
 	oScsFile = folder + kFolderSeparator + kAlterationSourceNetlistFile;
 	success = success &&radiationCircuit.ExportCircuit2SCS( oScsFile);
@@ -325,23 +472,30 @@ bool CircuitIOHandler::ExportAlteredScenario(
 	#ifdef NETLIST_EXPORT_VERBOSE
 		log_io->ReportPlain2Log( k2Tab + "Exporting altered scenario." );
 	#endif
-	// Export radiation netlist.
-	success = success && radiationCircuit.ExportCircuit2SCS( radiationCircuitScsFile);
-	#ifdef NETLIST_EXPORT_VERBOSE
-		log_io->ReportPlain2Log( k2Tab + "Radiation Circuit Exported." );
-	#endif
+	if( !shared_scenario_netlists_folder.empty() ){
+		// radiation and non-altered netlists already exported
+		success = StageSharedScenarioNetlists( alteredCircuit, mainCircuit, folder );
+	}else{
+		// Export radiation netlist.
+		success = success && radiationCircuit.ExportCircuit2SCS( radiationCircuitScsFile);
+		#ifdef NETLIST_EXPORT_VERBOSE
+			log_io->ReportPlain2Log( k2Tab + "Radiation Circuit Exported." );
+		#endif
+	}
 	// Export altered statements netlist.
 	std::string alteredStatementsNetlistScsFile = folder + kFolderSeparator + kAlteredStatementsNetlistFile;
 	success = success && alteredStatementsCircuit.ExportCircuit2SCS( alteredStatementsNetlistScsFile );
 	#ifdef NETLIST_EXPORT_VERBOSE
 		log_io->ReportPlain2Log( k2Tab + "Altered Circuit Exported." );
 	#endif
-	// Export non-altered netlists
-	success = success && ExportAlteredNetlist( mainCircuit,
-		alteredCircuit.get_circuit_id(), true, folder);
-	#ifdef NETLIST_EXPORT_VERBOSE
-		log_io->ReportPlain2Log( k2Tab + "Altered Scenario Exported." );
-	#endif
+	if( shared_scenario_netlists_folder.empty() ){
+		// Export non-altered netlists
+		success = success && ExportAlteredNetlist( mainCircuit,
+			alteredCircuit.get_circuit_id(), true, folder);
+		#ifdef NETLIST_EXPORT_VERBOSE
+			log_io->ReportPlain2Log( k2Tab + "Altered Scenario Exported." );
+		#endif
+	}
 	// Export altered netlist.
 	std::string alteredCircuitScsFile = folder + kFolderSeparator + alteredCircuit.get_name() + kCircutFileSufix;
 	success = success && alteredCircuit.ExportCircuit2SCS( alteredCircuitScsFile);
@@ -11,6 +11,8 @@
  *     + Parses the different circuits
  *     + Handles the netlist circuits exportation.
  * Additionally, it has the main folder creation method.
+ * The included netlists are parsed concurrently, and placed in the
+ * circuit tree (ids, dependencies) once the whole tree has been parsed.
  *
  */
 
@@ -19,14 +21,21 @@
 
 ///CircuitIOHandler Class
 // c++ std libraries includes
+#include <map>
 #include <string>
+#include <unordered_set>
+// Boost
+#include <boost/thread/mutex.hpp>
 // radiation simulator io includes
 #include "log_io.hpp"
+#include "parsed_netlist_cache.hpp"
 // radiation simulator includes
 #include "../experiment_environment.hpp"
 #include "../post_parsing_statement_handler.hpp"
 // simulations handling
 #include "../simulations_handling/simulation_mode.hpp"
+#include "../simulations_handling/simulations_thread_pool.hpp"
+#include "../simulations_handling/scenario_stager.hpp"
 // #include "../simulations_handling/spectre_handler.hpp"
 // netlist modeling includes
 #include "../metric_modeling/metric.hpp"
@@ -86,6 +95,19 @@ public:
 	bool ExportAlteredNetlist( CircuitStatement& circuit, int avoidCircuitId,
 		bool isMain, std::string folder );
 
+	/**
+ 	* @details Exports once the netlists shared by every altered scenario
+ 	* (radiation circuit and non-altered netlists). The altered scenarios exported
+ 	* afterwards stage (hardlink) them, and only export their altered netlists.
+ 	*
+ 	* @param radiationCircuit <CircuitStatement&> Radiation circuit
+ 	* @param mainCircuit <CircuitStatement&> Main circuit.
+ 	* @param folder <std::string> Path to where export the netlists.
+ 	* @return true if the method correctly ends.
+ 	*/
+	bool ExportSharedScenarioNetlists( CircuitStatement& radiationCircuit,
+		CircuitStatement& mainCircuit, std::string folder );
+
 	/**
  	* @details Exports a circuit with a simple alteration:
  	* either the injection of a simple node or the substitution of a simple statement.
@@ -135,6 +157,11 @@ public:
 	/// Sets the Dependence trees handler
 	void set_post_parsing_statement_handler( PostParsingStatementHandler* post_parsing_statement_handler ) {
 		this->post_parsing_statement_handler = post_parsing_statement_handler;}
+	/// Sets the folder of the parsed included netlists cache, empty: no cache
+	void set_parsed_netlist_cache_folder( const std::string& parsed_netlist_cache_folder ) {
+		this->parsed_netlist_cache.set_cache_folder( parsed_netlist_cache_folder );}
+	std::string get_parsed_netlist_cache_folder() const {
+		return parsed_netlist_cache.get_cache_folder();}
 
 	/**
 	 * @brief Adds a metric to the vector of metrics
@@ -145,6 +172,19 @@ public:
 
 
 private:
+	/// Netlist parsed concurrently, placed in the circuit tree afterwards
+	struct ParsedNetlist {
+		CircuitStatement* circuit;
+		/// statements found while parsing, registered in tree order
+		PostParsingStatementHandler statements_found;
+		/// canonical path of each include statement, empty if the file does not exist
+		std::vector<std::string> include_canonical_paths;
+		/// number of statements parsed (ids starting at 0)
+		int statement_count;
+		bool success;
+		bool placed;
+	};
+
 	/// Simulation mode manager
 	SimulationMode* simulation_mode;
 	/// Log manager.
@@ -156,34 +196,81 @@ private:
 	/// List of metrics, needed to create the 'monitors'
 	/// and save the metrics transients
 	std::vector<Metric*> metrics;
-	/// List of parsed circuits.
-	std::vector<std::string> parsed_circuits;
+	/// List of circuits placed in the circuit tree (canonical paths).
+	std::unordered_set<std::string> parsed_circuits;
+	/// Pool parsing the included netlists
+	SimulationsThreadPool parsing_thread_pool;
+	/// Protects claimed_netlists and parsed_netlists
+	boost::mutex parsed_netlists_mutex;
+	/// Canonical paths of the netlists being parsed
+	std::unordered_set<std::string> claimed_netlists;
+	/// Parsed included netlists
+	std::map<std::string, ParsedNetlist*> parsed_netlists;
+	/// Parsed included netlists persistent cache
+	ParsedNetlistCache parsed_netlist_cache;
+	/// Folder of the netlists shared by the altered scenarios, empty: not exported
+	std::string shared_scenario_netlists_folder;
+	/// Stages the shared netlists in the altered scenario folders
+	ScenarioStager scenario_stager;
+	/// Environment (and parsing mode) fingerprint, validates the cached netlists
+	std::string parsing_fingerprint;
 
 	/**
- 	* @details Reads (parses) a specified circuit (as well as its referenced circuits) from a netlist.
+ 	* @details Reads (parses) the main circuit (as well as its referenced circuits) from a netlist.
  	* @param netlistAbsolutePath <std::string> Circuit netlist file (absolute path).
- 	* @param mainCircuitFolder <std::string> Main circuit folder path.
- 	* @param circuit <CircuitStatement&> Circuit.
- 	* @param parentCircuit <CircuitStatement&> Parent circuit.
- 	* @param isMain <bool> Circuit is/is not the main circuit.
+ 	* @param mainCircuit <CircuitStatement&> Main circuit.
  	* @param circuitCount <int&> Circuit count.
  	* @param statementCount <int&> Statement count.
  	* @param parsingSpectreCode <bool&> Currently parsing spectre code.
  	* @param permissiveParsingMode <const bool> Permisive parsing mode.
  	* @return true if the method correctly ends.
  	*/
-	bool ReadNetlist( std::string netlistAbsolutePath, std::string mainCircuitFolder,
-		CircuitStatement& circuit, CircuitStatement& parentCircuit,
-		bool isMain, int& circuitCount, int& statementCount,
+	bool ReadNetlist( std::string netlistAbsolutePath, CircuitStatement& mainCircuit,
+		int& circuitCount, int& statementCount,
 		bool& parsingSpectreCode, const bool permissiveParsingMode );
 
 	/**
- 	* @details Tests if a netlist has been already parsed
+ 	* @details Parses concurrently the netlists included by a circuit (and their includes)
+ 	* @param folderFromWhichIsInstantiated <std::string> Folder of the circuit netlist.
+ 	* @param circuit <CircuitStatement&> Circuit.
+ 	* @param includeCanonicalPaths <std::vector<std::string>&> Canonical path of each include statement.
+ 	* @param permissiveParsingMode <const bool> Permisive parsing mode.
+ 	*/
+	void ParseIncludedNetlists( const std::string& folderFromWhichIsInstantiated,
+		CircuitStatement& circuit, std::vector<std::string>& includeCanonicalPaths,
+		const bool permissiveParsingMode );
+
+	/**
+ 	* @details Parses an included netlist (task), statements are numbered from 0
+ 	* @param canonicalPath <std::string> Netlist canonical path.
+ 	* @param parsedNetlist <ParsedNetlist*> Parsing results.
+ 	* @param permissiveParsingMode <const bool> Permisive parsing mode.
+ 	*/
+	void ParseIncludedNetlist( const std::string canonicalPath, ParsedNetlist* parsedNetlist,
+		const bool permissiveParsingMode );
+
+	CircuitStatement* CreateIncludedCircuit( ParsedNetlist* parsedNetlist );
+
+	/**
+ 	* @details Places the included circuits in the circuit tree, in the sequential parsing order:
+ 	* circuit and statement ids, dependency registration and global nodes
+ 	* @param circuit <CircuitStatement&> Circuit.
+ 	* @param parentCircuit <CircuitStatement&> Parent circuit.
+ 	* @param includeCanonicalPaths <std::vector<std::string>&> Canonical path of each include statement.
+ 	* @param circuitCount <int&> Circuit count.
+ 	* @param statementCount <int&> Statement count.
+ 	* @return true if the method correctly ends.
+ 	*/
+	bool PlaceIncludedNetlists( CircuitStatement& circuit, CircuitStatement& parentCircuit,
+		const std::vector<std::string>& includeCanonicalPaths, int& circuitCount, int& statementCount );
+
+	/**
+ 	* @details Tests if a netlist has been already placed in the circuit tree
  	* @param path <std::string> Circuit netlist file.
  	*
  	* @return true if the netlist has already been parsed
  	*/
-	bool NetlistAlreadyParsed( std::string path );
+	bool NetlistAlreadyParsed( const std::string& path );
 
 	/**
 	 * @brief Adds required simulation statements
@@ -192,6 +279,18 @@ private:
 	 * @param circuit CircuitStatement& target circuit
 	 */
 	void AddSimulationSpecialStatements( CircuitStatement& circuit );
+
+	/**
+	 * @brief Stages the shared netlists in an altered scenario folder,
+	 * but the netlist of the altered circuit
+	 *
+	 * @param alteredCircuit altered circuit
+	 * @param mainCircuit main circuit
+	 * @param folder altered scenario folder
+	 * @return true if the netlists have been staged
+	 */
+	bool StageSharedScenarioNetlists( CircuitStatement& alteredCircuit,
+		CircuitStatement& mainCircuit, const std::string& folder );
 };
 
 #endif /* CIRCUIT_IO_HANDLER_H */
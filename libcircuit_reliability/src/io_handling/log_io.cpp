@@ -142,7 +142,7 @@ std::string LogIO::GetCurrentDateTime() {
 	time_t	 now = time(0);
 	struct tm tstruct;
 	char	 buf[80];
-	tstruct = *localtime(&now);
+	localtime_r( &now, &tstruct );
 	// Visit http://en.cppreference.com/w/cpp/chrono/c/strftime
 	// for more information about date/time format
 	strftime(buf, sizeof(buf), "%d-%m-%Y.%X", &tstruct);
@@ -279,12 +279,14 @@ bool LogIO::ExportReadmeInstanceOfSubcircuitReplacement( const std::string& path
 }
 
 void LogIO::ReportPlain2Log( const std::string& text ){
+	boost::mutex::scoped_lock lock( streams_mutex );
 	#ifdef VERBOSE
 		std::clog << kTab << text << std::endl;
 	#endif
 }
 
 void LogIO::ReportPlainStandard( const std::string& text ){
+	boost::mutex::scoped_lock lock( streams_mutex );
 	std::cout << kTab << text << std::endl;
 	#ifdef VERBOSE
 		std::clog << kTab << text << std::endl;
@@ -292,6 +294,7 @@ void LogIO::ReportPlainStandard( const std::string& text ){
 }
 
 void LogIO::ReportPlain2AllLogs( const std::string& text ){
+	boost::mutex::scoped_lock lock( streams_mutex );
 	std::cout << kTab << text << std::endl;
 	#ifdef VERBOSE
 		std::clog << kTab << text << std::endl;
@@ -300,6 +303,7 @@ void LogIO::ReportPlain2AllLogs( const std::string& text ){
 }
 
 void LogIO::ReportYellowStandard( const std::string& text ){
+	boost::mutex::scoped_lock lock( streams_mutex );
 	std::cout << kTab << kYellow << text << kEndColor << std::endl;
 	#ifdef VERBOSE
 		std::clog << kTab << text << std::endl;
@@ -307,6 +311,7 @@ void LogIO::ReportYellowStandard( const std::string& text ){
 }
 
 void LogIO::ReportGreenStandard( const std::string& text ){
+	boost::mutex::scoped_lock lock( streams_mutex );
 	std::cout << kTab << kGreen << text << kEndColor << std::endl;
 	#ifdef VERBOSE
 		std::clog << kTab << text << std::endl;
@@ -314,6 +319,7 @@ void LogIO::ReportGreenStandard( const std::string& text ){
 }
 
 void LogIO::ReportGrayStandard( const std::string& text ){
+	boost::mutex::scoped_lock lock( streams_mutex );
 	std::cout << kTab << kGray << text << kEndColor << std::endl;
 	#ifdef VERBOSE
 		std::clog << kTab << text << std::endl;
@@ -321,6 +327,7 @@ void LogIO::ReportGrayStandard( const std::string& text ){
 }
 
 void LogIO::ReportRedStandard( const std::string& text ){
+	boost::mutex::scoped_lock lock( streams_mutex );
 	std::cout << kTab << kRed << text << kEndColor << std::endl;
 	#ifdef VERBOSE
 		std::clog << kTab << text << std::endl;
@@ -328,6 +335,7 @@ void LogIO::ReportRedStandard( const std::string& text ){
 }
 
 void LogIO::ReportBlueStandard( const std::string& text ){
+	boost::mutex::scoped_lock lock( streams_mutex );
 	std::cout << kTab << kBlue << text << kEndColor << std::endl;
 	#ifdef VERBOSE
 		std::clog << kTab << text << std::endl;
@@ -335,6 +343,7 @@ void LogIO::ReportBlueStandard( const std::string& text ){
 }
 
 void LogIO::ReportPurpleStandard( const std::string& text ){
+	boost::mutex::scoped_lock lock( streams_mutex );
 	std::cout << kTab << kPurple << text << kEndColor << std::endl;
 	#ifdef VERBOSE
 		std::clog << kTab << text << std::endl;
@@ -342,6 +351,7 @@ void LogIO::ReportPurpleStandard( const std::string& text ){
 }
 
 void LogIO::ReportCyanStandard( const std::string& text ){
+	boost::mutex::scoped_lock lock( streams_mutex );
 	std::cout << kTab << kCyan << text << kEndColor << std::endl;
 	#ifdef VERBOSE
 		std::clog << kTab << text << std::endl;
@@ -349,6 +359,7 @@ void LogIO::ReportCyanStandard( const std::string& text ){
 }
 
 void LogIO::ReportInfo2AllLogs( const std::string& text ){
+	boost::mutex::scoped_lock lock( streams_mutex );
 	std::cout << kTab << kGreen << text << kEndColor << std::endl;
 	#ifdef VERBOSE
 		std::clog << kTab << text << std::endl;
@@ -357,6 +368,7 @@ void LogIO::ReportInfo2AllLogs( const std::string& text ){
 }
 
 void LogIO::ReportUserInformationNeeded( const std::string& text ){
+	boost::mutex::scoped_lock lock( streams_mutex );
 	std::cout << kTab << kYellow << text << kEndColor << std::endl;
 	#ifdef VERBOSE
 		std::clog << kTab << text << std::endl;
@@ -365,6 +377,7 @@ void LogIO::ReportUserInformationNeeded( const std::string& text ){
 }
 
 void LogIO::ReportError2AllLogs( const std::string& text ){
+	boost::mutex::scoped_lock lock( streams_mutex );
 	std::cout << kTab << kRed << "[ERROR REPORTED] " << text << kEndColor << std::endl;
 	#ifdef VERBOSE
 		std::clog << kTab << "[ERROR REPORTED] " << text << std::endl;
@@ -373,6 +386,7 @@ void LogIO::ReportError2AllLogs( const std::string& text ){
 }
 
 void LogIO::ReportWarning2AllLogs( const std::string& text ){
+	boost::mutex::scoped_lock lock( streams_mutex );
 	std::cout << kTab << kOrange << "[WARNING REPORTED] " << text << kEndColor << std::endl;
 	#ifdef VERBOSE
 		std::clog << kTab << "[WARNING REPORTED] " << text << std::endl;
@@ -383,6 +397,7 @@ void LogIO::ReportWarning2AllLogs( const std::string& text ){
 void LogIO::ReportThread( const std::string threadInfo, const int level ){
 	std::string tabulation = level>1 ? k2Tab : kTab;
 	tabulation = ( level >= 3 ? kTab : ""  ) + tabulation;
+	boost::mutex::scoped_lock lock( streams_mutex );
 	std::cout << tabulation << kYellow << "[Thread] [Level " << level << "] " << kEndColor << threadInfo << std::endl;
 	#ifdef VERBOSE
 		std::clog << kTab << "[Thread] " << threadInfo << std::endl;
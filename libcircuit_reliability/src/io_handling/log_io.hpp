@@ -19,6 +19,8 @@
 // c++ std required libraries includes
 #include <fstream>
 #include <string>
+// Boost
+#include <boost/thread/mutex.hpp>
 
 class LogIO {
 public:
@@ -165,6 +167,8 @@ private:
 	std::streambuf* prev_log_buf;
 	/// standard error buffer
 	std::streambuf* prev_cerr_buf;
+	/// Serializes the reports of concurrent threads (log and error streams are file buffers)
+	boost::mutex streams_mutex;
 };
 
 #endif /* LOG_IO */
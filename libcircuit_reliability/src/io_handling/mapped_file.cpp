@@ -0,0 +1,61 @@
+/**
+ * @file mapped_file.cpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * MappedFile Class Body
+ *
+ */
+
+// posix
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+// Radiation simulator
+#include "mapped_file.hpp"
+
+MappedFile::MappedFile() {
+	this->data = nullptr;
+	this->size = 0;
+}
+
+MappedFile::~MappedFile() {
+	Close();
+}
+
+bool MappedFile::Open( const std::string& file_path ){
+	Close();
+	int fd = open( file_path.c_str(), O_RDONLY );
+	if( fd<0 ){
+		return false;
+	}
+	struct stat fileStat;
+	if( fstat( fd, &fileStat )!=0 || fileStat.st_size<=0 ){
+		close( fd );
+		return false;
+	}
+	void* mapped = mmap( nullptr, fileStat.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+	// the mapping keeps its own reference to the file
+	close( fd );
+	if( mapped==MAP_FAILED ){
+		return false;
+	}
+	// raw files are read front to back
+	madvise( mapped, fileStat.st_size, MADV_SEQUENTIAL );
+	data = static_cast<const char*>( mapped );
+	size = fileStat.st_size;
+	return true;
+}
+
+void MappedFile::Close(){
+	if( data!=nullptr ){
+		munmap( const_cast<char*>(data), size );
+		data = nullptr;
+		size = 0;
+	}
+}
@@ -0,0 +1,56 @@
+/**
+ * @file mapped_file.hpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * Read-only memory mapped file.
+ * Raw spectre outputs are scanned in place, without
+ * copying them line by line into std::string objects.
+ *
+ */
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+// c++ std libraries
+#include <string>
+#include <cstddef>
+
+class MappedFile {
+public:
+	/// Default constructor
+	MappedFile();
+	/// Non copyable, the mapping is owned by one object
+	MappedFile( const MappedFile& orig ) = delete;
+	MappedFile& operator=( const MappedFile& orig ) = delete;
+	/// Default destructor, unmaps the file
+	virtual ~MappedFile();
+
+	/**
+	 * @brief Maps the whole file in memory (read only)
+	 *
+	 * @param file_path
+	 * @return true if the file has been mapped
+	 */
+	bool Open( const std::string& file_path );
+
+	/**
+	 * @brief Unmaps the file, if mapped
+	 */
+	void Close();
+
+	bool is_open() const { return data != nullptr; }
+	const char* get_data() const { return data; }
+	const char* get_end() const { return data + size; }
+	std::size_t get_size() const { return size; }
+
+private:
+	const char* data;
+	std::size_t size;
+};
+
+#endif /* MAPPED_FILE_H */
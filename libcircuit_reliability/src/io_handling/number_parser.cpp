@@ -0,0 +1,155 @@
+/**
+ * @file number_parser.cpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * In place number parsing body
+ *
+ */
+
+// c++ std libraries
+#include <cstdlib>
+#include <cstring>
+#include <cstdint>
+#include <string>
+// Radiation simulator
+#include "number_parser.hpp"
+
+// 2^53, bigger mantissas can not be exactly represented by a double
+static const uint64_t kMaxExactMantissa = 9007199254740992ULL;
+// max number of decimal digits stored in a uint64_t
+static const int kMaxMantissaDigits = 19;
+// 10^22 is the highest power of ten exactly represented by a double
+static const int kMaxExactPow10 = 22;
+static const double kExactPowersOf10[] = {
+	1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10,
+	1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20,
+	1e21, 1e22 };
+
+// strtod over a null terminated copy of the token
+// returns the number of consumed chars
+static std::size_t StrtodFallback( const char* begin, const char* end, double& value ){
+	char buffer[64];
+	std::size_t length = end - begin;
+	if( length>=sizeof(buffer) ){
+		std::string token( begin, end );
+		char* parsedEnd;
+		value = std::strtod( token.c_str(), &parsedEnd );
+		return parsedEnd - token.c_str();
+	}
+	std::memcpy( buffer, begin, length );
+	buffer[length] = '\0';
+	char* parsedEnd;
+	value = std::strtod( buffer, &parsedEnd );
+	return parsedEnd - buffer;
+}
+
+bool ParseDouble( const char*& cursor, const char* end, double& value ){
+	const char* it = cursor;
+	while( it<end && ( *it==' ' || *it=='\t' ) ){
+		++it;
+	}
+	const char* begin = it;
+	bool negative = false;
+	if( it<end && ( *it=='-' || *it=='+' ) ){
+		negative = *it=='-';
+		++it;
+	}
+	uint64_t mantissa = 0;
+	int mantissaDigits = 0;
+	int exponent = 0;
+	bool exact = true;
+	bool hasDigits = false;
+	// integer part
+	while( it<end && *it>='0' && *it<='9' ){
+		hasDigits = true;
+		if( mantissaDigits<kMaxMantissaDigits ){
+			mantissa = mantissa*10 + (*it - '0');
+			if( mantissa>0 ){
+				++mantissaDigits;
+			}
+		}else{
+			++exponent;
+			exact = exact && *it=='0';
+		}
+		++it;
+	}
+	// fractional part
+	if( it<end && *it=='.' ){
+		++it;
+		while( it<end && *it>='0' && *it<='9' ){
+			hasDigits = true;
+			if( mantissaDigits<kMaxMantissaDigits ){
+				mantissa = mantissa*10 + (*it - '0');
+				if( mantissa>0 ){
+					++mantissaDigits;
+				}
+				--exponent;
+			}else{
+				exact = exact && *it=='0';
+			}
+			++it;
+		}
+	}
+	if( !hasDigits ){
+		// nan, inf...
+		const char* tokenEnd = begin;
+		while( tokenEnd<end && *tokenEnd!=' ' && *tokenEnd!='\t'
+			&& *tokenEnd!='\n' && *tokenEnd!='\r' ){
+			++tokenEnd;
+		}
+		std::size_t consumed = StrtodFallback( begin, tokenEnd, value );
+		cursor = begin + consumed;
+		return consumed>0;
+	}
+	// exponent, only if followed by digits (strtod behaviour)
+	if( it<end && ( *it=='e' || *it=='E' ) ){
+		const char* exponentIt = it + 1;
+		bool negativeExponent = false;
+		if( exponentIt<end && ( *exponentIt=='-' || *exponentIt=='+' ) ){
+			negativeExponent = *exponentIt=='-';
+			++exponentIt;
+		}
+		if( exponentIt<end && *exponentIt>='0' && *exponentIt<='9' ){
+			int explicitExponent = 0;
+			while( exponentIt<end && *exponentIt>='0' && *exponentIt<='9' ){
+				// avoid overflows, strtod handles the saturation
+				if( explicitExponent<100000 ){
+					explicitExponent = explicitExponent*10 + (*exponentIt - '0');
+				}
+				++exponentIt;
+			}
+			exponent += negativeExponent ? -explicitExponent : explicitExponent;
+			it = exponentIt;
+		}
+	}
+	cursor = it;
+	// leading zeros are not accumulated, thus a zero mantissa is exact
+	if( mantissa==0 ){
+		value = negative ? -0.0 : 0.0;
+		return true;
+	}
+	// smaller mantissas are more likely to be exact
+	while( mantissa%10==0 ){
+		mantissa /= 10;
+		++exponent;
+	}
+	if( exact && mantissa<=kMaxExactMantissa
+		&& exponent>=-kMaxExactPow10 && exponent<=kMaxExactPow10 ){
+		// both operands are exact, a single correctly rounded operation
+		double absValue = static_cast<double>( mantissa );
+		if( exponent<0 ){
+			absValue /= kExactPowersOf10[-exponent];
+		}else{
+			absValue *= kExactPowersOf10[exponent];
+		}
+		value = negative ? -absValue : absValue;
+		return true;
+	}
+	StrtodFallback( begin, it, value );
+	return true;
+}
@@ -0,0 +1,32 @@
+/**
+ * @file number_parser.hpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * In place number parsing for raw text buffers (memory mapped files).
+ * Values are bit-identical to the ones obtained with atof/strtod:
+ * exact mantissas are resolved with a single correctly rounded operation
+ * and any other token falls back to strtod.
+ *
+ */
+
+#ifndef NUMBER_PARSER_H
+#define NUMBER_PARSER_H
+
+/**
+ * @brief Parses a double starting at cursor (leading blanks are skipped)
+ * @details cursor is moved to the first char after the number.
+ * The buffer does not need to be null terminated.
+ *
+ * @param cursor current position, updated
+ * @param end end of the buffer
+ * @param value parsed value
+ * @return true if a number was found
+ */
+bool ParseDouble( const char*& cursor, const char* end, double& value );
+
+#endif /* NUMBER_PARSER_H */
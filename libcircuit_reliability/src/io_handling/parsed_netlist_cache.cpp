@@ -0,0 +1,726 @@
+/**
+ * @file parsed_netlist_cache.cpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * ParsedNetlistCache Class Body
+ *
+ */
+
+// c++ std libraries
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <typeinfo>
+// posix
+#include <unistd.h>
+// Radiation simulator
+#include "parsed_netlist_cache.hpp"
+// constants
+#include "../global_functions_and_constants/global_template_functions.hpp"
+#include "../global_functions_and_constants/global_constants.hpp"
+#include "../global_functions_and_constants/statements_constants.hpp"
+#include "../global_functions_and_constants/files_folders_io_constants.hpp"
+
+ParsedNetlistCache::ParsedNetlistCache(){
+	this->log_io = nullptr;
+	this->cache_folder = "";
+}
+
+ParsedNetlistCache::~ParsedNetlistCache(){
+}
+
+bool ParsedNetlistCache::HashNetlist( const std::string& canonicalPath, uint64_t& contentHash ) const{
+	MappedFile netlist;
+	if( !netlist.Open( canonicalPath ) ){
+		return false;
+	}
+	contentHash = Hash( netlist.get_data(), netlist.get_size() );
+	return true;
+}
+
+std::string ParsedNetlistCache::GetCacheFilePath( const std::string& canonicalPath ) const{
+	std::ostringstream fileName;
+	fileName << std::hex << std::setw(16) << std::setfill('0')
+		<< Hash( canonicalPath.data(), canonicalPath.size() );
+	return cache_folder + kFolderSeparator + fileName.str() + kParsedNetlistCacheFileSufix;
+}
+
+uint64_t ParsedNetlistCache::Hash( const char* data, const std::size_t size ) const{
+	// FNV-1a
+	uint64_t hash = 14695981039346656037ULL;
+	for( std::size_t i=0; i<size; ++i ){
+		hash ^= static_cast<unsigned char>( data[i] );
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+bool ParsedNetlistCache::IsCacheableStatement( Statement* statement ) const{
+	// only the statements created by Statement::ParseStatement
+	switch( statement->statement_type ){
+		case kInstanceStatement: return typeid(*statement)==typeid(InstanceStatement);
+		case kModelStatement: return typeid(*statement)==typeid(ModelStatement);
+		case kAnalogModelStatement: return typeid(*statement)==typeid(AnalogModelStatement);
+		case kSubcircuitStatement: return typeid(*statement)==typeid(SubcircuitStatement);
+		case kAnalysisStatement: return typeid(*statement)==typeid(AnalysisStatement);
+		case kControlStatement: return typeid(*statement)==typeid(ControlStatement);
+		case kTransistorStatement: return typeid(*statement)==typeid(TransistorStatement);
+		case kUserDefinedFunctionStatement: return typeid(*statement)==typeid(UserDefinedFunctionStatement);
+		case kSimpleStatement: return typeid(*statement)==typeid(SimpleStatement);
+		case kConditionalStatement: return typeid(*statement)==typeid(ConditionalStatement);
+		case kIncludeStatement: return typeid(*statement)==typeid(IncludeStatement);
+		case kLibraryStatement: return typeid(*statement)==typeid(LibraryStatement);
+		case kSectionStatement: return typeid(*statement)==typeid(SectionStatement);
+		case kParamTestStatement: return typeid(*statement)==typeid(ParamTestStatement);
+		case kGlobalStatement: return typeid(*statement)==typeid(GlobalStatement);
+		default: return false;
+	}
+}
+
+Statement* ParsedNetlistCache::CreateStatement( const int statementType, CircuitStatement& circuit ) const{
+	// same constructors as Statement::ParseStatement, the scopes are restored afterwards
+	LogIO* circuitLogIO = circuit.get_log_io();
+	switch( statementType ){
+		case kInstanceStatement: return new InstanceStatement( &circuit, circuitLogIO, nullptr );
+		case kModelStatement: return new ModelStatement( &circuit, circuitLogIO, nullptr );
+		case kAnalogModelStatement: return new AnalogModelStatement( &circuit, circuitLogIO, nullptr );
+		case kSubcircuitStatement: {
+			SubcircuitStatement* subcircuit = new SubcircuitStatement( &circuit, circuitLogIO );
+			delete subcircuit->own_scope;
+			subcircuit->own_scope = nullptr;
+			subcircuit->belonging_scope = nullptr;
+			return subcircuit;
+		}
+		case kAnalysisStatement: return new AnalysisStatement( &circuit, circuitLogIO, nullptr );
+		case kControlStatement: return new ControlStatement( &circuit, circuitLogIO, nullptr, false );
+		case kTransistorStatement: return new TransistorStatement( &circuit, circuitLogIO, nullptr );
+		case kUserDefinedFunctionStatement: return new UserDefinedFunctionStatement( &circuit, circuitLogIO, nullptr );
+		case kSimpleStatement: return new SimpleStatement( &circuit, circuitLogIO, nullptr );
+		case kConditionalStatement: return new ConditionalStatement( &circuit, circuitLogIO, nullptr );
+		case kIncludeStatement: return new IncludeStatement( &circuit, circuitLogIO, nullptr );
+		case kLibraryStatement: return new LibraryStatement( &circuit, circuitLogIO, nullptr );
+		case kSectionStatement: return new SectionStatement( &circuit, circuitLogIO, nullptr );
+		case kParamTestStatement: return new ParamTestStatement( &circuit, circuitLogIO, nullptr );
+		case kGlobalStatement: return new GlobalStatement( &circuit, circuitLogIO, nullptr );
+		default: return nullptr;
+	}
+}
+
+bool ParsedNetlistCache::Store( const std::string& canonicalPath, const uint64_t contentHash,
+	const std::string& fingerprint, CircuitStatement& circuit,
+	PostParsingStatementHandler& statementsFound, const int statementCount ) const{
+	if( !get_enabled() ){
+		return false;
+	}
+	// preorder statements list
+	std::vector<Statement*> statements;
+	std::unordered_map<Statement*, int> statementIndexes;
+	std::vector<Statement*> pendingStatements = { &circuit };
+	while( !pendingStatements.empty() ){
+		Statement* statement = pendingStatements.back();
+		pendingStatements.pop_back();
+		if( statement==nullptr || !statementIndexes.emplace( statement, statements.size() ).second ){
+			return false;
+		}
+		if( statement!=&circuit && !IsCacheableStatement( statement ) ){
+			return false;
+		}
+		statements.push_back( statement );
+		pendingStatements.insert( pendingStatements.end(),
+			statement->children.rbegin(), statement->children.rend() );
+	}
+	// scopes and nodes
+	std::vector<Scope*> scopes;
+	std::unordered_map<Scope*, int> scopeIndexes;
+	std::unordered_map<Node*, int> nodeIndexes;
+	for( auto const &s : statements ){
+		if( s->statement_type==kCircuitStatement || s->statement_type==kSubcircuitStatement ){
+			if( !scopeIndexes.emplace( s->own_scope, scopes.size() ).second ){
+				return false;
+			}
+			scopes.push_back( s->own_scope );
+			for( auto const &n : *s->own_scope->get_nodes() ){
+				if( !nodeIndexes.emplace( n, nodeIndexes.size() ).second ){
+					return false;
+				}
+			}
+		}
+	}
+	if( !circuit.get_referenced_circuit_statements()->empty()
+		|| !circuit.get_simulation_special_children()->empty() ){
+		return false;
+	}
+	std::string buffer;
+	WriteString( buffer, kParsedNetlistCacheMagic );
+	WriteInt( buffer, kParsedNetlistCacheVersion );
+	WriteString( buffer, canonicalPath );
+	WriteInt( buffer, contentHash );
+	WriteInt( buffer, Hash( fingerprint.data(), fingerprint.size() ) );
+	WriteInt( buffer, statementCount );
+	WriteInt( buffer, statements.size() );
+	for( auto const &s : statements ){
+		WriteInt( buffer, s->statement_type );
+	}
+	WriteInt( buffer, scopes.size() );
+	for( auto const &sc : scopes ){
+		WriteString( buffer, sc->get_name() );
+		WriteString( buffer, sc->get_main_statement_name() );
+		WriteBool( buffer, sc->get_altered() );
+		WriteBool( buffer, sc->get_is_subcircuit_scope() );
+		WriteInt( buffer, sc->get_nodes()->size() );
+		for( auto const &n : *sc->get_nodes() ){
+			WriteString( buffer, n->get_name() );
+			WriteBool( buffer, n->get_injected() );
+			WriteBool( buffer, n->get_injectable() );
+			WriteBool( buffer, n->get_pin_in_subcircuit() );
+		}
+	}
+	for( auto const &s : statements ){
+		if( !WriteStatement( buffer, s, statementIndexes, scopeIndexes, nodeIndexes ) ){
+			return false;
+		}
+	}
+	// circuit lists
+	bool success = WriteStatementList( buffer, *circuit.get_referenced_include_statements(), statementIndexes )
+		&& WriteStatementList( buffer, *circuit.get_included_analysis_statements(), statementIndexes )
+		&& WriteStatementList( buffer, *circuit.get_included_analog_model_statements(), statementIndexes )
+		&& WriteStatementList( buffer, *circuit.get_included_conditional_statements(), statementIndexes )
+		&& WriteStatementList( buffer, *circuit.get_included_control_statements(), statementIndexes )
+		&& WriteStatementList( buffer, *circuit.get_included_global_statements(), statementIndexes )
+		&& WriteStatementList( buffer, *circuit.get_included_library_statements(), statementIndexes )
+		&& WriteStatementList( buffer, *circuit.get_included_model_statements(), statementIndexes )
+		&& WriteStatementList( buffer, *circuit.get_included_param_test_statements(), statementIndexes )
+		&& WriteStatementList( buffer, *circuit.get_included_instance_statements(), statementIndexes )
+		&& WriteStatementList( buffer, *circuit.get_included_section_statements(), statementIndexes )
+		&& WriteStatementList( buffer, *circuit.get_included_simple_statements(), statementIndexes )
+		&& WriteStatementList( buffer, *circuit.get_included_subcircuit_statements(), statementIndexes )
+		&& WriteStatementList( buffer, *circuit.get_included_transistor_statements(), statementIndexes )
+		&& WriteStatementList( buffer, *circuit.get_included_user_defined_function_statements(), statementIndexes )
+		// statements found
+		&& WriteStatementList( buffer, *statementsFound.get_primitive_statements_found(), statementIndexes )
+		&& WriteStatementList( buffer, *statementsFound.get_analog_model_statements_found(), statementIndexes )
+		&& WriteStatementList( buffer, *statementsFound.get_model_statements_found(), statementIndexes )
+		&& WriteStatementList( buffer, *statementsFound.get_instance_statements_found(), statementIndexes )
+		&& WriteStatementList( buffer, *statementsFound.get_transistor_statements_found(), statementIndexes )
+		&& WriteStatementList( buffer, *statementsFound.get_subcircuit_statements_found(), statementIndexes )
+		&& WriteStatementList( buffer, *statementsFound.get_analysis_statements_found(), statementIndexes );
+	if( !success ){
+		return false;
+	}
+	// deferred global nodes
+	WriteInt( buffer, circuit.get_deferred_global_nodes()->size() );
+	for( auto const &n : *circuit.get_deferred_global_nodes() ){
+		auto it = nodeIndexes.find( n );
+		if( it==nodeIndexes.end() ){
+			return false;
+		}
+		WriteInt( buffer, it->second );
+	}
+	// written in a temporary file and renamed, concurrent experiments may share the cache
+	std::string cacheFilePath = GetCacheFilePath( canonicalPath );
+	std::string tmpFilePath = cacheFilePath + "." + number2String( getpid() ) + ".tmp";
+	std::ofstream cacheFile( tmpFilePath, std::ios::binary | std::ios::trunc );
+	if( !cacheFile.is_open() ){
+		return false;
+	}
+	cacheFile.write( buffer.data(), buffer.size() );
+	cacheFile.close();
+	if( cacheFile.fail() || std::rename( tmpFilePath.c_str(), cacheFilePath.c_str() )!=0 ){
+		std::remove( tmpFilePath.c_str() );
+		return false;
+	}
+	return true;
+}
+
+bool ParsedNetlistCache::WriteStatement( std::string& buffer, Statement* statement,
+	const std::unordered_map<Statement*, int>& statementIndexes,
+	const std::unordered_map<Scope*, int>& scopeIndexes,
+	const std::unordered_map<Node*, int>& nodeIndexes ) const{
+	auto statementIndex = [&statementIndexes]( Statement* s ) -> int {
+		auto it = statementIndexes.find( s );
+		return it==statementIndexes.end() ? -1 : it->second;
+	};
+	auto scopeIndex = [&scopeIndexes]( Scope* sc ) -> int {
+		auto it = scopeIndexes.find( sc );
+		return it==scopeIndexes.end() ? -1 : it->second;
+	};
+	// Statement Properties
+	WriteInt( buffer, statement->id );
+	WriteBool( buffer, statement->mute_exportation );
+	WriteBool( buffer, statement->has_parallel_statements );
+	WriteString( buffer, statement->parallel_statements );
+	WriteBool( buffer, statement->correctly_parsed );
+	WriteBool( buffer, statement->has_brackets );
+	WriteBool( buffer, statement->has_nodes );
+	WriteBool( buffer, statement->has_children );
+	WriteBool( buffer, statement->has_parameters );
+	WriteBool( buffer, statement->has_raw_content );
+	WriteString( buffer, statement->master_name );
+	WriteString( buffer, statement->statement_type_description );
+	WriteString( buffer, statement->name );
+	WriteString( buffer, statement->description );
+	WriteString( buffer, statement->raw_content );
+	WriteString( buffer, statement->path_to_belonging_circuit );
+	WriteString( buffer, statement->formal_path_to_belonging_circuit );
+	// Dependency Managing
+	WriteBool( buffer, statement->scanned_for_instances_dependency );
+	WriteBool( buffer, statement->consider_instances_dependency );
+	// Radiation Properties
+	WriteBool( buffer, statement->unalterable );
+	WriteBool( buffer, statement->altered );
+	WriteBool( buffer, statement->can_be_injected );
+	WriteBool( buffer, statement->can_be_substituted );
+	WriteString( buffer, statement->substitute_master_name );
+	// references
+	int belongingCircuitIndex = statementIndex( statement->belonging_circuit );
+	int parentIndex = statementIndex( statement->parent );
+	int globalScopeParentIndex = statementIndex( statement->global_scope_parent );
+	int belongingScopeIndex = scopeIndex( statement->belonging_scope );
+	if( belongingCircuitIndex!=0 || parentIndex<0 || globalScopeParentIndex<0 || belongingScopeIndex<0 ){
+		return false;
+	}
+	WriteInt( buffer, parentIndex );
+	WriteInt( buffer, globalScopeParentIndex );
+	WriteInt( buffer, belongingScopeIndex );
+	if( statement->statement_type==kCircuitStatement || statement->statement_type==kSubcircuitStatement ){
+		WriteInt( buffer, scopeIndex( statement->own_scope ) );
+	}
+	WriteInt( buffer, statement->nodes.size() );
+	for( auto const &n : statement->nodes ){
+		auto it = nodeIndexes.find( n );
+		if( it==nodeIndexes.end() ){
+			return false;
+		}
+		WriteInt( buffer, it->second );
+	}
+	WriteInt( buffer, statement->parameters.size() );
+	for( auto const &p : statement->parameters ){
+		WriteString( buffer, p->get_name() );
+		WriteString( buffer, p->get_value() );
+		WriteBool( buffer, p->get_has_value() );
+	}
+	WriteInt( buffer, statement->children.size() );
+	for( auto const &c : statement->children ){
+		WriteInt( buffer, statementIndex( c ) );
+	}
+	// Specific properties
+	switch( statement->statement_type ){
+		case kInstanceStatement:
+		case kTransistorStatement:
+			WriteBool( buffer, static_cast<InstanceStatement*>(statement)->get_is_a_primitive_instance() );
+			break;
+		case kModelStatement:
+			WriteBool( buffer, static_cast<ModelStatement*>(statement)->get_is_a_primitive_model() );
+			break;
+		case kAnalogModelStatement:
+			WriteBool( buffer, static_cast<AnalogModelStatement*>(statement)->get_is_a_primitive_model() );
+			break;
+		case kSubcircuitStatement:
+			WriteBool( buffer, static_cast<SubcircuitStatement*>(statement)->get_is_inline() );
+			break;
+		case kAnalysisStatement: {
+			AnalysisStatement* analysis = static_cast<AnalysisStatement*>(statement);
+			WriteBool( buffer, analysis->get_advanced_analysis() );
+			WriteBool( buffer, analysis->get_essential_analysis() );
+			WriteBool( buffer, analysis->get_main_transient() );
+			break;
+		}
+		case kControlStatement: {
+			ControlStatement* control = static_cast<ControlStatement*>(statement);
+			WriteBool( buffer, control->get_advanced_control_statement() );
+			WriteBool( buffer, control->get_special_syntax_control_statement() );
+			WriteBool( buffer, control->get_param_set_case() );
+			break;
+		}
+		case kSimpleStatement:
+			WriteBool( buffer, static_cast<SimpleStatement*>(statement)->get_allows_mute() );
+			break;
+		case kConditionalStatement: {
+			ConditionalStatement* conditional = static_cast<ConditionalStatement*>(statement);
+			WriteInt( buffer, conditional->get_conditional_statement_type() );
+			WriteString( buffer, conditional->get_condition() );
+			break;
+		}
+		case kIncludeStatement: {
+			IncludeStatement* include = static_cast<IncludeStatement*>(statement);
+			WriteBool( buffer, include->get_scanned() );
+			WriteBool( buffer, include->get_has_section() );
+			WriteInt( buffer, include->get_include_statement_type() );
+			WriteString( buffer, include->get_section() );
+			WriteString( buffer, include->get_refered_circuit_id() );
+			WriteBool( buffer, include->get_export_canonical_path() );
+			break;
+		}
+		default:
+			break;
+	}
+	return true;
+}
+
+bool ParsedNetlistCache::Load( const std::string& canonicalPath, const uint64_t contentHash,
+	const std::string& fingerprint, CircuitStatement& circuit,
+	PostParsingStatementHandler& statementsFound, int& statementCount ) const{
+	if( !get_enabled() ){
+		return false;
+	}
+	MappedFile cacheFile;
+	if( !cacheFile.Open( GetCacheFilePath( canonicalPath ) ) ){
+		return false;
+	}
+	CacheReader reader = { cacheFile.get_data(), cacheFile.get_end(), true };
+	// header
+	if( ReadString( reader ).compare( kParsedNetlistCacheMagic )!=0
+		|| ReadInt( reader )!=kParsedNetlistCacheVersion
+		|| ReadString( reader ).compare( canonicalPath )!=0
+		|| (uint64_t)ReadInt( reader )!=contentHash
+		|| (uint64_t)ReadInt( reader )!=Hash( fingerprint.data(), fingerprint.size() )
+		|| !reader.good ){
+		return false;
+	}
+	int cachedStatementCount = ReadInt( reader );
+	// statements, created before restoring the references
+	std::size_t statementsSize = ReadIndex( reader, reader.end - reader.position );
+	if( !reader.good || statementsSize==0 || ReadInt( reader )!=kCircuitStatement ){
+		return false;
+	}
+	std::vector<Statement*> statements = { &circuit };
+	for( std::size_t i=1; reader.good && i<statementsSize; ++i ){
+		Statement* statement = CreateStatement( ReadInt( reader ), circuit );
+		if( statement==nullptr ){
+			reader.good = false;
+		}else{
+			statements.push_back( statement );
+		}
+	}
+	// scopes and nodes
+	std::vector<Scope*> scopes;
+	std::vector<Node*> nodes;
+	std::size_t scopesSize = ReadIndex( reader, reader.end - reader.position );
+	for( std::size_t i=0; reader.good && i<scopesSize; ++i ){
+		std::string scopeName = ReadString( reader );
+		std::string mainStatementName = ReadString( reader );
+		bool altered = ReadBool( reader );
+		Scope* scope = new Scope( scopeName, mainStatementName, ReadBool( reader ) );
+		scope->set_altered( altered );
+		scopes.push_back( scope );
+		std::size_t nodesSize = ReadIndex( reader, reader.end - reader.position );
+		for( std::size_t j=0; reader.good && j<nodesSize; ++j ){
+			std::string nodeName = ReadString( reader );
+			bool injected = ReadBool( reader );
+			bool injectable = ReadBool( reader );
+			Node* node = new Node( nodeName, injectable, ReadBool( reader ) );
+			node->set_injected( injected );
+			scope->AddNode( node );
+			nodes.push_back( node );
+		}
+	}
+	Scope* circuitScope = circuit.own_scope;
+	for( std::size_t i=0; reader.good && i<statements.size(); ++i ){
+		reader.good = ReadStatement( reader, statements.at(i), statements, scopes, nodes );
+	}
+	// circuit lists (the circuit is discarded if the restoration fails)
+	PostParsingStatementHandler cachedStatementsFound;
+	bool success = reader.good
+		&& ReadStatementList( reader, *circuit.get_referenced_include_statements(), statements )
+		&& ReadStatementList( reader, *circuit.get_included_analysis_statements(), statements )
+		&& ReadStatementList( reader, *circuit.get_included_analog_model_statements(), statements )
+		&& ReadStatementList( reader, *circuit.get_included_conditional_statements(), statements )
+		&& ReadStatementList( reader, *circuit.get_included_control_statements(), statements )
+		&& ReadStatementList( reader, *circuit.get_included_global_statements(), statements )
+		&& ReadStatementList( reader, *circuit.get_included_library_statements(), statements )
+		&& ReadStatementList( reader, *circuit.get_included_model_statements(), statements )
+		&& ReadStatementList( reader, *circuit.get_included_param_test_statements(), statements )
+		&& ReadStatementList( reader, *circuit.get_included_instance_statements(), statements )
+		&& ReadStatementList( reader, *circuit.get_included_section_statements(), statements )
+		&& ReadStatementList( reader, *circuit.get_included_simple_statements(), statements )
+		&& ReadStatementList( reader, *circuit.get_included_subcircuit_statements(), statements )
+		&& ReadStatementList( reader, *circuit.get_included_transistor_statements(), statements )
+		&& ReadStatementList( reader, *circuit.get_included_user_defined_function_statements(), statements )
+		// statements found
+		&& ReadStatementList( reader, *cachedStatementsFound.get_primitive_statements_found(), statements )
+		&& ReadStatementList( reader, *cachedStatementsFound.get_analog_model_statements_found(), statements )
+		&& ReadStatementList( reader, *cachedStatementsFound.get_model_statements_found(), statements )
+		&& ReadStatementList( reader, *cachedStatementsFound.get_instance_statements_found(), statements )
+		&& ReadStatementList( reader, *cachedStatementsFound.get_transistor_statements_found(), statements )
+		&& ReadStatementList( reader, *cachedStatementsFound.get_subcircuit_statements_found(), statements )
+		&& ReadStatementList( reader, *cachedStatementsFound.get_analysis_statements_found(), statements );
+	std::vector<Node*> deferredGlobalNodes;
+	std::size_t deferredGlobalNodesSize = ReadIndex( reader, reader.end - reader.position );
+	for( std::size_t i=0; success && reader.good && i<deferredGlobalNodesSize; ++i ){
+		int nodeIndex = ReadIndex( reader, nodes.size() );
+		if( nodeIndex>=0 ){
+			deferredGlobalNodes.push_back( nodes.at(nodeIndex) );
+		}
+	}
+	// every scope has to be owned by one statement, and every statement has to be in the tree once
+	std::unordered_map<Scope*, int> scopeOwners;
+	std::unordered_map<Statement*, int> statementParents;
+	for( auto const &s : statements ){
+		if( s->statement_type==kCircuitStatement || s->statement_type==kSubcircuitStatement ){
+			++scopeOwners[s->own_scope];
+		}
+		for( auto const &c : s->children ){
+			++statementParents[c];
+		}
+	}
+	success = success && scopeOwners.size()==scopes.size()
+		&& statementParents.size()==statements.size()-1;
+	for( auto const &sc : scopes ){
+		success = success && scopeOwners[sc]==1;
+	}
+	for( auto const &sp : statementParents ){
+		success = success && sp.second==1;
+	}
+	if( !success || !reader.good || reader.position!=reader.end ){
+		// unlink and discard the restored statements
+		for( auto const &s : statements ){
+			s->children.clear();
+		}
+		for( std::size_t i=1; i<statements.size(); ++i ){
+			delete statements.at(i);
+		}
+		circuit.own_scope = circuitScope;
+		circuit.belonging_scope = circuitScope;
+		circuit.nodes.clear();
+		deleteContentsOfVectorOfPointers( scopes );
+		return false;
+	}
+	delete circuitScope;
+	statementsFound.AppendStatementsFound( cachedStatementsFound );
+	for( auto const &n : deferredGlobalNodes ){
+		circuit.AddGlobalNode( n );
+	}
+	statementCount = cachedStatementCount;
+	return true;
+}
+
+bool ParsedNetlistCache::ReadStatement( CacheReader& reader, Statement* statement,
+	const std::vector<Statement*>& statements, const std::vector<Scope*>& scopes,
+	const std::vector<Node*>& nodes ) const{
+	// Statement Properties
+	statement->id = ReadInt( reader );
+	statement->mute_exportation = ReadBool( reader );
+	statement->has_parallel_statements = ReadBool( reader );
+	statement->parallel_statements = ReadString( reader );
+	statement->correctly_parsed = ReadBool( reader );
+	statement->has_brackets = ReadBool( reader );
+	statement->has_nodes = ReadBool( reader );
+	statement->has_children = ReadBool( reader );
+	statement->has_parameters = ReadBool( reader );
+	statement->has_raw_content = ReadBool( reader );
+	statement->master_name = ReadString( reader );
+	statement->statement_type_description = ReadString( reader );
+	statement->name = ReadString( reader );
+	statement->description = ReadString( reader );
+	statement->raw_content = ReadString( reader );
+	statement->path_to_belonging_circuit = ReadString( reader );
+	statement->formal_path_to_belonging_circuit = ReadString( reader );
+	// Dependency Managing
+	statement->scanned_for_instances_dependency = ReadBool( reader );
+	statement->consider_instances_dependency = ReadBool( reader );
+	// Radiation Properties
+	statement->unalterable = ReadBool( reader );
+	statement->altered = ReadBool( reader );
+	statement->can_be_injected = ReadBool( reader );
+	statement->can_be_substituted = ReadBool( reader );
+	statement->substitute_master_name = ReadString( reader );
+	// references
+	int parentIndex = ReadIndex( reader, statements.size() );
+	int globalScopeParentIndex = ReadIndex( reader, statements.size() );
+	int belongingScopeIndex = ReadIndex( reader, scopes.size() );
+	if( !reader.good || parentIndex<0 || globalScopeParentIndex<0 || belongingScopeIndex<0 ){
+		return false;
+	}
+	statement->parent = statements.at( parentIndex );
+	statement->global_scope_parent = statements.at( globalScopeParentIndex );
+	statement->belonging_scope = scopes.at( belongingScopeIndex );
+	if( statement->statement_type==kCircuitStatement || statement->statement_type==kSubcircuitStatement ){
+		int ownScopeIndex = ReadIndex( reader, scopes.size() );
+		if( ownScopeIndex<0 ){
+			return false;
+		}
+		statement->own_scope = scopes.at( ownScopeIndex );
+	}
+	std::size_t nodesSize = ReadIndex( reader, reader.end - reader.position );
+	for( std::size_t i=0; reader.good && i<nodesSize; ++i ){
+		int nodeIndex = ReadIndex( reader, nodes.size() );
+		if( nodeIndex>=0 ){
+			statement->nodes.push_back( nodes.at( nodeIndex ) );
+		}
+	}
+	std::size_t parametersSize = ReadIndex( reader, reader.end - reader.position );
+	for( std::size_t i=0; reader.good && i<parametersSize; ++i ){
+		std::string parameterName = ReadString( reader );
+		std::string parameterValue = ReadString( reader );
+		Parameter* parameter = new Parameter( parameterName, parameterValue );
+		parameter->set_has_value( ReadBool( reader ) );
+		statement->parameters.push_back( parameter );
+	}
+	std::size_t childrenSize = ReadIndex( reader, reader.end - reader.position );
+	for( std::size_t i=0; reader.good && i<childrenSize; ++i ){
+		int childIndex = ReadIndex( reader, statements.size() );
+		if( childIndex<=0 ){
+			return false;
+		}
+		statement->children.push_back( statements.at( childIndex ) );
+	}
+	// Specific properties
+	switch( statement->statement_type ){
+		case kInstanceStatement:
+		case kTransistorStatement: {
+			InstanceStatement* instance = static_cast<InstanceStatement*>(statement);
+			instance->set_is_a_primitive_instance( ReadBool( reader ) );
+			if( instance->get_is_a_primitive_instance() ){
+				instance->dependency_parent = instance;
+			}
+			break;
+		}
+		case kModelStatement: {
+			ModelStatement* model = static_cast<ModelStatement*>(statement);
+			model->set_is_a_primitive_model( ReadBool( reader ) );
+			if( model->get_is_a_primitive_model() ){
+				model->dependency_parent = model;
+			}
+			break;
+		}
+		case kAnalogModelStatement: {
+			AnalogModelStatement* analogModel = static_cast<AnalogModelStatement*>(statement);
+			analogModel->set_is_a_primitive_model( ReadBool( reader ) );
+			if( analogModel->get_is_a_primitive_model() ){
+				analogModel->dependency_parent = analogModel;
+			}
+			break;
+		}
+		case kSubcircuitStatement:
+			static_cast<SubcircuitStatement*>(statement)->set_is_inline( ReadBool( reader ) );
+			break;
+		case kAnalysisStatement: {
+			AnalysisStatement* analysis = static_cast<AnalysisStatement*>(statement);
+			analysis->set_advanced_analysis( ReadBool( reader ) );
+			analysis->set_essential_analysis( ReadBool( reader ) );
+			analysis->set_main_transient( ReadBool( reader ) );
+			break;
+		}
+		case kControlStatement: {
+			ControlStatement* control = static_cast<ControlStatement*>(statement);
+			control->set_advanced_control_statement( ReadBool( reader ) );
+			control->set_special_syntax_control_statement( ReadBool( reader ) );
+			control->set_param_set_case( ReadBool( reader ) );
+			break;
+		}
+		case kSimpleStatement:
+			static_cast<SimpleStatement*>(statement)->set_allows_mute( ReadBool( reader ) );
+			break;
+		case kConditionalStatement: {
+			ConditionalStatement* conditional = static_cast<ConditionalStatement*>(statement);
+			conditional->set_conditional_statement_type( ReadInt( reader ) );
+			conditional->set_condition( ReadString( reader ) );
+			break;
+		}
+		case kIncludeStatement: {
+			IncludeStatement* include = static_cast<IncludeStatement*>(statement);
+			include->set_scanned( ReadBool( reader ) );
+			include->set_has_section( ReadBool( reader ) );
+			include->set_include_statement_type( ReadInt( reader ) );
+			include->set_section( ReadString( reader ) );
+			include->set_refered_circuit_id( ReadString( reader ) );
+			include->set_export_canonical_path( ReadBool( reader ) );
+			break;
+		}
+		default:
+			break;
+	}
+	return reader.good;
+}
+
+template <typename T> bool ParsedNetlistCache::WriteStatementList( std::string& buffer,
+	const std::vector<T*>& list, const std::unordered_map<Statement*, int>& statementIndexes ) const{
+	WriteInt( buffer, list.size() );
+	for( auto const &s : list ){
+		auto it = statementIndexes.find( s );
+		if( it==statementIndexes.end() ){
+			return false;
+		}
+		WriteInt( buffer, it->second );
+	}
+	return true;
+}
+
+template <typename T> bool ParsedNetlistCache::ReadStatementList( CacheReader& reader,
+	std::vector<T*>& list, const std::vector<Statement*>& statements ) const{
+	std::size_t listSize = ReadIndex( reader, reader.end - reader.position );
+	for( std::size_t i=0; reader.good && i<listSize; ++i ){
+		int statementIndex = ReadIndex( reader, statements.size() );
+		T* statement = statementIndex<0 ? nullptr : dynamic_cast<T*>( statements.at( statementIndex ) );
+		if( statement==nullptr ){
+			return false;
+		}
+		list.push_back( statement );
+	}
+	return reader.good;
+}
+
+void ParsedNetlistCache::WriteInt( std::string& buffer, const int64_t value ) const{
+	uint64_t v = static_cast<uint64_t>( value );
+	for( int i=0; i<8; ++i ){
+		buffer.push_back( static_cast<char>( v & 0xff ) );
+		v >>= 8;
+	}
+}
+
+void ParsedNetlistCache::WriteBool( std::string& buffer, const bool value ) const{
+	buffer.push_back( value ? 1 : 0 );
+}
+
+void ParsedNetlistCache::WriteString( std::string& buffer, const std::string& value ) const{
+	WriteInt( buffer, value.size() );
+	buffer.append( value );
+}
+
+int64_t ParsedNetlistCache::ReadInt( CacheReader& reader ) const{
+	if( !reader.good || reader.end - reader.position < 8 ){
+		reader.good = false;
+		return 0;
+	}
+	uint64_t v = 0;
+	for( int i=7; i>=0; --i ){
+		v = ( v << 8 ) | static_cast<unsigned char>( reader.position[i] );
+	}
+	reader.position += 8;
+	return static_cast<int64_t>( v );
+}
+
+bool ParsedNetlistCache::ReadBool( CacheReader& reader ) const{
+	if( !reader.good || reader.position==reader.end ){
+		reader.good = false;
+		return false;
+	}
+	return *reader.position++ != 0;
+}
+
+std::string ParsedNetlistCache::ReadString( CacheReader& reader ) const{
+	int64_t size = ReadInt( reader );
+	if( !reader.good || size<0 || size > reader.end - reader.position ){
+		reader.good = false;
+		return "";
+	}
+	std::string value( reader.position, size );
+	reader.position += size;
+	return value;
+}
+
+int ParsedNetlistCache::ReadIndex( CacheReader& reader, const std::size_t size ) const{
+	int64_t index = ReadInt( reader );
+	if( !reader.good || index<0 || (uint64_t)index>=size ){
+		reader.good = false;
+		return -1;
+	}
+	return index;
+}
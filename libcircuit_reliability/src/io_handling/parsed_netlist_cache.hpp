@@ -0,0 +1,131 @@
+/**
+ * @file parsed_netlist_cache.hpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * Persistent cache of the parsed included netlists (technology models, sections...).
+ * The statements tree of each netlist is stored in a binary file, keyed by:
+ * 		+ canonical path of the netlist
+ * 		+ content hash of the netlist
+ * 		+ parser version and environment fingerprint (ExperimentEnvironment::GetParsingFingerprint)
+ * Pointers (parent, scopes, nodes...) are stored as indexes of the preorder statements list.
+ * Netlists with statements not created by the parser are not cached.
+ *
+ */
+
+#ifndef PARSED_NETLIST_CACHE_H
+#define PARSED_NETLIST_CACHE_H
+
+// c++ std libraries
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <unordered_map>
+// radiation simulator io includes
+#include "log_io.hpp"
+#include "mapped_file.hpp"
+// radiation simulator includes
+#include "../post_parsing_statement_handler.hpp"
+#include "../netlist_modeling/statements/circuit_statement.hpp"
+
+class ParsedNetlistCache {
+public:
+	/// Default constructor
+	ParsedNetlistCache();
+	/// Default destructor
+	virtual ~ParsedNetlistCache();
+
+	/// Sets the log manager
+	void set_log_io( LogIO* log_io ){ this->log_io = log_io; }
+	/// Sets the cache folder, empty: cache disabled
+	void set_cache_folder( const std::string& cache_folder ) { this->cache_folder = cache_folder; }
+	std::string get_cache_folder() const { return cache_folder; }
+	bool get_enabled() const { return !cache_folder.empty(); }
+
+	/**
+	 * @brief Hashes the content of a netlist
+	 *
+	 * @param canonicalPath
+	 * @param contentHash
+	 * @return false if the netlist cannot be read
+	 */
+	bool HashNetlist( const std::string& canonicalPath, uint64_t& contentHash ) const;
+
+	/**
+	 * @brief Restores a parsed netlist
+	 * @details The circuit has to be empty (just created).
+	 * If the restoration fails, the circuit can be partially restored and has to be discarded.
+	 *
+	 * @param canonicalPath
+	 * @param contentHash
+	 * @param fingerprint environment fingerprint
+	 * @param circuit restored circuit
+	 * @param statementsFound statements registered while parsing the netlist
+	 * @param statementCount number of statements parsed
+	 * @return true if the netlist has been restored
+	 */
+	bool Load( const std::string& canonicalPath, const uint64_t contentHash,
+		const std::string& fingerprint, CircuitStatement& circuit,
+		PostParsingStatementHandler& statementsFound, int& statementCount ) const;
+
+	/**
+	 * @brief Stores a parsed netlist
+	 * @details Has to be called right after parsing the netlist (statement ids starting at 0)
+	 *
+	 * @param canonicalPath
+	 * @param contentHash
+	 * @param fingerprint environment fingerprint
+	 * @param circuit parsed circuit
+	 * @param statementsFound statements registered while parsing the netlist
+	 * @param statementCount number of statements parsed
+	 * @return true if the netlist has been stored
+	 */
+	bool Store( const std::string& canonicalPath, const uint64_t contentHash,
+		const std::string& fingerprint, CircuitStatement& circuit,
+		PostParsingStatementHandler& statementsFound, const int statementCount ) const;
+
+private:
+	/// Sequential reader of a cache file
+	struct CacheReader {
+		const char* position;
+		const char* end;
+		bool good;
+	};
+
+	/// Log manager.
+	LogIO* log_io;
+	/// Cache folder
+	std::string cache_folder;
+
+	std::string GetCacheFilePath( const std::string& canonicalPath ) const;
+	uint64_t Hash( const char* data, const std::size_t size ) const;
+
+	bool IsCacheableStatement( Statement* statement ) const;
+	Statement* CreateStatement( const int statementType, CircuitStatement& circuit ) const;
+	bool WriteStatement( std::string& buffer, Statement* statement,
+		const std::unordered_map<Statement*, int>& statementIndexes,
+		const std::unordered_map<Scope*, int>& scopeIndexes,
+		const std::unordered_map<Node*, int>& nodeIndexes ) const;
+	bool ReadStatement( CacheReader& reader, Statement* statement,
+		const std::vector<Statement*>& statements, const std::vector<Scope*>& scopes,
+		const std::vector<Node*>& nodes ) const;
+
+	template <typename T> bool WriteStatementList( std::string& buffer,
+		const std::vector<T*>& list, const std::unordered_map<Statement*, int>& statementIndexes ) const;
+	template <typename T> bool ReadStatementList( CacheReader& reader,
+		std::vector<T*>& list, const std::vector<Statement*>& statements ) const;
+
+	void WriteInt( std::string& buffer, const int64_t value ) const;
+	void WriteBool( std::string& buffer, const bool value ) const;
+	void WriteString( std::string& buffer, const std::string& value ) const;
+	int64_t ReadInt( CacheReader& reader ) const;
+	bool ReadBool( CacheReader& reader ) const;
+	std::string ReadString( CacheReader& reader ) const;
+	int ReadIndex( CacheReader& reader, const std::size_t size ) const;
+};
+
+#endif /* PARSED_NETLIST_CACHE_H */
@@ -0,0 +1,210 @@
+/**
+ * @file processed_results_file.cpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * ProcessedResultsFile Class Body
+ *
+ */
+
+// c++ std libraries
+#include <fstream>
+#include <cstring>
+#include <cstdint>
+// Radiation simulator
+#include "processed_results_file.hpp"
+// constants
+#include "../global_functions_and_constants/global_constants.hpp"
+#include "../global_functions_and_constants/global_template_functions.hpp"
+#include "../global_functions_and_constants/files_folders_io_constants.hpp"
+
+// binary format
+static const char kBinaryMagic[8] = { 'C', 'R', 'F', 'C', 'O', 'L', 'S', '\n' };
+static const uint32_t kBinaryVersion = 1;
+static const uint64_t kBinaryColumnAlignment = 64;
+static const uint32_t kBinaryTransientFlag = 1;
+static const uint32_t kBinaryFoundFlag = 2;
+
+struct binary_header_t {
+	char magic[8];
+	uint32_t version;
+	uint32_t columns_count;
+	uint64_t points_count;
+};
+
+struct binary_column_t {
+	uint64_t data_offset;
+	uint64_t name_offset;
+	uint32_t name_size;
+	uint32_t values_size;
+	uint32_t flags;
+	uint32_t padding;
+};
+
+ProcessedResultsFile::ProcessedResultsFile(){
+	this->points_count = 0;
+}
+
+ProcessedResultsFile::~ProcessedResultsFile(){
+}
+
+bool ProcessedResultsFile::ExportText( const std::string& path, const int format,
+	const std::vector<column_t>& columns, const uint64_t pointsCount ){
+	if( format!=kMatlab && format!=kGnuPlot && format!=kCSV ){
+		return false;
+	}
+	std::ofstream outputFile;
+	outputFile.open(path.c_str());
+	outputFile.setf(std::ios::scientific);
+	if (!outputFile){
+		return false;
+	}
+	// headers
+	std::string commentMark = format==kMatlab ? "%" : "#";
+	std::string mDelimiter = format==kCSV ? ";" : " ";
+	std::string m_names = format==kCSV ? "" : commentMark;
+	if( format!=kGnuPlot ){
+		outputFile << commentMark << "Metric Lengths:" << kEmptyLine;
+	}
+	for( auto const& c : columns ){
+		if( c.transient ){
+			outputFile << commentMark << mDelimiter << c.name <<  mDelimiter << c.values_size << kEmptyLine;
+		}else{
+			outputFile << commentMark << mDelimiter << c.name << kEmptyLine;
+		}
+		m_names += c.name + mDelimiter;
+	}
+	outputFile << m_names << kEmptyLine;
+	// rows, ocean eval metrics are repeated in every row
+	for (uint64_t i=0; i<pointsCount; ++i){
+		for( auto const& c : columns ){
+			if( c.values!=nullptr ){
+				outputFile << c.values[c.transient ? i : 0] << mDelimiter;
+			}else{
+				outputFile << "notFound" << mDelimiter;
+			}
+		}
+		outputFile << "\n";
+	}
+	outputFile.close();
+	return !outputFile.fail();
+}
+
+bool ProcessedResultsFile::ExportBinary( const std::string& path,
+	const std::vector<column_t>& columns, const uint64_t pointsCount ){
+	binary_header_t header;
+	std::memcpy( header.magic, kBinaryMagic, sizeof(header.magic) );
+	header.version = kBinaryVersion;
+	header.columns_count = columns.size();
+	header.points_count = pointsCount;
+	// layout: header, columns, names, aligned data
+	std::vector<binary_column_t> binaryColumns( columns.size() );
+	uint64_t offset = sizeof(binary_header_t) + columns.size()*sizeof(binary_column_t);
+	for( unsigned int c=0; c<columns.size(); ++c ){
+		binaryColumns[c].name_offset = offset;
+		binaryColumns[c].name_size = columns[c].name.size();
+		offset += columns[c].name.size();
+	}
+	for( unsigned int c=0; c<columns.size(); ++c ){
+		binary_column_t& bc = binaryColumns[c];
+		bc.values_size = columns[c].values_size;
+		bc.flags = ( columns[c].transient ? kBinaryTransientFlag : 0 )
+			| ( columns[c].values!=nullptr ? kBinaryFoundFlag : 0 );
+		bc.padding = 0;
+		bc.data_offset = 0;
+		if( columns[c].values!=nullptr ){
+			offset = ( offset + kBinaryColumnAlignment - 1 )/kBinaryColumnAlignment*kBinaryColumnAlignment;
+			bc.data_offset = offset;
+			offset += ( columns[c].transient ? pointsCount : 1 )*sizeof(double);
+		}
+	}
+	std::ofstream outputFile( path.c_str(), std::ios::binary );
+	if (!outputFile){
+		return false;
+	}
+	outputFile.write( reinterpret_cast<const char*>(&header), sizeof(header) );
+	outputFile.write( reinterpret_cast<const char*>(binaryColumns.data()),
+		binaryColumns.size()*sizeof(binary_column_t) );
+	uint64_t written = sizeof(binary_header_t) + columns.size()*sizeof(binary_column_t);
+	for( auto const& c : columns ){
+		outputFile.write( c.name.data(), c.name.size() );
+		written += c.name.size();
+	}
+	const char padding[kBinaryColumnAlignment] = {};
+	for( unsigned int c=0; c<columns.size(); ++c ){
+		if( columns[c].values!=nullptr ){
+			outputFile.write( padding, binaryColumns[c].data_offset - written );
+			const uint64_t columnSize = ( columns[c].transient ? pointsCount : 1 )*sizeof(double);
+			outputFile.write( reinterpret_cast<const char*>(columns[c].values), columnSize );
+			written = binaryColumns[c].data_offset + columnSize;
+		}
+	}
+	outputFile.close();
+	return !outputFile.fail();
+}
+
+bool ProcessedResultsFile::Open( const std::string& path ){
+	Close();
+	if( !mapped_file.Open( path ) ){
+		return false;
+	}
+	const uint64_t fileSize = mapped_file.get_size();
+	binary_header_t header;
+	if( fileSize<sizeof(header) ){
+		Close();
+		return false;
+	}
+	std::memcpy( &header, mapped_file.get_data(), sizeof(header) );
+	// bounded counts, the column sizes below can not wrap around
+	if( std::memcmp( header.magic, kBinaryMagic, sizeof(header.magic) )!=0
+		|| header.version!=kBinaryVersion
+		|| header.points_count>fileSize/sizeof(double)
+		|| fileSize<sizeof(header) + static_cast<uint64_t>(header.columns_count)*sizeof(binary_column_t) ){
+		Close();
+		return false;
+	}
+	points_count = header.points_count;
+	columns.reserve( header.columns_count );
+	for( unsigned int c=0; c<header.columns_count; ++c ){
+		binary_column_t bc;
+		std::memcpy( &bc, mapped_file.get_data() + sizeof(header) + c*sizeof(binary_column_t), sizeof(bc) );
+		column_t column;
+		column.transient = ( bc.flags & kBinaryTransientFlag )!=0;
+		column.values_size = bc.values_size;
+		column.values = nullptr;
+		const uint64_t columnSize = ( column.transient ? header.points_count : 1 )*sizeof(double);
+		if( bc.name_offset>fileSize || bc.name_size>fileSize - bc.name_offset
+			|| ( ( bc.flags & kBinaryFoundFlag )!=0 && ( bc.data_offset%sizeof(double)!=0
+				|| bc.data_offset>fileSize || columnSize>fileSize - bc.data_offset ) ) ){
+			Close();
+			return false;
+		}
+		column.name.assign( mapped_file.get_data() + bc.name_offset, bc.name_size );
+		if( ( bc.flags & kBinaryFoundFlag )!=0 ){
+			// mapping is page aligned
+			column.values = reinterpret_cast<const double*>( mapped_file.get_data() + bc.data_offset );
+		}
+		columns.push_back( column );
+	}
+	return true;
+}
+
+void ProcessedResultsFile::Close(){
+	mapped_file.Close();
+	columns.clear();
+	points_count = 0;
+}
+
+std::string ProcessedResultsFile::GetGnuplotBinaryKeywords( const unsigned int column ) const{
+	if( column>=columns.size() || columns.at(column).values==nullptr ){
+		return kEmptyWord;
+	}
+	const column_t& c = columns.at(column);
+	const uint64_t dataOffset = reinterpret_cast<const char*>(c.values) - mapped_file.get_data();
+	return "binary skip=" + number2String(dataOffset) + " format='%float64' record="
+		+ number2String( c.transient ? points_count : 1 );
+}
@@ -0,0 +1,121 @@
+/**
+ * @file processed_results_file.hpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * Processed transient results files.
+ * Text formats (matlab, gnuplot, csv): one row per time point.
+ * Binary format: a small header followed by one float64 column per metric,
+ * each column 64 bytes aligned so it can be read in place from the
+ * memory mapped file. Ocean eval metrics store a single value.
+ *
+ * Binary layout (native byte order):
+ * 	header: magic[8], uint32 version, uint32 columns count, uint64 points count
+ * 	columns: uint64 data offset, uint64 name offset, uint32 name size,
+ * 		uint32 values size, uint32 flags (transient, found), uint32 padding
+ * 	names, then the aligned columns data
+ * A version read with a different byte order does not match, and the file is rejected.
+ *
+ */
+
+#ifndef PROCESSED_RESULTS_FILE_H
+#define PROCESSED_RESULTS_FILE_H
+
+// c++ std libraries
+#include <string>
+#include <vector>
+#include <cstdint>
+// Radiation simulator
+#include "mapped_file.hpp"
+
+class ProcessedResultsFile {
+public:
+	/// column of a processed results file
+	struct column_t {
+		std::string name;
+		/// transient magnitude (one value per time point) or ocean eval metric (a single value)
+		bool transient;
+		/// magnitude length reported in the text headers
+		unsigned int values_size;
+		/// nullptr if the metric was not found in the results
+		const double* values;
+	};
+
+	/// Default constructor
+	ProcessedResultsFile();
+	/// Non copyable, columns point to the mapped file
+	ProcessedResultsFile( const ProcessedResultsFile& orig ) = delete;
+	ProcessedResultsFile& operator=( const ProcessedResultsFile& orig ) = delete;
+	/// Default destructor
+	virtual ~ProcessedResultsFile();
+
+	/**
+	 * @brief Exports the columns in a text format
+	 *
+	 * @param path
+	 * @param format kMatlab, kGnuPlot or kCSV
+	 * @param columns
+	 * @param pointsCount
+	 * @return false if the format is not a text one or the file can not be written
+	 */
+	static bool ExportText( const std::string& path, const int format,
+		const std::vector<column_t>& columns, const uint64_t pointsCount );
+
+	/**
+	 * @brief Exports the columns in the binary format
+	 *
+	 * @param path
+	 * @param columns
+	 * @param pointsCount
+	 * @return false if the file can not be written
+	 */
+	static bool ExportBinary( const std::string& path,
+		const std::vector<column_t>& columns, const uint64_t pointsCount );
+
+	/**
+	 * @brief Maps a binary processed results file
+	 *
+	 * @param path
+	 * @return false if the file can not be mapped or is not a valid binary file
+	 */
+	bool Open( const std::string& path );
+
+	/**
+	 * @brief Unmaps the file
+	 */
+	void Close();
+
+	/**
+	 * @brief Converts the mapped file to a text format
+	 *
+	 * @param path
+	 * @param format kMatlab, kGnuPlot or kCSV
+	 * @return false if the file can not be written
+	 */
+	bool ExportAsText( const std::string& path, const int format ) const {
+		return ExportText( path, format, columns, points_count ); }
+
+	/**
+	 * @brief gnuplot binary keywords reading a column in place
+	 * ("binary skip=<data offset> format='%float64' record=<values>")
+	 *
+	 * @param column metric index, time is column 0
+	 * @return empty string if the column was not found
+	 */
+	std::string GetGnuplotBinaryKeywords( const unsigned int column ) const;
+
+	const std::vector<column_t>& get_columns() const { return columns; }
+	uint64_t get_points_count() const { return points_count; }
+
+private:
+	MappedFile mapped_file;
+	/// views of the mapped file
+	std::vector<column_t> columns;
+	uint64_t points_count;
+};
+
+#endif /* PROCESSED_RESULTS_FILE_H */
@@ -7,6 +7,10 @@
 
 // c++ std libraries
 #include <fstream>
+#include <cstring>
+#include <cstdint>
+#include <cmath>
+#include <algorithm>
 
 // # for sleep
 #include <chrono>
@@ -17,8 +21,13 @@
 #include "boost/filesystem.hpp"  // includes all needed Boost.Filesystem declarations
 // Radiation simulator
 #include "raw_format_processor.hpp"
+#include "mapped_file.hpp"
+#include "processed_results_file.hpp"
+#include "number_parser.hpp"
 #include "../metric_modeling/magnitude.hpp"
 #include "../metric_modeling/ocean_eval_metric.hpp"
+#include "../metric_modeling/magnitude_comparator.hpp"
+#include "../metric_modeling/trace_set.hpp"
 // constants
 #include "../global_functions_and_constants/global_template_functions.hpp"
 #include "../global_functions_and_constants/global_constants.hpp"
@@ -34,6 +43,9 @@ RAWFormatProcessor::RAWFormatProcessor() {
 	this->is_golden = false;
 	this->is_montecarlo_nested_simulation = false;
 	this->additional_save = false;
+	this->memory_mapped_reader = true;
+	this->magnitude_comparators = nullptr;
+	this->partially_read = false;
 }
 
 RAWFormatProcessor::RAWFormatProcessor( std::vector<Metric*>* metrics,
@@ -45,7 +57,12 @@ RAWFormatProcessor::RAWFormatProcessor( std::vector<Metric*>* metrics,
 	this->montecarlo_eval_file_path = kNotDefinedString;
 	this->format = kMatlab;
 	this->export_processed_metrics = false;
+	this->is_golden = false;
 	this->is_montecarlo_nested_simulation = false;
+	this->additional_save = false;
+	this->memory_mapped_reader = true;
+	this->magnitude_comparators = nullptr;
+	this->partially_read = false;
 }
 
 RAWFormatProcessor::~RAWFormatProcessor() {
@@ -101,6 +118,7 @@ bool RAWFormatProcessor::ProcessSpectreOutputs(){
 		}
 	}
 	correctly_processed = true;
+	partially_read = false;
 	if( processSpectreLog ){
 		if( is_montecarlo_nested_simulation ){
  			correctly_processed = ProcessMontecarloEvals();
@@ -108,7 +126,14 @@ bool RAWFormatProcessor::ProcessSpectreOutputs(){
  			correctly_processed = ProcessSpectreLogs();
 		}
 	}
- 	correctly_processed = correctly_processed && ProcessPSFASCII();
+ 	if( correctly_processed ){
+		if( DetectRawFormat( transient_file_path )==kRawFormatNutBin ){
+			correctly_processed = ProcessNutBin();
+		}else{
+			// psfascii, unknown formats are reported by the psfascii readers
+			correctly_processed = memory_mapped_reader ? ProcessPSFASCIIMapped() : ProcessPSFASCII();
+		}
+	}
 	if(correctly_processed && export_processed_metrics ){
 		if(!ExportMetrics2File()){
 			log_io->ReportError2AllLogs( "Exception while exporting results" );
@@ -219,6 +244,7 @@ bool RAWFormatProcessor::ProcessPSFASCII(){
 	bool valueReady = false;
 	std::ifstream file( transient_file_path );
 	correctly_processed = true;
+	std::size_t incompleteRowValues = 0;
 	try {
 		if ( file && file.is_open() && file.good() ) {
 			#ifdef PSFASCII_VERBOSE
@@ -239,29 +265,36 @@ bool RAWFormatProcessor::ProcessPSFASCII(){
 			auto it_begin = metrics->begin();
 			auto it_end = metrics->end();
 			std::vector<std::string> lineTockensSpaces;
+			// transient row, stored or streamed
+			std::vector<double> row( metrics->size() );
+			bool streamDecided = false;
+			CreateTraceSet( 0 );
 			while( getline(file, currentReadLine) ) {
 				if( currentReadLine.compare(kPSFAsciiEndWord)==0 ){
 					break; // end of tran.tran
 				}
+				if( streamDecided ){
+					// comparators do not need more samples
+					partially_read = true;
+					break;
+				}
 				lineTockensSpaces.clear();
 				boost::split(lineTockensSpaces, currentReadLine, boost::is_any_of(kDelimiter), boost::token_compress_on);
 				// if not transient mag (at least time is a magnitude)
 				if( !(*it_m)->is_transient_magnitude() ){
 					it_m = it_begin;
 				}
-				// next line equivalent to
-				// auto pMag = static_cast<Magnitude*>(*it_m);
-				// pMag->AddValue( atof( lineTockensSpaces.at(1).c_str() ) );
-				// ++it_m;
-				(static_cast<Magnitude*>(*(it_m)++))->AddValue( atof( lineTockensSpaces.at(1).c_str() ) );
-				if(it_m == it_end){
+				row[ std::distance( it_begin, it_m++ ) ] = atof( lineTockensSpaces.at(1).c_str() );
+				if( it_m == it_end || !(*it_m)->is_transient_magnitude() ){
 					it_m = it_begin;
+					streamDecided = !AddTransientRow( row );
 					if( additional_save ){
 						// read the //save injector
 						getline(file, currentReadLine);
 					}
 				}
 			}
+			incompleteRowValues = std::distance( it_begin, it_m );
 		} // file is open and good
 		else{
 			log_io->ReportError2AllLogs( k2Tab + "File " + transient_file_path + " NOT OPENED" );
@@ -274,20 +307,20 @@ bool RAWFormatProcessor::ProcessPSFASCII(){
 	}
 	// close file
 	file.close();
-	// test lengths:
-	unsigned int firstSize = 0;
-	unsigned int magSize = 0;
-	for( auto const& m : *metrics ){
-		if( m->is_transient_magnitude() ){
-			if( firstSize==0 ){
-				firstSize = (static_cast<Magnitude*>(m))->get_values()->size();
-			}
-			magSize = (static_cast<Magnitude*>(m))->get_values()->size();
-			if( firstSize!= magSize ){
-				log_io->ReportError2AllLogs( "Magnitudes sizes inconsistent. Magnitude " + m->get_name()
-					+ " has " + number2String(magSize) + " points compared to time with " + number2String(firstSize));
-				correctly_processed = false;
-			}
+	correctly_processed = CheckMagnitudesLengths( incompleteRowValues ) && correctly_processed;
+	EndTransientStream();
+	return correctly_processed;
+}
+
+bool RAWFormatProcessor::CheckMagnitudesLengths( const std::size_t incompleteRowValues ){
+	bool consistentLengths = true;
+	// every stored row is complete, the last read row may not
+	unsigned int timeSize = trace_set ? trace_set->get_points_count() + 1 : 1;
+	for( std::size_t i=incompleteRowValues; incompleteRowValues>0 && i<metrics->size(); ++i ){
+		if( metrics->at(i)->is_transient_magnitude() ){
+			log_io->ReportError2AllLogs( "Magnitudes sizes inconsistent. Magnitude " + metrics->at(i)->get_name()
+				+ " has " + number2String(timeSize - 1) + " points compared to time with " + number2String(timeSize));
+			consistentLengths = false;
 		}
 	}
 
@@ -298,13 +331,360 @@ bool RAWFormatProcessor::ProcessPSFASCII(){
 		log_io->ReportPlain2Log( k2Tab + "Transient file: " + transient_file_path );
 		for( auto const& m : *metrics ){
 			if( m->is_transient_magnitude() ){
-				log_io->ReportPlain2Log( k2Tab + m->get_name() + " size: " + number2String((static_cast<Magnitude*>(m))->get_values()->size() ) + kEmptyLine );
+				log_io->ReportPlain2Log( k2Tab + m->get_name() + " size: " + number2String((static_cast<Magnitude*>(m))->get_values_size() ) + kEmptyLine );
 			}else{
 				log_io->ReportPlain2Log( k2Tab + m->get_name() );
 			}
 		}
 		log_io->ReportPlain2Log( kLongDelimiter );
 	#endif
+	return consistentLengths;
+}
+
+bool RAWFormatProcessor::ProcessPSFASCIIMapped(){
+	MappedFile file;
+	if( !file.Open( transient_file_path ) ){
+		// empty files or filesystems without mmap support
+		log_io->ReportPlain2Log( k2Tab + "File " + transient_file_path + " could not be mapped, using std::ifstream." );
+		return ProcessPSFASCII();
+	}
+	#ifdef PSFASCII_VERBOSE
+		log_io->ReportPlain2Log( k2Tab + "File " + transient_file_path + " mapped" );
+	#endif
+	correctly_processed = true;
+	std::size_t incompleteRowValues = 0;
+	try {
+		const char* it = FindPSFASCIISection( file.get_data(), file.get_end(), kPSFAsciiValueWord );
+		if( it==nullptr ){
+			log_io->ReportError2AllLogs( "Exception, end of file and " + kPSFAsciiValueWord + " was not found in  " + transient_file_path );
+			correctly_processed = false;
+			throw std::invalid_argument( "Exception, end of file and " + kPSFAsciiValueWord + " was not found in  " + transient_file_path  );
+		}
+		const char* end = file.get_end();
+		auto it_m = metrics->begin();
+		auto it_begin = metrics->begin();
+		auto it_end = metrics->end();
+		// first row is used to estimate the number of points
+		bool reserved = false;
+		const char* rowBegin = it;
+		bool skipLine = false;
+		double value;
+		// transient row, stored or streamed
+		std::vector<double> row( metrics->size() );
+		bool streamDecided = false;
+		CreateTraceSet( 0 );
+		while( it<end ){
+			const char* eol = static_cast<const char*>( std::memchr( it, '\n', end - it ) );
+			if( eol==nullptr ){
+				eol = end;
+			}
+			if( skipLine ){
+				// the //save injector
+				skipLine = false;
+				it = eol + 1;
+				continue;
+			}
+			const char* lineEnd = ( eol>it && *(eol - 1)=='\r' ) ? eol - 1 : eol;
+			if( static_cast<std::size_t>(lineEnd - it)==kPSFAsciiEndWord.size()
+				&& std::memcmp( it, kPSFAsciiEndWord.c_str(), kPSFAsciiEndWord.size() )==0 ){
+				break; // end of tran.tran
+			}
+			if( streamDecided ){
+				// comparators do not need more samples
+				partially_read = true;
+				break;
+			}
+			// skip trace name, "name" value
+			const char* cursor = it;
+			if( *cursor=='"' ){
+				cursor = static_cast<const char*>( std::memchr( cursor + 1, '"', lineEnd - cursor - 1 ) );
+				if( cursor==nullptr ){
+					throw std::invalid_argument( "Unterminated trace name in " + transient_file_path );
+				}
+				++cursor;
+			}else{
+				while( cursor<lineEnd && *cursor!=' ' && *cursor!='\t' ){
+					++cursor;
+				}
+			}
+			if( !ParseDouble( cursor, lineEnd, value ) ){
+				throw std::invalid_argument( "Invalid value '" + std::string( it, lineEnd ) + "' in " + transient_file_path );
+			}
+			// if not transient mag (at least time is a magnitude)
+			if( !(*it_m)->is_transient_magnitude() ){
+				it_m = it_begin;
+			}
+			row[ std::distance( it_begin, it_m++ ) ] = value;
+			if( it_m == it_end || !(*it_m)->is_transient_magnitude() ){
+				it_m = it_begin;
+				skipLine = additional_save;
+				if( !reserved && trace_set ){
+					// single allocation of the trace set, unless the estimation falls short
+					reserved = true;
+					std::size_t rowBytes = eol + 1 - rowBegin;
+					trace_set->Reserve( ( end - rowBegin )/rowBytes + 1 );
+				}
+				streamDecided = !AddTransientRow( row );
+			}
+			it = eol + 1;
+		}
+		incompleteRowValues = std::distance( it_begin, it_m );
+	}catch (std::exception const& ex) {
+		std::string ex_what = ex.what();
+		log_io->ReportError2AllLogs( "Exception while parsing the file: ex-> " + ex_what );
+ 		correctly_processed = false;
+	}
+	file.Close();
+	correctly_processed = CheckMagnitudesLengths( incompleteRowValues ) && correctly_processed;
+	EndTransientStream();
+	return correctly_processed;
+}
+
+void RAWFormatProcessor::CreateTraceSet( const unsigned int expectedPoints ){
+	trace_set.reset();
+	if( magnitude_comparators!=nullptr ){
+		// streamed samples are not stored
+		return;
+	}
+	// transient magnitudes precede the ocean eval metrics, time first
+	unsigned int signalsCount = 0;
+	while( signalsCount<metrics->size() && metrics->at(signalsCount)->is_transient_magnitude() ){
+		++signalsCount;
+	}
+	trace_set = std::make_shared<TraceSet>( signalsCount, expectedPoints );
+	for( unsigned int s=0; s<signalsCount; ++s ){
+		static_cast<Magnitude*>( metrics->at(s) )->set_trace( trace_set, s );
+	}
+}
+
+bool RAWFormatProcessor::AddTransientRow( const std::vector<double>& row ){
+	if( magnitude_comparators!=nullptr ){
+		return StreamTransientRow( row );
+	}
+	trace_set->AddRow( row.data() );
+	return true;
+}
+
+bool RAWFormatProcessor::StreamTransientRow( const std::vector<double>& row ){
+	// first magnitude is time
+	bool decided = true;
+	for( std::size_t i=1; i<row.size() && i<magnitude_comparators->size(); ++i ){
+		MagnitudeComparator* comparator = (*magnitude_comparators)[i];
+		if( comparator!=nullptr ){
+			comparator->AddSample( row.front(), row[i] );
+			decided = decided && comparator->get_decided();
+		}
+	}
+	return !decided;
+}
+
+void RAWFormatProcessor::EndTransientStream(){
+	if( magnitude_comparators==nullptr || partially_read ){
+		return;
+	}
+	for( auto const& comparator : *magnitude_comparators ){
+		if( comparator!=nullptr ){
+			comparator->EndOfStream();
+		}
+	}
+}
+
+const char* RAWFormatProcessor::FindPSFASCIISection( const char* begin, const char* end,
+	const std::string& sectionWord ){
+	// sections are whole lines: "\nVALUE\n"
+	std::string sectionLine = "\n" + sectionWord + "\n";
+	if( static_cast<std::size_t>(end - begin)>sectionWord.size()
+		&& std::memcmp( begin, sectionWord.c_str(), sectionWord.size() )==0
+		&& begin[sectionWord.size()]=='\n' ){
+		return begin + sectionWord.size() + 1;
+	}
+	// glibc memmem relies on vectorized memchr/two-way search
+	const char* found = static_cast<const char*>( memmem( begin, end - begin,
+		sectionLine.c_str(), sectionLine.size() ) );
+	if( found==nullptr ){
+		return nullptr;
+	}
+	return found + sectionLine.size();
+}
+
+int RAWFormatProcessor::DetectRawFormat( const std::string& file_path ){
+	char fileHeader[16];
+	std::ifstream file( file_path, std::ios::binary );
+	if( !file || !file.is_open() ){
+		return kRawFormatUnknown;
+	}
+	file.read( fileHeader, sizeof(fileHeader) );
+	std::string headerWord( fileHeader, file.gcount() );
+	file.close();
+	if( headerWord.compare( 0, kNutmegTitleWord.size(), kNutmegTitleWord )==0 ){
+		return kRawFormatNutBin;
+	}else if( headerWord.compare( 0, kPSFAsciiHeaderWord.size(), kPSFAsciiHeaderWord )==0 ){
+		return kRawFormatPSFASCII;
+	}
+	return kRawFormatUnknown;
+}
+
+// nutmeg values are stored with the byte order of the writer host
+static inline double ReadNutBinValue( const char* position, const bool swapBytes ){
+	uint64_t rawValue;
+	std::memcpy( &rawValue, position, sizeof(rawValue) );
+	if( swapBytes ){
+		rawValue = __builtin_bswap64( rawValue );
+	}
+	double value;
+	std::memcpy( &value, &rawValue, sizeof(value) );
+	return value;
+}
+
+bool RAWFormatProcessor::ReadNutBinPlot( const char* begin, const char* end, nutbin_plot_t& plot ){
+	try {
+		const char* it = begin;
+		// a nutbin file may contain several plots (dc, tran...)
+		while( it<end ){
+			unsigned int variablesNumber = 0;
+			unsigned int pointsNumber = 0;
+			bool complexValues = false;
+			bool binaryFound = false;
+			plot.variable_names.clear();
+			while( !binaryFound && it<end ){
+				const char* eol = static_cast<const char*>( std::memchr( it, '\n', end - it ) );
+				if( eol==nullptr ){
+					eol = end;
+				}
+				std::string currentReadLine( it, eol );
+				boost::algorithm::trim( currentReadLine );
+				it = eol + 1;
+				if( boost::starts_with( currentReadLine, kNutmegFlagsWord ) ){
+					complexValues = currentReadLine.find( kNutmegComplexFlag )!=std::string::npos;
+				}else if( boost::starts_with( currentReadLine, kNutmegVariablesNumberWord ) ){
+					variablesNumber = std::stoul( currentReadLine.substr( kNutmegVariablesNumberWord.size() ) );
+				}else if( boost::starts_with( currentReadLine, kNutmegPointsNumberWord ) ){
+					pointsNumber = std::stoul( currentReadLine.substr( kNutmegPointsNumberWord.size() ) );
+				}else if( boost::starts_with( currentReadLine, kNutmegVariablesWord ) ){
+					// "Variables:" may be followed by the first variable in the same line
+					std::string variableLine = currentReadLine.substr( kNutmegVariablesWord.size() );
+					while( plot.variable_names.size()<variablesNumber ){
+						std::vector<std::string> lineTockensSpaces;
+						boost::algorithm::trim( variableLine );
+						if( !variableLine.empty() ){
+							// index name type
+							boost::split( lineTockensSpaces, variableLine, boost::is_any_of(" \t"), boost::token_compress_on );
+							if( lineTockensSpaces.size()<2 ){
+								throw std::invalid_argument( "Invalid nutbin variable '" + variableLine + "'" );
+							}
+							plot.variable_names.push_back( lineTockensSpaces.at(1) );
+						}
+						if( plot.variable_names.size()<variablesNumber ){
+							if( it>=end ){
+								throw std::invalid_argument( "Unexpected end of nutbin variables" );
+							}
+							eol = static_cast<const char*>( std::memchr( it, '\n', end - it ) );
+							if( eol==nullptr ){
+								eol = end;
+							}
+							variableLine = std::string( it, eol );
+							it = eol + 1;
+						}
+					}
+				}else if( currentReadLine.compare( kNutmegBinaryWord )==0 ){
+					binaryFound = true;
+				}
+			}
+			if( !binaryFound || variablesNumber==0 || plot.variable_names.size()!=variablesNumber ){
+				return false;
+			}
+			std::size_t pointBytes = variablesNumber*sizeof(double)*( complexValues ? 2 : 1 );
+			std::size_t availablePoints = it<end ? ( end - it )/pointBytes : 0;
+			if( !complexValues && plot.variable_names.front().compare("time")==0 ){
+				// aborted simulations may declare more points than written
+				plot.points = ( pointsNumber==0 || pointsNumber>availablePoints ) ? availablePoints : pointsNumber;
+				plot.data = it;
+				return CheckNutBinByteOrder( plot );
+			}
+			// skip this plot values
+			if( pointsNumber>availablePoints ){
+				return false;
+			}
+			it += pointsNumber*pointBytes;
+		}
+	}catch (std::exception const& ex) {
+		std::string ex_what = ex.what();
+		log_io->ReportError2AllLogs( "Exception while parsing the nutbin header: ex-> " + ex_what );
+	}
+	return false;
+}
+
+bool RAWFormatProcessor::CheckNutBinByteOrder( nutbin_plot_t& plot ){
+	// time axis has to be finite, positive and ascending
+	std::size_t pointBytes = plot.variable_names.size()*sizeof(double);
+	unsigned int checkedPoints = std::min( plot.points, 16u );
+	for( bool swapBytes : { false, true } ){
+		bool validTime = true;
+		double backTime = 0;
+		for( unsigned int i=0; validTime && i<checkedPoints; ++i ){
+			double currentTime = ReadNutBinValue( plot.data + i*pointBytes, swapBytes );
+			validTime = std::isfinite( currentTime ) && currentTime>=backTime;
+			backTime = currentTime;
+		}
+		if( validTime ){
+			plot.swap_bytes = swapBytes;
+			return true;
+		}
+	}
+	return false;
+}
+
+bool RAWFormatProcessor::ProcessNutBin(){
+	MappedFile file;
+	correctly_processed = true;
+	try {
+		if( !file.Open( transient_file_path ) ){
+			throw std::invalid_argument( "File " + transient_file_path + " NOT OPENED" );
+		}
+		nutbin_plot_t plot;
+		if( !ReadNutBinPlot( file.get_data(), file.get_end(), plot ) ){
+			throw std::invalid_argument( "Transient plot was not found in " + transient_file_path );
+		}
+		#ifdef PSFASCII_VERBOSE
+			log_io->ReportPlain2Log( k2Tab + "File " + transient_file_path + " mapped, "
+				+ number2String(plot.points) + " points" );
+		#endif
+		// column of each transient magnitude, additional saves are ignored
+		std::vector<std::size_t> columns;
+		// positions of the columns in the transient row
+		std::vector<std::size_t> rowIndexes;
+		for( auto const& m : *metrics ){
+			if( m->is_transient_magnitude() ){
+				auto it_v = std::find( plot.variable_names.begin(), plot.variable_names.end(), m->get_name() );
+				if( it_v == plot.variable_names.end() ){
+					throw std::invalid_argument( "Magnitude " + m->get_name() + " not found in " + transient_file_path );
+				}
+				columns.push_back( std::distance( plot.variable_names.begin(), it_v )*sizeof(double) );
+				rowIndexes.push_back( &m - &metrics->front() );
+			}
+		}
+		// the number of points is known, single allocation
+		CreateTraceSet( plot.points );
+		std::vector<double> row( metrics->size() );
+		std::size_t pointBytes = plot.variable_names.size()*sizeof(double);
+		const char* point = plot.data;
+		for( unsigned int i=0; i<plot.points; ++i, point+=pointBytes ){
+			for( std::size_t c=0; c<columns.size(); ++c ){
+				row[ rowIndexes[c] ] = ReadNutBinValue( point + columns[c], plot.swap_bytes );
+			}
+			if( !AddTransientRow( row ) ){
+				partially_read = i+1<plot.points;
+				break;
+			}
+		}
+	}catch (std::exception const& ex) {
+		std::string ex_what = ex.what();
+		log_io->ReportError2AllLogs( "Exception while parsing the file: ex-> " + ex_what );
+ 		correctly_processed = false;
+	}
+	file.Close();
+	correctly_processed = CheckMagnitudesLengths( 0 ) && correctly_processed;
+	EndTransientStream();
 	return correctly_processed;
 }
 
@@ -325,41 +705,61 @@ bool RAWFormatProcessor::PrepProcessTransientMetrics( std::vector<Metric*>* unso
 	// add time
 	sortedMags->push_back( new Magnitude( *(static_cast<Magnitude*>(unsortedMags->front()) ) ));
 	sortedMags->back()->set_found_in_results( true );
-	std::ifstream file( spectreResultTrans );
-	try {
-		bool valueReady = false;
-		if ( file && file.is_open() && file.good() ) {
-			// File parsing, wait till magnitude values appear
-			while( !valueReady && getline(file, currentReadLine) ) {
-				valueReady = kPSFAsciiTraceWord.compare(currentReadLine)== 0;
-			}
-			if( !valueReady ){
-				log_io->ReportError2AllLogs( "Exception, end of file and " + kPSFAsciiTraceWord + " was not found in  " + spectreResultTrans );
-				correctly_processed = false;
-				throw std::invalid_argument( "Exception, end of file and " + kPSFAsciiTraceWord + " was not found in  " + spectreResultTrans  );
-			}
-			std::vector<std::string> lineTockensSpaces;
-			while( getline(file, currentReadLine) ) {
-				if( currentReadLine.compare(kPSFAsciiValueWord)==0 ){
-					break; // start mag values
-				}
-				boost::split(lineTockensSpaces, currentReadLine, boost::is_any_of(kDelimiter), boost::token_compress_on);
+	if( DetectRawFormat( spectreResultTrans )==kRawFormatNutBin ){
+		// binary file, traces are the variables of the transient plot
+		MappedFile binFile;
+		nutbin_plot_t plot;
+		if( binFile.Open( spectreResultTrans ) && ReadNutBinPlot( binFile.get_data(), binFile.get_end(), plot ) ){
+			for( auto it_v = plot.variable_names.begin() + 1; it_v != plot.variable_names.end(); ++it_v ){
 				for( auto const &m : *unsortedMags ){
-					if( m->is_transient_magnitude() && m->get_enclosed_name().compare(lineTockensSpaces.at(0))==0 ) {
+					if( m->is_transient_magnitude() && m->get_name().compare(*it_v)==0 ) {
 						auto pMag = static_cast<Magnitude*>( m );
 						sortedMags->push_back( new Magnitude(*pMag) );
 						sortedMags->back()->set_found_in_results( true );
 					}
 				}
-			} // end of file or start of values
-		} // file is open and good
-	}catch (std::exception const& ex) {
-		std::string ex_what = ex.what();
-		log_io->ReportError2AllLogs( "Exception while parsing the file: ex-> " + ex_what );
- 		correctly_processed = false;
+			}
+		}else{
+			log_io->ReportError2AllLogs( "Exception, transient plot was not found in  " + spectreResultTrans );
+			correctly_processed = false;
+		}
+	}else{
+		std::ifstream file( spectreResultTrans );
+		try {
+			bool valueReady = false;
+			if ( file && file.is_open() && file.good() ) {
+				// File parsing, wait till magnitude values appear
+				while( !valueReady && getline(file, currentReadLine) ) {
+					valueReady = kPSFAsciiTraceWord.compare(currentReadLine)== 0;
+				}
+				if( !valueReady ){
+					log_io->ReportError2AllLogs( "Exception, end of file and " + kPSFAsciiTraceWord + " was not found in  " + spectreResultTrans );
+					correctly_processed = false;
+					throw std::invalid_argument( "Exception, end of file and " + kPSFAsciiTraceWord + " was not found in  " + spectreResultTrans  );
+				}
+				std::vector<std::string> lineTockensSpaces;
+				while( getline(file, currentReadLine) ) {
+					if( currentReadLine.compare(kPSFAsciiValueWord)==0 ){
+						break; // start mag values
+					}
+					boost::split(lineTockensSpaces, currentReadLine, boost::is_any_of(kDelimiter), boost::token_compress_on);
+					for( auto const &m : *unsortedMags ){
+						if( m->is_transient_magnitude() && m->get_enclosed_name().compare(lineTockensSpaces.at(0))==0 ) {
+							auto pMag = static_cast<Magnitude*>( m );
+							sortedMags->push_back( new Magnitude(*pMag) );
+							sortedMags->back()->set_found_in_results( true );
+						}
+					}
+				} // end of file or start of values
+			} // file is open and good
+		}catch (std::exception const& ex) {
+			std::string ex_what = ex.what();
+			log_io->ReportError2AllLogs( "Exception while parsing the file: ex-> " + ex_what );
+	 		correctly_processed = false;
+		}
+		// close
+		file.close();
 	}
-	// close
-	file.close();
 	// has oceanEvalMetric?
 	bool hasOceanEvalMetrics = false;
 	for( auto const& m: *unsortedMags){
@@ -437,92 +837,42 @@ bool RAWFormatProcessor::ExportMetrics2File(){
 		correctly_processed = false;
 		return false;
 	}
-	// std::cout << "[debug]Exporting " << processed_file_path << "\n";
-	// Export output
-	std::ofstream outputFile;
-	outputFile.open(processed_file_path.c_str());
-	outputFile.setf(std::ios::scientific);
-	if (!outputFile){
-		log_io->ReportError2AllLogs( kTab + "error writing " + processed_file_path);
-		correctly_processed = false;
+	if( format!=kMatlab && format!=kGnuPlot && format!=kCSV && format!=kBinary ){
+		log_io->ReportError2AllLogs( "The file format (matlab, gnuplot, csv or binary) was not defined. " );
 		return false;
 	}
-	std::string m_names;
-	std::string mDelimiter;
-	switch ( format ){
-		case kMatlab:{
-			mDelimiter = " ";
-			outputFile << "%Metric Lengths:" << kEmptyLine;
-			m_names ="%";
-			for( auto const& m : *metrics ){
-				if( m->is_transient_magnitude() ){
-					outputFile << "%" << mDelimiter << m->get_name() <<  mDelimiter << (static_cast<Magnitude*>(m))->get_values()->size() << kEmptyLine;
-				}else{
-					outputFile << "%" << mDelimiter << m->get_name() << kEmptyLine;
-				}
-				m_names += m->get_name() + mDelimiter;
-			}
-			outputFile << m_names << kEmptyLine;
-		}
-		break;
-		case kGnuPlot:{
-			mDelimiter = " ";
-			m_names ="#";
-			for( auto const& m : *metrics ){
-				if( m->is_transient_magnitude() ){
-					outputFile << "#" << mDelimiter << m->get_name() <<  mDelimiter << (static_cast<Magnitude*>(m))->get_values()->size() << kEmptyLine;
-				}else{
-					outputFile << "#" << mDelimiter << m->get_name() << kEmptyLine;
-				}
-				m_names += m->get_name() + mDelimiter;
-			}
-			outputFile << m_names << kEmptyLine;
-		}
-		break;
-		case kCSV:{
-			mDelimiter = ";";
-			outputFile << "#Metric Lengths:" << kEmptyLine;
-			m_names ="";
-			for( auto const& m : *metrics ){
-				if( m->is_transient_magnitude() ){
-					outputFile << "#" << mDelimiter << m->get_name() <<  mDelimiter << (static_cast<Magnitude*>(m))->get_values()->size() << kEmptyLine;
-				}else{
-					outputFile << "#" << mDelimiter << m->get_name() << kEmptyLine;
-				}
-				m_names += m->get_name() + mDelimiter;
-			}
-			outputFile << m_names << kEmptyLine;
-		}
-		break;
-		default:{
-			log_io->ReportError2AllLogs( "The file format (matlab, gnuplot or csv) was not defined. " );
-			return false;
-		}
-		break;
-	}
 	// fgarcia: metrics report only visible with PSFASCII_VERBOSE
 	#ifdef PSFASCII_VERBOSE
  	log_io->ReportPlain2Log( k2Tab + "-> Exporting metrics values to file: " + processed_file_path );
 	#endif
-	unsigned int numberOfTimeValues = (static_cast<Magnitude*>( metrics->at(0) ))->get_values()->size();
-	for (unsigned int i=0; i<numberOfTimeValues; ++i){
-		for( auto const& m : *metrics ){
-			if( m->get_found_in_results() ){
-				outputFile << m->get_value_at(i) << mDelimiter;
-				// if( m->is_transient_magnitude() ) {
-				// 	auto pMag = static_cast<Magnitude*>( m );
-				// 	outputFile << pMag->GetValue(i) << mDelimiter;
-				// }else if( ! m->is_transient_magnitude() ){
-				// 	auto pOceanEvalMag = static_cast<OceanEvalMetric*>( m );
-				// 	outputFile << pOceanEvalMag->get_value() << mDelimiter;
-				// }
-			}else{
-				outputFile << "notFound" << mDelimiter;
-			}
+	// trace set columns, ocean eval metrics store a single value
+	unsigned int numberOfTimeValues = trace_set ? trace_set->get_points_count() : 0;
+	std::vector<double> oceanEvalValues( metrics->size() );
+	std::vector<ProcessedResultsFile::column_t> columns( metrics->size() );
+	for( unsigned int c=0; c<metrics->size(); ++c ){
+		Metric* m = metrics->at(c);
+		ProcessedResultsFile::column_t& column = columns[c];
+		column.name = m->get_name();
+		column.transient = m->is_transient_magnitude();
+		column.values_size = column.transient ? static_cast<Magnitude*>(m)->get_values_size() : 0;
+		column.values = nullptr;
+		if( !m->get_found_in_results() ){
+			continue;
+		}else if( column.transient ){
+			column.values = static_cast<Magnitude*>(m)->get_values();
+		}else{
+			oceanEvalValues[c] = static_cast<OceanEvalMetric*>(m)->get_value();
+			column.values = &oceanEvalValues[c];
 		}
-		outputFile << "\n";
 	}
-	outputFile.close();
+	bool exported = format==kBinary
+		? ProcessedResultsFile::ExportBinary( processed_file_path, columns, numberOfTimeValues )
+		: ProcessedResultsFile::ExportText( processed_file_path, format, columns, numberOfTimeValues );
+	if( !exported ){
+		log_io->ReportError2AllLogs( kTab + "error writing " + processed_file_path);
+		correctly_processed = false;
+		return false;
+	}
 	#ifdef PSFASCII_VERBOSE
  	log_io->ReportPlain2Log( k2Tab + "-> Metrics exported. FilePath: " + transient_file_path );
 	#endif
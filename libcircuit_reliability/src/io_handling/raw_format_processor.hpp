@@ -11,12 +11,26 @@
 // c++ std libraries
 #include <string>
 #include <vector>
+#include <memory>
 // Radiation simulator
 // radiation io simulator includes
 #include "log_io.hpp"
 // netlist modeling
 #include "../metric_modeling/metric.hpp"
 
+class MagnitudeComparator;
+class TraceSet;
+
+// plot of a nutmeg binary (spectre nutbin) file
+struct nutbin_plot_t {
+	std::vector<std::string> variable_names;
+	unsigned int points = 0;
+	// first byte of the point-major double matrix
+	const char* data = nullptr;
+	// file written with the opposite endianness
+	bool swap_bytes = false;
+};
+
 class RAWFormatProcessor {
 public:
 	RAWFormatProcessor();
@@ -49,6 +63,18 @@ public:
 	void set_log_io( LogIO* log_io ){ this->log_io = log_io; }
 	bool get_correctly_processed() const{ return correctly_processed ; }
 	void set_additional_save( const bool additional_save ){ this->additional_save = additional_save; }
+	/// PSF ASCII files are scanned through a memory map (default) or std::ifstream
+	void set_memory_mapped_reader( const bool memory_mapped_reader ){ this->memory_mapped_reader = memory_mapped_reader; }
+	bool get_memory_mapped_reader() const{ return memory_mapped_reader; }
+	/**
+	 * @brief Streaming analysis: transient samples are fed to the comparators
+	 * (one per metric, nullptr if not analyzed) instead of being stored in the magnitudes.
+	 * Reading stops once every comparator has a decided result.
+	 *
+	 * @param magnitude_comparators
+	 */
+	void set_magnitude_comparators( std::vector<MagnitudeComparator*>* magnitude_comparators ){
+		this->magnitude_comparators = magnitude_comparators; }
 
 private:
 	LogIO* log_io;
@@ -63,11 +89,35 @@ private:
 	bool is_golden;
 	bool is_montecarlo_nested_simulation;
 	bool additional_save;
+	bool memory_mapped_reader;
+	std::vector<MagnitudeComparator*>* magnitude_comparators;
+	bool partially_read;
+	/// samples of the transient magnitudes, shared with the magnitudes
+	std::shared_ptr<TraceSet> trace_set;
 
 	void RecreateMetricsVector();
 	bool ExportMetrics2File();
 	bool CheckRequirements();
 	bool ProcessPSFASCII();
+	bool ProcessPSFASCIIMapped();
+	bool ProcessNutBin();
+	/// sniffs the raw file header, kRawFormatPSFASCII, kRawFormatNutBin or kRawFormatUnknown
+	int DetectRawFormat( const std::string& file_path );
+	/// finds the transient plot (first variable is time) and its binary values
+	bool ReadNutBinPlot( const char* begin, const char* end, nutbin_plot_t& plot );
+	bool CheckNutBinByteOrder( nutbin_plot_t& plot );
+	/// incompleteRowValues: values read of the last, incomplete, transient row
+	bool CheckMagnitudesLengths( const std::size_t incompleteRowValues );
+	/// creates the trace set of the transient magnitudes (not if streamed) and binds them
+	void CreateTraceSet( const unsigned int expectedPoints );
+	/// stores or streams a complete transient row, returns false when reading can stop
+	bool AddTransientRow( const std::vector<double>& row );
+	/// feeds a transient row to the comparators, returns false when reading can stop
+	bool StreamTransientRow( const std::vector<double>& row );
+	/// notifies the comparators that the whole transient has been streamed
+	void EndTransientStream();
+	/// returns the first char after the section line, nullptr if not found
+	const char* FindPSFASCIISection( const char* begin, const char* end, const std::string& sectionWord );
 	bool ProcessSpectreLogs();
 	bool ProcessMontecarloEvals();
 
@@ -77,6 +127,14 @@ private:
 	std::string kPSFAsciiTraceWord = "TRACE";
 	std::string kPSFAsciiValueWord = "VALUE";
 	std::string kPSFAsciiEndWord = "END";
+	std::string kPSFAsciiHeaderWord = "HEADER";
+	std::string kNutmegTitleWord = "Title:";
+	std::string kNutmegFlagsWord = "Flags:";
+	std::string kNutmegVariablesNumberWord = "No. Variables:";
+	std::string kNutmegPointsNumberWord = "No. Points:";
+	std::string kNutmegVariablesWord = "Variables:";
+	std::string kNutmegBinaryWord = "Binary:";
+	std::string kNutmegComplexFlag = "complex";
 };
 
 #endif /* RAWFORMATPROCESSOR_H */
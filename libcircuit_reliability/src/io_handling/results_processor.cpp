@@ -13,6 +13,7 @@
 
 // c++ std required libraries includes
 // #include <iostream>
+#include <algorithm>
 // Boost
 
 #include <boost/algorithm/string.hpp>
@@ -71,7 +72,7 @@ bool ResultsProcessor::PreProcessResultsFiles( const std::string&& path,
 	return correctlyProcessed;
 }
 
-bool ResultsProcessor::MeanProcessResultsFiles( const std::map<std::string, std::string>* paths,
+bool ResultsProcessor::MeanProcessResultsFiles( const std::multimap<std::string, std::string>* paths,
 	const std::string outputPath, const std::vector<unsigned int>&& columnIndexes ){
 	#ifdef RESULTS_POST_PROCESSING_VERBOSE
 		 log_io->ReportBlueStandard( "Processing:" + outputPath );
@@ -158,7 +159,7 @@ bool ResultsProcessor::MeanProcessResultsFiles( const std::map<std::string, std:
 	return result;
 }
 
-bool ResultsProcessor::StatisticProcessResultsFiles( const std::map<std::string, std::string>* paths,
+bool ResultsProcessor::StatisticProcessResultsFiles( const std::multimap<std::string, std::string>* paths,
 	const std::string outputPath, const std::vector<unsigned int>&& columnIndexes ){
 	#ifdef RESULTS_POST_PROCESSING_VERBOSE
 		 log_io->ReportBlueStandard( "Processing:" + outputPath );
@@ -252,7 +253,7 @@ bool ResultsProcessor::StatisticProcessResultsFiles( const std::map<std::string,
 	return result;
 }
 
-bool ResultsProcessor::StatisticProcessStatisticsFiles( const std::map<std::string, std::string>* paths,
+bool ResultsProcessor::StatisticProcessStatisticsFiles( const std::multimap<std::string, std::string>* paths,
 		const std::string& outputPath, const std::vector<unsigned int>&& maxFieldsColumnIndexes,
 		const std::vector<unsigned int>&& minFieldsColumnIndexes, const std::vector<unsigned int>&& meanFieldsColumnIndexes ){
 	#ifdef RESULTS_POST_PROCESSING_VERBOSE
@@ -532,10 +533,22 @@ bool ResultsProcessor::ExportScenariosList(
 			log_io->ReportError2AllLogs( kTab + "error writing " + kScenariosSummaryFile);
 			return false;
 		}
-		outputFile << "# folder_path altered_element_path\n";
+		// equivalent scenarios list the folder of the simulated one
+		bool deduplicated = std::any_of( scenariosList.begin(), scenariosList.end(),
+			[]( AlteredScenarioSummary* s ){ return s->get_equivalent_scenario_index()!=kNotDefinedInt; } );
+		if( deduplicated ){
+			outputFile << "# folder_path altered_element_path equivalent_scenario_folder_path\n";
+		}else{
+			outputFile << "# folder_path altered_element_path\n";
+		}
 		for( auto const &s : scenariosList ){
 			outputFile << s->get_altered_scenario_folder_path() << " "
-				<< s->get_altered_scenario_altered_element_path() << " " << "\n";
+				<< s->get_altered_scenario_altered_element_path() << " ";
+			if( deduplicated ){
+				outputFile << ( s->get_equivalent_scenario_index()==kNotDefinedInt ? s->get_altered_scenario_folder_path()
+					: scenariosList.at( s->get_equivalent_scenario_index() )->get_altered_scenario_folder_path() );
+			}
+			outputFile << "\n";
 		}
 	}catch (std::exception const& ex) {
 		std::string ex_what = ex.what();
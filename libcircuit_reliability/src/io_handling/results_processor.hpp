@@ -35,18 +35,19 @@ public:
 
 	// creates a file with the shape of each in paths,
 	// whose colums, if specified in columnIndexes, are the mean values
-	// of those in paths
-	bool MeanProcessResultsFiles( const std::map<std::string, std::string>* paths,
+	// of those in paths.
+	// A path repeated in paths (equivalent scenarios) is weighted as many times
+	bool MeanProcessResultsFiles( const std::multimap<std::string, std::string>* paths,
 		const std::string outputPath, const std::vector<unsigned int>&& columnIndexes );
 
 	// creates a file extending those in paths,
 	// For each column in columnIndexes, we compute mean, max val and min val
-	bool StatisticProcessResultsFiles( const std::map<std::string, std::string>* paths,
+	bool StatisticProcessResultsFiles( const std::multimap<std::string, std::string>* paths,
 		const std::string outputPath, const std::vector<unsigned int>&& columnIndexes );
 
 	// creates a file extending those in paths,
 	// For each column in columnIndexes, we compute mean, max val and min val
-	bool StatisticProcessStatisticsFiles( const std::map<std::string, std::string>* paths,
+	bool StatisticProcessStatisticsFiles( const std::multimap<std::string, std::string>* paths,
 		const std::string& outputPath, const std::vector<unsigned int>&& maxFieldsColumnIndexes,
 		const std::vector<unsigned int>&& minFieldsColumnIndexes, const std::vector<unsigned int>&& meanFieldsColumnIndexes );
 
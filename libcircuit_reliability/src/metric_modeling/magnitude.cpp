@@ -6,6 +6,7 @@
  */
 
  #include <iostream>
+ #include <stdexcept>
 
 /// reliability simulator
 #include "magnitude.hpp"
@@ -40,6 +41,7 @@ Magnitude::Magnitude( const std::string& name) {
 	///
 	this->ommit_upper_threshold = false;
 	this->ommit_lower_threshold = false;
+	this->trace_signal = 0;
 }
 
 Magnitude::Magnitude(const Magnitude& orig) {
@@ -80,10 +82,9 @@ Magnitude::Magnitude(const Magnitude& orig) {
 	this->error_time_span_default = orig.error_time_span_default;
 	this->ommit_upper_threshold = orig.ommit_upper_threshold;
 	this->ommit_lower_threshold = orig.ommit_lower_threshold;
-	// copy
-	for( auto const& v : orig.values ){
-		values.push_back(v);
-	}
+	// share the samples
+	this->trace_set = orig.trace_set;
+	this->trace_signal = orig.trace_signal;
 }
 
 Magnitude::Magnitude(const Magnitude& orig, bool copyValues) {
@@ -124,11 +125,11 @@ Magnitude::Magnitude(const Magnitude& orig, bool copyValues) {
 	this->error_time_span_default = orig.error_time_span_default;
 	this->ommit_upper_threshold = orig.ommit_upper_threshold;
 	this->ommit_lower_threshold = orig.ommit_lower_threshold;
+	this->trace_signal = 0;
 	if( copyValues ){
-		// copy
-		for( auto const& v : orig.values ){
-			values.push_back(v);
-		}
+		// share the samples
+		this->trace_set = orig.trace_set;
+		this->trace_signal = orig.trace_signal;
 	}
 }
 
@@ -139,10 +140,9 @@ Magnitude* Magnitude::GetCopy() {
 Magnitude::~Magnitude() {
 }
 
-void Magnitude::AddValue( double value ){
-	values.push_back( value );
-}
-
 double Magnitude::get_value_at( const int index ){
-	return values.at( index );
+	if( index<0 || static_cast<unsigned int>(index)>=get_values_size() ){
+		throw std::out_of_range( "Magnitude " + name + " has no value at " + std::to_string(index) );
+	}
+	return get_values()[index];
 }
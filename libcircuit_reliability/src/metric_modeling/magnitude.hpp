@@ -17,9 +17,10 @@
 #define MAGNITUDE_H
 
 /// c++ std required libraries
-#include <vector>
+#include <memory>
 
 #include "metric.hpp"
+#include "trace_set.hpp"
 
 class Magnitude : public Metric {
 public:
@@ -33,8 +34,22 @@ public:
 	Magnitude* GetCopy() override;
 	virtual ~Magnitude();
 
-	std::vector<double>* get_values() { return &values; }
-	unsigned int get_values_size() const { return values.size(); }
+	/**
+	 * @brief Binds the magnitude to a column of a trace set
+	 *
+	 * @param trace_set samples, shared with the copies of the magnitude
+	 * @param trace_signal column of the magnitude
+	 */
+	void set_trace( std::shared_ptr<const TraceSet> trace_set, const unsigned int trace_signal ){
+		this->trace_set = trace_set;
+		this->trace_signal = trace_signal;
+	}
+	const double* get_values() const {
+		return trace_set ? trace_set->get_signal( trace_signal ) : nullptr; }
+	unsigned int get_values_size() const {
+		return trace_set ? trace_set->get_points_count() : 0; }
+	double get_first_value() const { return get_values()[0]; }
+	double get_last_value() const { return get_values()[get_values_size() - 1]; }
 
 	// Analysis attributes
 	void set_analyze_error_in_time(bool analyze_error_in_time) {
@@ -82,12 +97,12 @@ public:
 	void set_plottable_in_golden( bool plottable_in_golden ){this->plottable_in_golden = plottable_in_golden;}
 
 
-	void AddValue( double value );
-
 	virtual double get_value_at( const int index ) override;
 
 private:
-	std::vector<double> values;
+	/// samples, metadata is kept in the magnitude
+	std::shared_ptr<const TraceSet> trace_set;
+	unsigned int trace_signal;
 	/// plottable
 	bool plottable;
 	bool plottable_in_golden;
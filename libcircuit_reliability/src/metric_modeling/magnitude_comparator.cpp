@@ -0,0 +1,184 @@
+/**
+ * @file magnitude_comparator.cpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * MagnitudeComparator Class Body
+ *
+ */
+
+// c++ std libraries
+#include <cmath>
+#include <algorithm>
+// Radiation simulator
+#include "magnitude_comparator.hpp"
+// constants
+#include "../global_functions_and_constants/global_template_functions.hpp"
+
+MagnitudeComparator::MagnitudeComparator( Magnitude& goldenMagnitude, Magnitude& goldenTime,
+		const Magnitude& simulatedMagnitude, const MarginEnvelope* goldenEnvelope ) :
+		simulated_magnitude( simulatedMagnitude ), margin_envelope( simulatedMagnitude ){
+	this->golden_times = goldenTime.get_values();
+	this->golden_values = goldenMagnitude.get_values();
+	this->golden_points = goldenTime.get_values_size();
+	this->golden_bands = nullptr;
+	if( goldenEnvelope!=nullptr && goldenEnvelope->get_points_count()==golden_points
+		&& goldenEnvelope->Matches( simulatedMagnitude ) ){
+		this->golden_bands = goldenEnvelope->get_bands();
+	}
+	this->analyze_in_time_window = goldenMagnitude.get_analyze_error_in_time_window();
+	this->analyzable_time_window_t0 = goldenMagnitude.get_analyzable_time_window_t0();
+	this->analyzable_time_window_tf = goldenMagnitude.get_analyzable_time_window_tf();
+	this->samples_count = 0;
+	this->started = false;
+	this->finished = false;
+	this->end_of_stream = false;
+	this->back_time = 0;
+	this->back_simulated_value = 0;
+	this->back_golden_value = 0;
+	this->last_simulated_time = 0;
+	this->metric_error = false;
+	this->on_going_error = false;
+	this->error_init = 0;
+	this->first_error_time = 0;
+	this->max_abs_error = 0;
+	this->max_abs_error_global = 0;
+	this->max_error_margin_ratio = 0;
+	this->stop_at_first_error = true;
+	this->interpolation_error = false;
+	// First step omitted (time=0.0)
+	this->golden_index = 1;
+	if( analyze_in_time_window ){
+		while( golden_index<golden_points && golden_times[golden_index]<analyzable_time_window_t0 ){
+			++golden_index;
+		}
+	}
+	this->valid_golden_window = golden_index<golden_points
+		&& golden_points==goldenMagnitude.get_values_size();
+	// nothing to compare
+	this->finished = !valid_golden_window;
+}
+
+MagnitudeComparator::~MagnitudeComparator(){
+}
+
+void MagnitudeComparator::AddSample( const double simulatedTime, const double simulatedValue ){
+	++samples_count;
+	last_simulated_time = simulatedTime;
+	// First step omitted (time=0.0)
+	if( samples_count==1 || finished || interpolation_error ){
+		return;
+	}
+	if( !started ){
+		// time window
+		if( analyze_in_time_window && simulatedTime<analyzable_time_window_t0 ){
+			return;
+		}
+		started = true;
+		back_time = std::min( golden_times[golden_index], simulatedTime );
+		back_simulated_value = simulatedValue;
+		back_golden_value = golden_values[golden_index];
+	}
+	// golden samples up to the simulated one
+	while( golden_index<golden_points ){
+		const double goldenTime = golden_times[golden_index];
+		// check if end of observable window
+		if( analyze_in_time_window
+				&& ( goldenTime>analyzable_time_window_tf || simulatedTime>analyzable_time_window_tf ) ){
+			finished = true;
+			return;
+		}
+		if( goldenTime==simulatedTime ){
+			const unsigned char band = GetGoldenBand( golden_index );
+			AnalyzeCurrentPoint( simulatedTime, simulatedValue, golden_values[golden_index++], band );
+			break;
+		}else if( goldenTime<simulatedTime ){
+			const unsigned char band = GetGoldenBand( golden_index );
+			double currentGoldenValue = golden_values[golden_index++];
+			double currentSimulatedValue = InterpolateValue( back_time, simulatedTime,
+				back_simulated_value, simulatedValue, goldenTime );
+			AnalyzeCurrentPoint( goldenTime, currentSimulatedValue, currentGoldenValue, band );
+			if( interpolation_error ){
+				return;
+			}
+		}else{
+			double currentGoldenValue = InterpolateValue( back_time, goldenTime,
+				back_golden_value, golden_values[golden_index], simulatedTime );
+			AnalyzeCurrentPoint( simulatedTime, simulatedValue, currentGoldenValue,
+				margin_envelope.ClassifyValue( currentGoldenValue ) );
+			break;
+		}
+	}
+	finished = golden_index>=golden_points;
+}
+
+void MagnitudeComparator::AnalyzeCurrentPoint( const double currentTime,
+		const double currentSimulatedValue, const double currentGoldenValue, const unsigned char band ){
+	// Update back variables
+	back_time = currentTime;
+	back_simulated_value = currentSimulatedValue;
+	back_golden_value = currentGoldenValue;
+	// Error
+	double currentMetricError = std::abs( currentGoldenValue - currentSimulatedValue );
+	if( max_abs_error_global<currentMetricError ){
+		max_abs_error_global = currentMetricError;
+	}
+	// ommited bands have an infinite margin, as in CheckError
+	const double absErrorMargin = margin_envelope.get_abs_error_margin( band );
+	const double absErrorTimeSpan = margin_envelope.get_error_time_span( band );
+	if( currentMetricError>0 && max_error_margin_ratio<currentMetricError/absErrorMargin ){
+		max_error_margin_ratio = currentMetricError/absErrorMargin;
+	}
+	bool updateMaxAbsError = false;
+	bool currentError = currentMetricError > absErrorMargin;
+	if( !simulated_magnitude.get_analyze_error_in_time() ){
+		// Punctual errors
+		updateMaxAbsError = currentError;
+	}else if( currentError ){
+		if( on_going_error ){
+			// if ongoing and it exceed the error defined duration
+			updateMaxAbsError = currentTime - error_init > absErrorTimeSpan;
+		}else{
+			on_going_error = true;
+			error_init = currentTime;
+		}
+	}else{
+		on_going_error = false;
+	}
+	if( updateMaxAbsError ){
+		if( !metric_error ){
+			first_error_time = currentTime;
+		}
+		metric_error = true;
+		if( max_abs_error<currentMetricError ){
+			max_abs_error = currentMetricError;
+		}
+	}
+}
+
+bool MagnitudeComparator::CheckError( const Magnitude& magnitude, const double& currentGoldenValue,
+	const double& currentMetricError, const double& absErrorMargin ){
+// fgarcia needs a revision, we require from a default '1' and '0' level
+	return  ( currentMetricError > absErrorMargin ) &&
+				!( (magnitude.get_ommit_upper_threshold() && currentGoldenValue > magnitude.get_error_threshold_ones() )
+					|| (magnitude.get_ommit_lower_threshold() && currentGoldenValue < magnitude.get_error_threshold_zeros()) );
+}
+
+double MagnitudeComparator::InterpolateValue( const double x1, const double x2,
+	const double y1, const double y2, const double a ){
+	if( x2<=x1 ){
+		interpolation_error = true;
+		interpolation_error_message = "x2<=x1";
+		return 0;
+	}else if( a>x2 || a<x1 ){
+		interpolation_error = true;
+		interpolation_error_message = "a>x2 || a<x1: a:" + number2String(a)
+			+ " x1:" + number2String(x1) + " x2:" + number2String(x2);
+		return 0;
+	}
+	return (a - x1)*(y2 - y1)/(x2 - x1) + y1;
+}
@@ -0,0 +1,140 @@
+/**
+ * @file magnitude_comparator.hpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * Streaming golden vs simulated comparison of a transient magnitude.
+ * Simulated samples are fed one by one while the raw file is read,
+ * following the same time-axis merge, interpolation and error rules of
+ * SpectreSimulation::InterpolateAndAnalyzeMagnitude, without storing
+ * the simulated values.
+ *
+ */
+
+#ifndef MAGNITUDE_COMPARATOR_H
+#define MAGNITUDE_COMPARATOR_H
+
+// c++ std libraries
+#include <string>
+#include <vector>
+// Radiation simulator
+#include "magnitude.hpp"
+#include "margin_envelope.hpp"
+
+class MagnitudeComparator {
+public:
+	/**
+	 * @brief Constructor
+	 *
+	 * @param goldenMagnitude golden values and analyzable time window
+	 * @param goldenTime golden time axis
+	 * @param simulatedMagnitude error margins and thresholds
+	 * @param goldenEnvelope classified golden samples, nullptr to classify them
+	 */
+	MagnitudeComparator( Magnitude& goldenMagnitude, Magnitude& goldenTime,
+		const Magnitude& simulatedMagnitude, const MarginEnvelope* goldenEnvelope = nullptr );
+	virtual ~MagnitudeComparator();
+
+	/**
+	 * @brief Adds the next simulated sample
+	 *
+	 * @param simulatedTime
+	 * @param simulatedValue
+	 */
+	void AddSample( const double simulatedTime, const double simulatedValue );
+
+	/**
+	 * @brief The whole simulated transient has been fed
+	 */
+	void EndOfStream(){ end_of_stream = true; }
+
+	/**
+	 * @brief Checks a punctual error (shared with the non streaming analysis)
+	 *
+	 * @param magnitude simulated magnitude
+	 * @param currentGoldenValue
+	 * @param currentMetricError
+	 * @param absErrorMargin
+	 * @return true if there is an error
+	 */
+	static bool CheckError( const Magnitude& magnitude, const double& currentGoldenValue,
+		const double& currentMetricError, const double& absErrorMargin );
+
+	/// no further sample can change the result: error found or end of the comparison
+	bool get_decided() const { return ( metric_error && stop_at_first_error ) || finished || interpolation_error; }
+	/// false to compare the whole transient after the first error (error statistics)
+	void set_stop_at_first_error( const bool stop_at_first_error ){ this->stop_at_first_error = stop_at_first_error; }
+	bool get_finished() const { return finished; }
+	bool get_metric_error() const { return metric_error; }
+	bool get_interpolation_error() const { return interpolation_error; }
+	/// the simulation did not reach the analyzable window
+	bool get_started() const { return started; }
+	bool get_valid_golden_window() const { return valid_golden_window; }
+	/// time of the first detected error
+	double get_first_error_time() const { return first_error_time; }
+	double get_max_abs_error() const { return max_abs_error; }
+	double get_max_abs_error_global() const { return max_abs_error_global; }
+	double get_max_error_margin_ratio() const { return max_error_margin_ratio; }
+	unsigned int get_samples_count() const { return samples_count; }
+	/// last simulated time is the simulation final time
+	bool get_end_of_stream() const { return end_of_stream; }
+	double get_last_simulated_time() const { return last_simulated_time; }
+	const std::string& get_interpolation_error_message() const { return interpolation_error_message; }
+
+private:
+	const Magnitude& simulated_magnitude;
+	/// simulated magnitude margins
+	MarginEnvelope margin_envelope;
+	// golden trace set columns
+	const double* golden_times;
+	const double* golden_values;
+	unsigned int golden_points;
+	/// classified golden samples, nullptr if classified on the fly
+	const unsigned char* golden_bands;
+	// golden analysis window
+	bool analyze_in_time_window;
+	double analyzable_time_window_t0;
+	double analyzable_time_window_tf;
+	bool valid_golden_window;
+	// merge state
+	unsigned int golden_index;
+	unsigned int samples_count;
+	bool started;
+	bool finished;
+	bool end_of_stream;
+	double back_time;
+	double back_simulated_value;
+	double back_golden_value;
+	double last_simulated_time;
+	// errors
+	bool metric_error;
+	bool on_going_error;
+	double error_init;
+	double first_error_time;
+	double max_abs_error;
+	double max_abs_error_global;
+	double max_error_margin_ratio;
+	bool stop_at_first_error;
+	bool interpolation_error;
+	std::string interpolation_error_message;
+
+	/**
+	 * @brief Analyzes the error at the current (merged) time
+	 */
+	void AnalyzeCurrentPoint( const double currentTime,
+		const double currentSimulatedValue, const double currentGoldenValue, const unsigned char band );
+
+	unsigned char GetGoldenBand( const unsigned int goldenIndex ) const {
+		return golden_bands!=nullptr ? golden_bands[goldenIndex]
+			: margin_envelope.ClassifyValue( golden_values[goldenIndex] );
+	}
+
+	double InterpolateValue( const double x1, const double x2,
+		const double y1, const double y2, const double a );
+};
+
+#endif /* MAGNITUDE_COMPARATOR_H */
@@ -0,0 +1,53 @@
+/**
+ * @file margin_envelope.cpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * MarginEnvelope Class Body
+ *
+ */
+
+// c++ std libraries
+#include <limits>
+// Radiation simulator
+#include "margin_envelope.hpp"
+
+MarginEnvelope::MarginEnvelope( const Magnitude& magnitude ){
+	this->error_threshold_ones = magnitude.get_error_threshold_ones();
+	this->error_threshold_zeros = magnitude.get_error_threshold_zeros();
+	const double kOmmitedMargin = std::numeric_limits<double>::infinity();
+	this->abs_error_margins[kDefaultBand] = magnitude.get_abs_error_margin_default();
+	this->abs_error_margins[kOnesBand] = magnitude.get_ommit_upper_threshold() ? kOmmitedMargin
+		: magnitude.get_abs_error_margin_ones();
+	this->abs_error_margins[kZerosBand] = magnitude.get_ommit_lower_threshold() ? kOmmitedMargin
+		: magnitude.get_abs_error_margin_zeros();
+	this->error_time_spans[kDefaultBand] = magnitude.get_error_time_span_default();
+	this->error_time_spans[kOnesBand] = magnitude.get_error_time_span_ones();
+	this->error_time_spans[kZerosBand] = magnitude.get_error_time_span_zeros();
+}
+
+MarginEnvelope::~MarginEnvelope(){
+}
+
+void MarginEnvelope::ClassifySamples( const double* values, const unsigned int points ){
+	bands.resize( points );
+	for( unsigned int i=0; i<points; ++i ){
+		bands[i] = ClassifyValue( values[i] );
+	}
+}
+
+bool MarginEnvelope::Matches( const Magnitude& magnitude ) const{
+	MarginEnvelope magnitudeEnvelope( magnitude );
+	for( unsigned int b=kDefaultBand; b<=kZerosBand; ++b ){
+		if( abs_error_margins[b]!=magnitudeEnvelope.abs_error_margins[b]
+			|| error_time_spans[b]!=magnitudeEnvelope.error_time_spans[b] ){
+			return false;
+		}
+	}
+	return error_threshold_ones==magnitudeEnvelope.error_threshold_ones
+		&& error_threshold_zeros==magnitudeEnvelope.error_threshold_zeros;
+}
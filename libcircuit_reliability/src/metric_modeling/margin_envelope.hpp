@@ -0,0 +1,82 @@
+/**
+ * @file margin_envelope.hpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * Error margin classification of a golden magnitude.
+ * Each golden value falls in the 'ones', 'zeros' or default band
+ * (get_error_threshold_ones/zeros), which selects the abs error margin and
+ * the error time span. The band of every golden sample only depends on the
+ * golden trace, so it is classified once and shared by every altered
+ * simulation compared against it. Interpolated golden values are
+ * classified on the fly.
+ * The ommited bands have an infinite margin: 'error > margin' is the
+ * MagnitudeComparator::CheckError result.
+ *
+ */
+
+#ifndef MARGIN_ENVELOPE_H
+#define MARGIN_ENVELOPE_H
+
+// c++ std libraries
+#include <vector>
+// Radiation simulator
+#include "magnitude.hpp"
+
+class MarginEnvelope {
+public:
+	/// golden value bands
+	enum MarginBand { kDefaultBand = 0, kOnesBand = 1, kZerosBand = 2 };
+
+	/**
+	 * @brief Constructor, the samples are not classified
+	 *
+	 * @param magnitude error margins, time spans and thresholds
+	 */
+	MarginEnvelope( const Magnitude& magnitude );
+	virtual ~MarginEnvelope();
+
+	/**
+	 * @brief Classifies the golden samples
+	 *
+	 * @param values golden values
+	 * @param points
+	 */
+	void ClassifySamples( const double* values, const unsigned int points );
+
+	/**
+	 * @brief Whether the envelope applies to a magnitude
+	 *
+	 * @param magnitude simulated magnitude
+	 * @return true if margins, time spans and thresholds are the same
+	 */
+	bool Matches( const Magnitude& magnitude ) const;
+
+	unsigned char ClassifyValue( const double value ) const {
+		return value > error_threshold_ones ? kOnesBand
+			: ( value < error_threshold_zeros ? kZerosBand : kDefaultBand );
+	}
+
+	/// band of the classified samples, nullptr if not classified
+	const unsigned char* get_bands() const { return bands.empty() ? nullptr : bands.data(); }
+	unsigned int get_points_count() const { return bands.size(); }
+	/// infinite if the band is ommited
+	double get_abs_error_margin( const unsigned char band ) const { return abs_error_margins[band]; }
+	double get_error_time_span( const unsigned char band ) const { return error_time_spans[band]; }
+
+private:
+	// classified from
+	double error_threshold_ones;
+	double error_threshold_zeros;
+	// [MarginBand]
+	double abs_error_margins[3];
+	double error_time_spans[3];
+	/// [golden sample] MarginBand
+	std::vector<unsigned char> bands;
+};
+
+#endif /* MARGIN_ENVELOPE_H */
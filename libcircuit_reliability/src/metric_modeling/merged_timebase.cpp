@@ -0,0 +1,236 @@
+/**
+ * @file merged_timebase.cpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * MergedTimebase Class Body
+ *
+ */
+
+// c++ std libraries
+#include <cmath>
+#include <algorithm>
+// Radiation simulator
+#include "merged_timebase.hpp"
+
+MergedTimebase::MergedTimebase(){
+	this->golden_time = nullptr;
+	this->simulated_time = nullptr;
+	this->golden_points = 0;
+	this->simulated_points = 0;
+	this->built = false;
+	this->valid = false;
+	this->analyze_in_time_window = false;
+	this->analyzable_time_window_t0 = 0;
+	this->analyzable_time_window_tf = 0;
+	this->golden_first = 0;
+	this->simulated_first = 0;
+}
+
+MergedTimebase::~MergedTimebase(){
+}
+
+bool MergedTimebase::Build( const Magnitude& goldenTime, const Magnitude& simulatedTime,
+	const Magnitude& goldenMagnitude ){
+	// same axes and window, reuse the merge
+	if( built && golden_time==goldenTime.get_values() && simulated_time==simulatedTime.get_values()
+		&& golden_points==goldenTime.get_values_size() && simulated_points==simulatedTime.get_values_size()
+		&& analyze_in_time_window==goldenMagnitude.get_analyze_error_in_time_window()
+		&& ( !analyze_in_time_window
+			|| ( analyzable_time_window_t0==goldenMagnitude.get_analyzable_time_window_t0()
+				&& analyzable_time_window_tf==goldenMagnitude.get_analyzable_time_window_tf() ) ) ){
+		return valid;
+	}
+	built = true;
+	golden_time = goldenTime.get_values();
+	simulated_time = simulatedTime.get_values();
+	golden_points = goldenTime.get_values_size();
+	simulated_points = simulatedTime.get_values_size();
+	analyze_in_time_window = goldenMagnitude.get_analyze_error_in_time_window();
+	analyzable_time_window_t0 = goldenMagnitude.get_analyzable_time_window_t0();
+	analyzable_time_window_tf = goldenMagnitude.get_analyzable_time_window_tf();
+	valid = golden_points>=2 && simulated_points>=2
+		&& Merge( golden_time, golden_points, simulated_time, simulated_points );
+	return valid;
+}
+
+bool MergedTimebase::Merge( const double* goldenTime, const unsigned int goldenPoints,
+	const double* simulatedTime, const unsigned int simulatedPoints ){
+	times.clear();
+	types.clear();
+	golden_indexes.clear();
+	simulated_indexes.clear();
+	interpolation_offsets.clear();
+	interpolation_widths.clear();
+	// First step omitted (time=0.0)
+	unsigned int g = 1;
+	unsigned int s = 1;
+	if( analyze_in_time_window ){
+		while( g<goldenPoints && goldenTime[g]<analyzable_time_window_t0 ){
+			++g;
+		}
+		while( s<simulatedPoints && simulatedTime[s]<analyzable_time_window_t0 ){
+			++s;
+		}
+		if( g==goldenPoints || s==simulatedPoints ){
+			return false;
+		}
+	}
+	golden_first = g;
+	simulated_first = s;
+	times.reserve( goldenPoints - g + simulatedPoints - s );
+	double backTime = std::min( goldenTime[g], simulatedTime[s] );
+	while( g<goldenPoints && s<simulatedPoints ){
+		if( analyze_in_time_window
+			&& ( goldenTime[g]>analyzable_time_window_tf || simulatedTime[s]>analyzable_time_window_tf ) ){
+			break;
+		}
+		double currentTime;
+		double interpolatedTime;
+		unsigned char type;
+		golden_indexes.push_back( g );
+		simulated_indexes.push_back( s );
+		if( goldenTime[g]==simulatedTime[s] ){
+			currentTime = goldenTime[g++];
+			++s;
+			interpolatedTime = currentTime;
+			type = kBothSamples;
+		}else if( goldenTime[g]<simulatedTime[s] ){
+			currentTime = goldenTime[g++];
+			interpolatedTime = simulatedTime[s];
+			type = kSimulatedInterpolated;
+		}else{
+			currentTime = simulatedTime[s++];
+			interpolatedTime = goldenTime[g];
+			type = kGoldenInterpolated;
+		}
+		// interpolation errors are reported by the scalar path
+		if( type!=kBothSamples && ( interpolatedTime<=backTime
+			|| currentTime>interpolatedTime || currentTime<backTime ) ){
+			return false;
+		}
+		times.push_back( currentTime );
+		types.push_back( type );
+		interpolation_offsets.push_back( currentTime - backTime );
+		interpolation_widths.push_back( interpolatedTime - backTime );
+		backTime = currentTime;
+	}
+	return true;
+}
+
+void MergedTimebase::Compare( const Magnitude& goldenMagnitude, const Magnitude& simulatedMagnitude,
+	const MarginEnvelope* goldenEnvelope, comparison_t& comparison ){
+	const unsigned int points = times.size();
+	golden_values.resize( points );
+	simulated_values.resize( points );
+	errors.resize( points );
+	error_margins.resize( points );
+	error_flags.resize( points );
+	error_time_spans.resize( points );
+	// margins of the simulated magnitude, golden samples already classified if the envelope applies
+	MarginEnvelope marginEnvelope( simulatedMagnitude );
+	const unsigned char* goldenBands = nullptr;
+	if( goldenEnvelope!=nullptr && goldenEnvelope->get_points_count()==golden_points
+		&& goldenEnvelope->Matches( simulatedMagnitude ) ){
+		goldenBands = goldenEnvelope->get_bands();
+	}
+	// values along the merged axis, interpolated from the previous merged point
+	const double* goldenSamples = goldenMagnitude.get_values();
+	const double* simulatedSamples = simulatedMagnitude.get_values();
+	double backGoldenValue = goldenSamples[golden_first];
+	double backSimulatedValue = simulatedSamples[simulated_first];
+	for( unsigned int k=0; k<points; ++k ){
+		double currentGoldenValue = goldenSamples[golden_indexes[k]];
+		double currentSimulatedValue = simulatedSamples[simulated_indexes[k]];
+		unsigned char band;
+		if( types[k]==kGoldenInterpolated ){
+			currentGoldenValue = interpolation_offsets[k]*(currentGoldenValue - backGoldenValue)
+				/interpolation_widths[k] + backGoldenValue;
+			band = marginEnvelope.ClassifyValue( currentGoldenValue );
+		}else{
+			if( types[k]==kSimulatedInterpolated ){
+				currentSimulatedValue = interpolation_offsets[k]*(currentSimulatedValue - backSimulatedValue)
+					/interpolation_widths[k] + backSimulatedValue;
+			}
+			band = goldenBands!=nullptr ? goldenBands[golden_indexes[k]]
+				: marginEnvelope.ClassifyValue( currentGoldenValue );
+		}
+		golden_values[k] = backGoldenValue = currentGoldenValue;
+		simulated_values[k] = backSimulatedValue = currentSimulatedValue;
+		error_margins[k] = marginEnvelope.get_abs_error_margin( band );
+		error_time_spans[k] = marginEnvelope.get_error_time_span( band );
+	}
+	// branchless abs-diff/margin pass,
+	// ommited values never exceed their infinite margin (MagnitudeComparator::CheckError)
+	const double* goldenValues = golden_values.data();
+	const double* simulatedValues = simulated_values.data();
+	const double* pErrorMargins = error_margins.data();
+	const double* pErrorTimeSpans = error_time_spans.data();
+	double* pErrors = errors.data();
+	double* pErrorFlags = error_flags.data();
+	for( std::size_t k=0; k<points; ++k ){
+		const double currentMetricError = std::abs( goldenValues[k] - simulatedValues[k] );
+		pErrors[k] = currentMetricError;
+		pErrorFlags[k] = currentMetricError > pErrorMargins[k] ? 1.0 : 0.0;
+	}
+	// max is exact, the lanes can be reduced in any order
+	double maxAbsErrorGlobal[4] = { 0, 0, 0, 0 };
+	std::size_t k = 0;
+	for( ; k+4<=points; k+=4 ){
+		for( unsigned int l=0; l<4; ++l ){
+			maxAbsErrorGlobal[l] = pErrors[k+l]>maxAbsErrorGlobal[l] ? pErrors[k+l] : maxAbsErrorGlobal[l];
+		}
+	}
+	for( ; k<points; ++k ){
+		maxAbsErrorGlobal[0] = pErrors[k]>maxAbsErrorGlobal[0] ? pErrors[k] : maxAbsErrorGlobal[0];
+	}
+	comparison.max_abs_error_global = 0;
+	for( auto const& m : maxAbsErrorGlobal ){
+		if( comparison.max_abs_error_global<m ){
+			comparison.max_abs_error_global = m;
+		}
+	}
+	// distance to the band margins, ommited values (infinite margin) do not count
+	comparison.max_error_margin_ratio = 0;
+	for( std::size_t k=0; k<points; ++k ){
+		const double errorMarginRatio = pErrors[k]>0 ? pErrors[k]/pErrorMargins[k] : 0;
+		if( comparison.max_error_margin_ratio<errorMarginRatio ){
+			comparison.max_error_margin_ratio = errorMarginRatio;
+		}
+	}
+	// error spans: runs of points over the margin
+	comparison.metric_error = false;
+	comparison.first_error_time = 0;
+	comparison.max_abs_error = 0;
+	const bool analyzeErrorInTime = simulatedMagnitude.get_analyze_error_in_time();
+	std::size_t i = 0;
+	while( i<points ){
+		// next span
+		while( i<points && pErrorFlags[i]==0 ){
+			++i;
+		}
+		if( i==points ){
+			break;
+		}
+		// punctual errors, or errors lasting more than the time span
+		const double errorInit = times[i];
+		if( analyzeErrorInTime ){
+			++i;
+		}
+		for( ; i<points && pErrorFlags[i]!=0; ++i ){
+			if( !analyzeErrorInTime || times[i] - errorInit > pErrorTimeSpans[i] ){
+				if( !comparison.metric_error ){
+					comparison.first_error_time = times[i];
+				}
+				comparison.metric_error = true;
+				if( comparison.max_abs_error<pErrors[i] ){
+					comparison.max_abs_error = pErrors[i];
+				}
+			}
+		}
+	}
+}
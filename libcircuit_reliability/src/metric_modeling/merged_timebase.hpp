@@ -0,0 +1,110 @@
+/**
+ * @file merged_timebase.hpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * Two-stage golden vs simulated comparison of the transient magnitudes.
+ * The merge of the golden and simulated time axes of
+ * SpectreSimulation::InterpolateAndAnalyzeMagnitude (sample order and
+ * interpolation terms) only depends on the time axes and the analyzable
+ * window, so it is computed once and shared by the magnitudes.
+ * Each magnitude is then compared along the merged axis: the golden
+ * samples take their error margins from the precomputed golden envelope
+ * (interpolated golden values are classified on the fly), then a
+ * branchless abs-diff/margin pass runs over contiguous arrays (vectorized
+ * by the compiler) followed by a scan of the error spans.
+ * The arithmetic of the scalar path is preserved, results are identical.
+ *
+ */
+
+#ifndef MERGED_TIMEBASE_H
+#define MERGED_TIMEBASE_H
+
+// c++ std libraries
+#include <vector>
+// Radiation simulator
+#include "magnitude.hpp"
+#include "margin_envelope.hpp"
+
+class MergedTimebase {
+public:
+	MergedTimebase();
+	virtual ~MergedTimebase();
+
+	/// result of the comparison of a magnitude
+	struct comparison_t {
+		bool metric_error;
+		double first_error_time;
+		double max_abs_error;
+		double max_abs_error_global;
+		/// max abs error/error margin of the sample band
+		double max_error_margin_ratio;
+	};
+
+	/**
+	 * @brief Merges the golden and simulated time axes
+	 * @details the merge is reused if the analyzable window does not change
+	 *
+	 * @param goldenTime
+	 * @param simulatedTime
+	 * @param goldenMagnitude analyzable time window
+	 * @return false if the scalar path has to be followed (invalid t0 window, interpolation error)
+	 */
+	bool Build( const Magnitude& goldenTime, const Magnitude& simulatedTime,
+		const Magnitude& goldenMagnitude );
+
+	/**
+	 * @brief Compares a magnitude along the merged time axis
+	 *
+	 * @param goldenMagnitude golden values
+	 * @param simulatedMagnitude simulated values, error margins and thresholds
+	 * @param goldenEnvelope classified golden samples, nullptr to classify them
+	 * @param comparison
+	 */
+	void Compare( const Magnitude& goldenMagnitude, const Magnitude& simulatedMagnitude,
+		const MarginEnvelope* goldenEnvelope, comparison_t& comparison );
+
+	unsigned int get_points_count() const { return times.size(); }
+
+private:
+	enum MergedPointType { kBothSamples, kSimulatedInterpolated, kGoldenInterpolated };
+
+	// built from
+	const double* golden_time;
+	const double* simulated_time;
+	unsigned int golden_points;
+	unsigned int simulated_points;
+	bool built;
+	bool valid;
+	bool analyze_in_time_window;
+	double analyzable_time_window_t0;
+	double analyzable_time_window_tf;
+	// first compared samples
+	unsigned int golden_first;
+	unsigned int simulated_first;
+	// merged axis, one entry per compared point
+	std::vector<double> times;
+	std::vector<unsigned char> types;
+	std::vector<unsigned int> golden_indexes;
+	std::vector<unsigned int> simulated_indexes;
+	// interpolation terms: (a - x1) and (x2 - x1)
+	std::vector<double> interpolation_offsets;
+	std::vector<double> interpolation_widths;
+	// per magnitude buffers
+	std::vector<double> golden_values;
+	std::vector<double> simulated_values;
+	std::vector<double> errors;
+	std::vector<double> error_margins;
+	/// 1 if the error is over the margin, double lanes vectorize with any SIMD extension
+	std::vector<double> error_flags;
+	std::vector<double> error_time_spans;
+
+	bool Merge( const double* goldenTime, const unsigned int goldenPoints,
+		const double* simulatedTime, const unsigned int simulatedPoints );
+};
+
+#endif /* MERGED_TIMEBASE_H */
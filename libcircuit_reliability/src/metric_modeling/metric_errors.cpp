@@ -21,6 +21,7 @@ MetricErrors::MetricErrors() {
 	this->has_errors = false;
 	this->max_abs_error= 0;
 	this->max_abs_error_global = 0;
+	this->max_error_margin_ratio = kNotDefinedInt;
 	this->metric_value = kNotDefinedInt;
 	this->transient_magnitude = true;
 }
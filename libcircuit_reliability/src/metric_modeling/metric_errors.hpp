@@ -56,6 +56,14 @@ public:
 	void set_max_abs_error_global( const double max_abs_error_global ){
 		this->max_abs_error_global = max_abs_error_global; }
 
+	/**
+	 * @brief set max_error_margin_ratio
+	 *
+	 * @param max_error_margin_ratio
+	 */
+	void set_max_error_margin_ratio( const double max_error_margin_ratio ){
+		this->max_error_margin_ratio = max_error_margin_ratio; }
+
 	/**
 	 * @brief set has_errors
 	 *
@@ -88,6 +96,12 @@ public:
 	 */
 	double get_max_abs_error_global() const { return max_abs_error_global; }
 
+	/**
+	 * @brief gets max_error_margin_ratio
+	 * @return max_error_margin_ratio, kNotDefinedInt if the whole transient was not compared
+	 */
+	double get_max_error_margin_ratio() const { return max_error_margin_ratio; }
+
 	/**
 	 * @brief gets metric_value
 	 * @return metric_value
@@ -126,6 +140,9 @@ private:
 	/// max error in user metric error
 	/// if no-punctual-mode is defined in the metric, then not considering punctual errors
 	double max_abs_error;
+	/// max abs error/error margin of the sample band (ones, zeros or default),
+	/// ommited thresholds excluded. >1 if a sample exceeds its margin
+	double max_error_margin_ratio;
 	/// metric name
 	std::string metric_name;
 	/// metric has_errors
@@ -20,8 +20,8 @@
 
 NDMetricsStructure::NDMetricsStructure() {
 	this->group_name = kNotDefinedString;
-	this->metrics_structure = nullptr;
-	this->files_structure = nullptr;
+	this->metrics_structure = new std::vector<std::vector<Metric*>*>();
+	this->files_structure = new std::vector<std::string>();
 	this->valid_useful_metric_vectors = false;
 	// useful metric_vectors
 	analyzable_metrics_vector = new std::vector<Metric*>();
@@ -29,78 +29,68 @@ NDMetricsStructure::NDMetricsStructure() {
 	plottable_metrics_vector = new std::vector<Magnitude*>();
 }
 
-NDMetricsStructure::NDMetricsStructure(const NDMetricsStructure& orig) {
-	this->group_name = orig.group_name;
-	/// copying the 2D structure
-	/// [nd_index][MetricCount]
-	metrics_structure = new std::vector<std::vector<Metric*>*>();
-	// useful metric_vectors
-	analyzable_metrics_vector = new std::vector<Metric*>();
-	ocean_eval_metrics_vector = new std::vector<OceanEvalMetric*>();
-	plottable_metrics_vector = new std::vector<Magnitude*>();
-	// reserve memory
-	metrics_structure->reserve( orig.metrics_structure->size() );
-	unsigned int magCount = orig.metrics_structure->front()->size();
-	//debug
-	unsigned int msCount = 0;
-	for( auto const& ms : *(orig.metrics_structure) ){
-		if( ms==nullptr ){
-			std::cout << "[Copying NDMetricsStructure] ERROR, null ms for index" << msCount << "\n";
-			std::clog << "[Copying NDMetricsStructure] ERROR, null ms for index" << msCount << "\n";
-			std::cerr << "[Copying NDMetricsStructure] ERROR, null ms for index" << msCount << "\n";
-		}
-		std::vector<Metric*>* mv = new std::vector<Metric*>();
-		// reserve memory
-		mv->reserve( magCount );
-		deepCopyVectorOfInheritancePointers( *ms, *mv );
-		metrics_structure->push_back( mv );
-		// debug
-		++msCount;
-	}
-	/// copying the 2D structure
-	files_structure = new std::vector<std::string>();
-	// reserve memory
-	files_structure->reserve( orig.files_structure->size() );
-	for( auto const& f : *(orig.files_structure) ){
-		files_structure->push_back( std::string( f ) );
-	}
-	// subvectors
-	this->valid_useful_metric_vectors = CreateUsefulMetricVectors();
-}
-
 NDMetricsStructure::~NDMetricsStructure(){
 	#ifdef DESTRUCTORS_VERBOSE
 	std::cout << "Deleting NDMetricsStructure metrics\n";
 	#endif
-	/// deleting the 2D structure
-	for( auto const& ms : *metrics_structure ){
+	/// deleting the 2D structure, shared vectors only once
+	for( auto const& ms : owned_metrics_vectors ){
 		deleteContentsOfVectorOfPointers( *ms );
+		delete ms;
+	}
+	delete metrics_structure;
+	for( auto const& me : metrics_margin_envelopes ){
+		deleteContentsOfVectorOfPointers( *me.second );
+		delete me.second;
 	}
 	#ifdef DESTRUCTORS_VERBOSE
 	std::cout << "Deleting NDMetricsStructure files_structure\n";
 	#endif
 	/// deleting the 1D structure
-	files_structure->clear();
+	delete files_structure;
+	// useful metric_vectors, contents not owned
+	delete analyzable_metrics_vector;
+	delete ocean_eval_metrics_vector;
+	delete plottable_metrics_vector;
 }
 
-void NDMetricsStructure::SimpleInitialization( const unsigned int totalIndexes,
-	std::vector<Metric*>& simpleMetricsVector, std::string goldenFilePath ) {
-	metrics_structure = new std::vector<std::vector<Metric*>*>();
-	files_structure = new std::vector<std::string>();
-	// reserve memory
+void NDMetricsStructure::ReserveProfiles( const unsigned int totalIndexes ){
 	metrics_structure->reserve( totalIndexes );
 	files_structure->reserve( totalIndexes );
+	margin_envelopes_structure.reserve( totalIndexes );
+}
+
+void NDMetricsStructure::AddProfileMetrics( std::vector<Metric*>* metrics,
+	const std::string& filePath, const bool adopt ){
+	metrics_structure->push_back( metrics );
+	files_structure->push_back( filePath );
+	if( adopt ){
+		owned_metrics_vectors.push_back( metrics );
+	}
+	// golden margin envelopes, classified once per metrics vector
+	auto itEnvelopes = metrics_margin_envelopes.find( metrics );
+	if( itEnvelopes==metrics_margin_envelopes.end() ){
+		auto envelopes = new std::vector<MarginEnvelope*>();
+		envelopes->reserve( metrics->size() );
+		for( auto const& m : *metrics ){
+			envelopes->push_back( CreateMarginEnvelope( m ) );
+		}
+		itEnvelopes = metrics_margin_envelopes.emplace( metrics, envelopes ).first;
+	}
+	margin_envelopes_structure.push_back( itEnvelopes->second );
+	// first profile, the only one used by the useful metric vectors
+	if( metrics_structure->size()==1 ){
+		this->valid_useful_metric_vectors = CreateUsefulMetricVectors();
+	}
+}
+
+void NDMetricsStructure::SimpleInitialization( const unsigned int totalIndexes,
+	std::vector<Metric*>* simpleMetricsVector, std::string goldenFilePath ) {
+	// reserve memory
+	ReserveProfiles( totalIndexes );
 	for(unsigned i=0; i<totalIndexes; ++i){
-		std::vector<Metric*>* mv = new std::vector<Metric*>();
-		// reserve memory
-		mv->reserve( simpleMetricsVector.size() );
-		deepCopyVectorOfInheritancePointers( simpleMetricsVector, *mv );
-		metrics_structure->push_back( mv );
-		// file set_files_structure
-		files_structure->push_back( goldenFilePath );
-	}
-	// subvectors
-	this->valid_useful_metric_vectors = CreateUsefulMetricVectors();
+		AddProfileMetrics( simpleMetricsVector, goldenFilePath, i==0 );
+	}
 }
 
 unsigned int NDMetricsStructure::GetTotalElementsLength(){
@@ -113,7 +103,10 @@ void NDMetricsStructure::AddMetric( Metric* metric, const unsigned int index ){
 		std::cerr << "Accessing NDMetricsStructure metrics_structure, index: " << index << " size: " <<  metrics_structure->size() << "\n";
 	}
 	metrics_structure->at(index)->push_back( metric );
-	this->valid_useful_metric_vectors = false;
+	margin_envelopes_structure.at(index)->push_back( CreateMarginEnvelope( metric ) );
+	if( index==0 ){
+		this->valid_useful_metric_vectors = CreateUsefulMetricVectors();
+	}
 }
 
 std::vector<Metric*>* NDMetricsStructure::GetMetricsVector( const unsigned int index ){
@@ -139,20 +132,33 @@ std::string NDMetricsStructure::GetFilePath( const unsigned int index ){
 	return files_structure->at(index);
 }
 
-bool NDMetricsStructure::CreateUsefulMetricVectors() const{
-	// clear, do not delete contents
-	if( analyzable_metrics_vector!=nullptr ){
-		analyzable_metrics_vector->clear();
+const MarginEnvelope* NDMetricsStructure::GetMarginEnvelope( const unsigned int index,
+	const unsigned int metricIndex ) const{
+	if( index>=margin_envelopes_structure.size()
+		|| metricIndex>=margin_envelopes_structure.at(index)->size() ){
+		return nullptr;
 	}
-	if( plottable_metrics_vector!=nullptr ){
-		plottable_metrics_vector->clear();
+	return margin_envelopes_structure.at(index)->at(metricIndex);
+}
+
+MarginEnvelope* NDMetricsStructure::CreateMarginEnvelope( Metric* metric ){
+	if( !metric->get_analyzable() || !metric->is_transient_magnitude() ){
+		return nullptr;
 	}
-	if( ocean_eval_metrics_vector!=nullptr ){
-		ocean_eval_metrics_vector->clear();
+	auto pMag = static_cast<Magnitude*>(metric);
+	if( pMag->get_values()==nullptr ){
+		return nullptr;
 	}
-	analyzable_metrics_vector = new std::vector<Metric*>();
-	plottable_metrics_vector = new std::vector<Magnitude*>();
-	ocean_eval_metrics_vector = new std::vector<OceanEvalMetric*>();
+	auto envelope = new MarginEnvelope( *pMag );
+	envelope->ClassifySamples( pMag->get_values(), pMag->get_values_size() );
+	return envelope;
+}
+
+bool NDMetricsStructure::CreateUsefulMetricVectors(){
+	// clear, do not delete contents
+	analyzable_metrics_vector->clear();
+	plottable_metrics_vector->clear();
+	ocean_eval_metrics_vector->clear();
 	if( metrics_structure->size()<=0 ){
 		std::cout << "[ERROR] NDMetricsStructure metrics_structure is null or empty\n";
 		std::cerr << "[ERROR] NDMetricsStructure metrics_structure is null or empty\n";
@@ -179,36 +185,27 @@ bool NDMetricsStructure::CreateUsefulMetricVectors() const{
 
 std::vector<Metric*>* NDMetricsStructure::GetBasicAnalyzableMetricsVector() const{
 	if( !valid_useful_metric_vectors ){
-		if( !CreateUsefulMetricVectors() ){
-			std::cout << "[ERROR] Called from NDMetricsStructure::GetBasicAnalyzableMetricsVector\n";
-			std::cerr << "[ERROR] Called from NDMetricsStructure::GetBasicAnalyzableMetricsVector\n";
-			return nullptr;
-		}
-		valid_useful_metric_vectors = true;
+		std::cout << "[ERROR] Called from NDMetricsStructure::GetBasicAnalyzableMetricsVector\n";
+		std::cerr << "[ERROR] Called from NDMetricsStructure::GetBasicAnalyzableMetricsVector\n";
+		return nullptr;
 	}
 	return analyzable_metrics_vector;
 }
 
 std::vector<OceanEvalMetric*>* NDMetricsStructure::GetBasicOceanEvalMetricsVector() const{
 	if( !valid_useful_metric_vectors ){
-		if( !CreateUsefulMetricVectors() ){
-			std::cout << "[ERROR] Called from NDMetricsStructure::GetBasicOceanEvalMetricsVector\n";
-			std::cerr << "[ERROR] Called from NDMetricsStructure::GetBasicOceanEvalMetricsVector\n";
-			return nullptr;
-		}
-		valid_useful_metric_vectors = true;
+		std::cout << "[ERROR] Called from NDMetricsStructure::GetBasicOceanEvalMetricsVector\n";
+		std::cerr << "[ERROR] Called from NDMetricsStructure::GetBasicOceanEvalMetricsVector\n";
+		return nullptr;
 	}
 	return ocean_eval_metrics_vector;
 }
 
 std::vector<Magnitude*>* NDMetricsStructure::GetBasicPlottableMetricsVector() const{
 	if( !valid_useful_metric_vectors ){
-		if( !CreateUsefulMetricVectors() ){
-			std::cout << "[ERROR] Called from NDMetricsStructure::GetBasicPlottableMetricsVector\n";
-			std::cerr << "[ERROR] Called from NDMetricsStructure::GetBasicPlottableMetricsVector\n";
-			return nullptr;
-		}
-		valid_useful_metric_vectors = true;
+		std::cout << "[ERROR] Called from NDMetricsStructure::GetBasicPlottableMetricsVector\n";
+		std::cerr << "[ERROR] Called from NDMetricsStructure::GetBasicPlottableMetricsVector\n";
+		return nullptr;
 	}
 	return plottable_metrics_vector;
 }
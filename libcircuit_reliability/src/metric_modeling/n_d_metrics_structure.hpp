@@ -8,6 +8,11 @@
  * @section DESCRIPTION
  *
  * This Class acts as simulations container.
+ * The golden metrics store is shared (not copied) by every simulation:
+ * once filled, it is read-only and can be read from any worker thread.
+ * Profiles with the same golden results share a single metrics vector.
+ * The error margin bands of the golden magnitudes (MarginEnvelope) are
+ * classified when the profile metrics are added, once per metrics vector.
  *
  */
 
@@ -17,17 +22,20 @@
 // c++ std libraries
 // #include <string>
 // #include <vector>
+#include <map>
 // Radiation simulator
 #include "metric.hpp"
 #include "magnitude.hpp"
 #include "ocean_eval_metric.hpp"
+#include "margin_envelope.hpp"
 
 class NDMetricsStructure {
 public:
 	/// default constructor
 	NDMetricsStructure();
-	/// copy constructor
-	NDMetricsStructure(const NDMetricsStructure& orig);
+	/// the store is shared, not copied
+	NDMetricsStructure(const NDMetricsStructure& orig) = delete;
+	NDMetricsStructure& operator=(const NDMetricsStructure& orig) = delete;
 
 	virtual ~NDMetricsStructure();
 
@@ -59,6 +67,15 @@ public:
 	 */
 	std::vector<Magnitude*>* GetBasicPlottableMetricsVector() const;
 
+	/**
+	 * @brief gets the classified golden samples of a magnitude
+	 *
+	 * @param nd_index profile
+	 * @param metricIndex index in the profile metrics vector
+	 * @return envelope, nullptr if the metric is not an analyzable magnitude
+	 */
+	const MarginEnvelope* GetMarginEnvelope( const unsigned int nd_index, const unsigned int metricIndex ) const;
+
 	/**
 	 * @brief gets the path to the golden result file
 	 * @return path to the golden result file
@@ -75,22 +92,20 @@ public:
 	}
 
 	/**
-	 * @brief sets metrics_structure
+	 * @brief Appends the metrics of the next profile (nd_index)
 	 *
-	 * @param metrics_structure
+	 * @param metrics profile metrics, can be shared by several profiles
+	 * @param filePath path to the golden result file
+	 * @param adopt whether the store deletes the metrics vector
 	 */
-	void set_metrics_structure( std::vector<std::vector<Metric*>*>* metrics_structure ){
-		this->metrics_structure = metrics_structure;
-	}
+	void AddProfileMetrics( std::vector<Metric*>* metrics, const std::string& filePath, const bool adopt );
 
 	/**
-	 * @brief sets files_structure
+	 * @brief Reserves memory for the profiles
 	 *
-	 * @param files_structure
+	 * @param totalIndexes
 	 */
-	void set_files_structure( std::vector<std::string>* files_structure ){
-		this->files_structure = files_structure;
-	}
+	void ReserveProfiles( const unsigned int totalIndexes );
 
 	/**
 	 * @brief gets group_name
@@ -106,14 +121,14 @@ public:
 	void AddMetric( Metric* metric, const unsigned int nd_index );
 
 	/**
-	 * @brief Inits structure
+	 * @brief Inits structure, every index sharing the same metrics
 	 *
-	 * @param parameterCount
-	 * @param sweepCount
-	 * @param simpleMetricsVector
+	 * @param totalIndexes
+	 * @param simpleMetricsVector adopted by the store
+	 * @param goldenFilePath
 	 */
 	void SimpleInitialization(  const unsigned int totalIndexes,
-		std::vector<Metric*>& simpleMetricsVector, std::string goldenFilePath  );
+		std::vector<Metric*>* simpleMetricsVector, std::string goldenFilePath  );
 
 	/**
 	 * @brief returns elements size
@@ -130,13 +145,27 @@ private:
 	/// files_structure where the metrics are stored
 	/// [nd_index]
 	std::vector<std::string>* files_structure;
-	// to increase performance
-	mutable std::vector<Metric*>* analyzable_metrics_vector;
-	mutable std::vector<Magnitude*>* plottable_metrics_vector;
-	mutable std::vector<OceanEvalMetric*>* ocean_eval_metrics_vector;
-	mutable bool valid_useful_metric_vectors{false};
+	/// metrics vectors deleted by the store, once each
+	std::vector<std::vector<Metric*>*> owned_metrics_vectors;
+	/// golden margin envelopes, [nd_index][MetricCount]
+	std::vector<std::vector<MarginEnvelope*>*> margin_envelopes_structure;
+	/// envelopes of each metrics vector, shared by the profiles
+	std::map<const std::vector<Metric*>*, std::vector<MarginEnvelope*>*> metrics_margin_envelopes;
+	// to increase performance, created when the first profile is added
+	std::vector<Metric*>* analyzable_metrics_vector;
+	std::vector<Magnitude*>* plottable_metrics_vector;
+	std::vector<OceanEvalMetric*>* ocean_eval_metrics_vector;
+	bool valid_useful_metric_vectors;
+
+	bool CreateUsefulMetricVectors();
 
-	bool CreateUsefulMetricVectors() const;
+	/**
+	 * @brief Classifies the golden samples of an analyzable magnitude
+	 *
+	 * @param metric
+	 * @return envelope, nullptr if not required
+	 */
+	MarginEnvelope* CreateMarginEnvelope( Metric* metric );
 };
 
 #endif /* N_D_METRICS_STRUCTURE_H */
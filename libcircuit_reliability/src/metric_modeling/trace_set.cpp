@@ -0,0 +1,56 @@
+/**
+ * @file trace_set.cpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * TraceSet Class Body
+ *
+ */
+
+// c++ std libraries
+#include <algorithm>
+// Radiation simulator
+#include "trace_set.hpp"
+
+TraceSet::TraceSet( const unsigned int signalsCount, const unsigned int expectedPoints ){
+	this->signals_count = signalsCount;
+	this->points_count = 0;
+	this->points_capacity = 0;
+	Reserve( expectedPoints );
+}
+
+TraceSet::~TraceSet(){
+}
+
+void TraceSet::Reserve( const unsigned int expectedPoints ){
+	if( expectedPoints<=points_capacity ){
+		return;
+	}
+	if( points_count==0 ){
+		samples.assign( static_cast<std::size_t>(signals_count)*expectedPoints, 0 );
+	}else{
+		// relocate the columns
+		std::vector<double> reservedSamples( static_cast<std::size_t>(signals_count)*expectedPoints );
+		for( unsigned int s=0; s<signals_count; ++s ){
+			std::copy( get_signal(s), get_signal(s) + points_count,
+				reservedSamples.begin() + static_cast<std::size_t>(s)*expectedPoints );
+		}
+		samples.swap( reservedSamples );
+	}
+	points_capacity = expectedPoints;
+}
+
+void TraceSet::AddRow( const double* row ){
+	if( points_count==points_capacity ){
+		Reserve( std::max( 2*points_capacity, 1024u ) );
+	}
+	double* sample = samples.data() + points_count;
+	for( unsigned int s=0; s<signals_count; ++s, sample+=points_capacity ){
+		*sample = row[s];
+	}
+	++points_count;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file trace_set.hpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * Columnar storage of the transient traces of a simulation.
+ * Signal 0 is the time axis shared by every signal. The samples are
+ * stored in a single signal-major matrix (one contiguous column per
+ * signal), while the magnitudes keep the metadata (names, margins...)
+ * and a view of their column.
+ *
+ */
+
+#ifndef TRACE_SET_H
+#define TRACE_SET_H
+
+// c++ std libraries
+#include <vector>
+
+class TraceSet {
+public:
+	/**
+	 * @brief Constructor
+	 *
+	 * @param signalsCount number of signals, time included
+	 * @param expectedPoints initial capacity of each column
+	 */
+	TraceSet( const unsigned int signalsCount, const unsigned int expectedPoints );
+	virtual ~TraceSet();
+
+	/**
+	 * @brief Reserves the columns capacity
+	 * @details columns are relocated if the capacity grows
+	 *
+	 * @param expectedPoints
+	 */
+	void Reserve( const unsigned int expectedPoints );
+
+	/**
+	 * @brief Appends a sample of every signal
+	 *
+	 * @param row values of the signals, time first
+	 */
+	void AddRow( const double* row );
+
+	unsigned int get_signals_count() const { return signals_count; }
+	unsigned int get_points_count() const { return points_count; }
+
+	/// shared time axis
+	const double* get_time() const { return samples.data(); }
+	const double* get_signal( const unsigned int signal ) const {
+		return samples.data() + signal*points_capacity; }
+
+private:
+	unsigned int signals_count;
+	unsigned int points_count;
+	unsigned int points_capacity;
+	/// signal-major matrix, signals_count columns of points_capacity samples
+	std::vector<double> samples;
+};
+
+#endif /* TRACE_SET_H */
@@ -11,16 +11,21 @@
 #include "../global_functions_and_constants/global_constants.hpp"
 
 AlteredScenarioSummary::AlteredScenarioSummary( int altered_scenario_id,
-	std::string altered_scenario_folder_path, std::string altered_scenario_altered_element_path ) {
+	std::string altered_scenario_folder_path, std::string altered_scenario_altered_element_path,
+	std::string altered_scenario_structural_key ) {
 	this->altered_scenario_id = altered_scenario_id;
 	this->altered_scenario_folder_path = altered_scenario_folder_path;
 	this->altered_scenario_altered_element_path = altered_scenario_altered_element_path;
+	this->altered_scenario_structural_key = altered_scenario_structural_key;
+	this->equivalent_scenario_index = kNotDefinedInt;
 }
 
 AlteredScenarioSummary::AlteredScenarioSummary(const AlteredScenarioSummary& orig) {
 	this->altered_scenario_id = orig.altered_scenario_id;
 	this->altered_scenario_folder_path = orig.altered_scenario_folder_path;
 	this->altered_scenario_altered_element_path = orig.altered_scenario_altered_element_path;
+	this->altered_scenario_structural_key = orig.altered_scenario_structural_key;
+	this->equivalent_scenario_index = orig.equivalent_scenario_index;
 }
 
 AlteredScenarioSummary::~AlteredScenarioSummary() {
@@ -15,19 +15,28 @@ class AlteredScenarioSummary {
 public:
 
 	AlteredScenarioSummary( int altered_scenario_id,
-		std::string altered_scenario_folder_path, std::string altered_scenario_altered_element_path );
+		std::string altered_scenario_folder_path, std::string altered_scenario_altered_element_path,
+		std::string altered_scenario_structural_key );
 	AlteredScenarioSummary(const AlteredScenarioSummary& orig);
 	virtual ~AlteredScenarioSummary();
 
 	int get_altered_scenario_id() const {return altered_scenario_id;}
 	std::string get_altered_scenario_folder_path() const {return altered_scenario_folder_path;}
 	std::string get_altered_scenario_altered_element_path() const {return altered_scenario_altered_element_path;}
+	/// Canonical structure of the alteration, equal for electrically equivalent scenarios (empty: not comparable)
+	std::string get_altered_scenario_structural_key() const {return altered_scenario_structural_key;}
+	/// Index of the equivalent scenario simulated instead of this one (kNotDefinedInt: simulated)
+	void set_equivalent_scenario_index( int equivalent_scenario_index ){
+		this->equivalent_scenario_index = equivalent_scenario_index; }
+	int get_equivalent_scenario_index() const {return equivalent_scenario_index;}
 
 private:
 
 	int altered_scenario_id;
 	std::string altered_scenario_folder_path;
 	std::string altered_scenario_altered_element_path;
+	std::string altered_scenario_structural_key;
+	int equivalent_scenario_index;
 };
 
 #endif /* ALTERED_SCENARIO_SUMMARY */
@@ -0,0 +1,56 @@
+/**
+ * @file circuit_overlay.cpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * CircuitOverlay Class Body
+ *
+ */
+
+// radiation simulator includes
+#include "circuit_overlay.hpp"
+
+CircuitOverlay::CircuitOverlay( CircuitStatement& circuit ) : circuit( circuit ){
+}
+
+CircuitOverlay::~CircuitOverlay(){
+	Revert();
+}
+
+void CircuitOverlay::AddIncludeStatement( IncludeStatement* includeStatement ){
+	circuit.AddIncludeStatementAndRegister( includeStatement );
+	changes.push_back( { kIncludeStatementAdded, &circuit, includeStatement, "" } );
+}
+
+void CircuitOverlay::AddStatement( Statement& parent, Statement* statement ){
+	parent.AddStatement( statement );
+	changes.push_back( { kStatementAdded, &parent, statement, "" } );
+}
+
+void CircuitOverlay::SetMasterName( Statement& statement, const std::string& masterName ){
+	changes.push_back( { kMasterNameChanged, nullptr, &statement, statement.get_master_name() } );
+	statement.set_master_name( masterName );
+}
+
+void CircuitOverlay::Revert(){
+	for( auto it_c = changes.rbegin(); it_c != changes.rend(); ++it_c ){
+		switch( it_c->type ){
+			case kIncludeStatementAdded:
+				circuit.RemoveIncludeStatement( (IncludeStatement*) it_c->statement );
+				delete it_c->statement;
+				break;
+			case kStatementAdded:
+				it_c->parent->RemoveStatement( it_c->statement );
+				delete it_c->statement;
+				break;
+			case kMasterNameChanged:
+				it_c->statement->set_master_name( it_c->previous_master_name );
+				break;
+		}
+	}
+	changes.clear();
+}
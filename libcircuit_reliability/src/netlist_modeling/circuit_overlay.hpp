@@ -0,0 +1,88 @@
+/**
+ * @file circuit_overlay.hpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * Alteration applied in place to a circuit of the parsed tree, instead of
+ * altering a deep copy of the circuit:
+ * 		+ statements (injector sources, monitors...) added to a parent
+ * 		+ include statements added to the circuit
+ * 		+ master names changed
+ * The changes are reverted (and the added statements deleted) in reverse
+ * order by Revert or the destructor, leaving the tree as parsed.
+ * The tree must not be traversed with iterators of the altered vectors
+ * while the overlay is applied.
+ *
+ */
+
+#ifndef CIRCUIT_OVERLAY_H
+#define CIRCUIT_OVERLAY_H
+
+// c++ std libraries
+#include <string>
+#include <vector>
+// radiation simulator includes
+#include "statements/statement.hpp"
+#include "statements/circuit_statement.hpp"
+#include "statements/include_statement.hpp"
+
+class CircuitOverlay {
+public:
+	/**
+	 * @brief Default constructor
+	 *
+	 * @param circuit altered circuit
+	 */
+	CircuitOverlay( CircuitStatement& circuit );
+	/// Default destructor, reverts the changes
+	virtual ~CircuitOverlay();
+
+	CircuitStatement& get_circuit() { return circuit; }
+
+	/**
+	 * @brief Adds an include statement to the circuit
+	 *
+	 * @param includeStatement owned by the overlay
+	 */
+	void AddIncludeStatement( IncludeStatement* includeStatement );
+
+	/**
+	 * @brief Adds a statement to a statement of the circuit
+	 *
+	 * @param parent
+	 * @param statement owned by the overlay
+	 */
+	void AddStatement( Statement& parent, Statement* statement );
+
+	/**
+	 * @brief Changes the master name of a statement of the circuit
+	 *
+	 * @param statement
+	 * @param masterName
+	 */
+	void SetMasterName( Statement& statement, const std::string& masterName );
+
+	/// Reverts the changes, in reverse order
+	void Revert();
+
+private:
+	enum ChangeType { kIncludeStatementAdded, kStatementAdded, kMasterNameChanged };
+
+	struct Change {
+		ChangeType type;
+		Statement* parent;
+		Statement* statement;
+		std::string previous_master_name;
+	};
+
+	/// Altered circuit
+	CircuitStatement& circuit;
+	/// Changes applied
+	std::vector<Change> changes;
+};
+
+#endif /* CIRCUIT_OVERLAY_H */
@@ -0,0 +1,116 @@
+/**
+ * @file netlist_lexer.cpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * NetlistLexer Class Body
+ *
+ */
+
+// Radiation simulator
+#include "netlist_lexer.hpp"
+
+NetlistLexer::NetlistLexer(){
+	this->lexable_keywords = false;
+}
+
+NetlistLexer::~NetlistLexer(){
+}
+
+bool NetlistLexer::IsWordChar( const char c ){
+	return ( c>='a' && c<='z' ) || ( c>='A' && c<='Z' ) || ( c>='0' && c<='9' ) || c=='_';
+}
+
+bool NetlistLexer::IsSpaceChar( const char c ){
+	return c==' ' || c=='\t' || c=='\n' || c=='\r' || c=='\v' || c=='\f';
+}
+
+void NetlistLexer::SetKeywords( const std::vector<std::string>& keywords ){
+	this->keywords.clear();
+	this->lexable_keywords = !keywords.empty();
+	for( auto const &k : keywords ){
+		if( k.empty() ){
+			lexable_keywords = false;
+		}
+		for( auto const c : k ){
+			if( !IsWordChar( c ) ){
+				lexable_keywords = false;
+			}
+		}
+		this->keywords.insert( k );
+	}
+}
+
+bool NetlistLexer::MayContainKeyword( const std::string& statementCode ) const{
+	if( !lexable_keywords ){
+		return true;
+	}
+	std::string token;
+	size_t i = 0;
+	const size_t size = statementCode.size();
+	while( i<size ){
+		if( !IsWordChar( statementCode[i] ) ){
+			++i;
+			continue;
+		}
+		size_t tokenStart = i;
+		while( i<size && IsWordChar( statementCode[i] ) ){
+			++i;
+		}
+		token.assign( statementCode, tokenStart, i - tokenStart );
+		if( keywords.find( token )!=keywords.end() ){
+			return true;
+		}
+	}
+	return false;
+}
+
+bool NetlistLexer::MatchWord( const std::string& code, const size_t position, const std::string& word ){
+	// \bword\b
+	if( code.compare( position, word.size(), word )!=0 ){
+		return false;
+	}
+	if( position>0 && IsWordChar( code[position - 1] ) ){
+		return false;
+	}
+	size_t wordEnd = position + word.size();
+	return wordEnd>=code.size() || !IsWordChar( code[wordEnd] );
+}
+
+bool NetlistLexer::TestSimulatorLanguage( const std::string& statementCode, const bool spectreLanguage ){
+	static const std::string simulatorWord = "simulator";
+	static const std::string langWord = "lang";
+	static const std::string spectreWord = "spectre";
+	const size_t size = statementCode.size();
+	size_t position = statementCode.find( simulatorWord );
+	while( position!=std::string::npos ){
+		if( MatchWord( statementCode, position, simulatorWord ) ){
+			size_t i = position + simulatorWord.size();
+			size_t spacesStart = i;
+			while( i<size && IsSpaceChar( statementCode[i] ) ){
+				++i;
+			}
+			if( i>spacesStart && MatchWord( statementCode, i, langWord ) ){
+				i += langWord.size();
+				while( i<size && IsSpaceChar( statementCode[i] ) ){
+					++i;
+				}
+				if( i<size && statementCode[i]=='=' ){
+					++i;
+					while( i<size && IsSpaceChar( statementCode[i] ) ){
+						++i;
+					}
+					if( !spectreLanguage || MatchWord( statementCode, i, spectreWord ) ){
+						return true;
+					}
+				}
+			}
+		}
+		position = statementCode.find( simulatorWord, position + 1 );
+	}
+	return false;
+}
@@ -0,0 +1,70 @@
+/**
+ * @file netlist_lexer.hpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * Single pass scanner of the statement code.
+ * It splits the code in word tokens ([a-zA-Z0-9_]+) and is used before
+ * the statement regular expressions: a statement whose tokens do not
+ * include any of the master names can not match the '\bname\b' alternatives
+ * of the regex, so the regex search is skipped.
+ * It also replaces the 'simulator lang=' regular expressions.
+ *
+ */
+
+#ifndef NETLIST_LEXER_H
+#define NETLIST_LEXER_H
+
+// c++ std libraries
+#include <string>
+#include <vector>
+#include <unordered_set>
+
+class NetlistLexer {
+public:
+	NetlistLexer();
+	virtual ~NetlistLexer();
+
+	/**
+	 * @brief Sets the keywords (master names) looked up in the statements
+	 * @details If any keyword is empty or has non word chars,
+	 * the lexer can not discard statements and MayContainKeyword always returns true
+	 *
+	 * @param keywords
+	 */
+	void SetKeywords( const std::vector<std::string>& keywords );
+
+	/**
+	 * @brief Tests whether any word token of the statement code is a keyword
+	 *
+	 * @param statementCode
+	 * @return false if the statement can not match '\bkeyword\b'
+	 */
+	bool MayContainKeyword( const std::string& statementCode ) const;
+
+	/**
+	 * @brief Equivalent to the regex '\s*\bsimulator\b\s+\blang\b\s*=\s*(\bspectre\b)'
+	 *
+	 * @param statementCode
+	 * @param spectreLanguage the language has to be spectre
+	 * @return true if the statement code contains a language statement
+	 */
+	static bool TestSimulatorLanguage( const std::string& statementCode, const bool spectreLanguage );
+
+	static bool IsWordChar( const char c );
+
+private:
+	/// keywords
+	std::unordered_set<std::string> keywords;
+	/// whether all the keywords are word tokens
+	bool lexable_keywords;
+
+	static bool IsSpaceChar( const char c );
+	static bool MatchWord( const std::string& code, const size_t position, const std::string& word );
+};
+
+#endif /* NETLIST_LEXER_H */
@@ -24,6 +24,9 @@ Scope::Scope(const Scope& orig) {
 	this->altered = orig.altered;
 	this->is_subcircuit_scope = orig.is_subcircuit_scope;
 	deepCopyVectorOfPointers( orig.nodes, nodes);
+	for( auto const &node : nodes ){
+		nodes_by_name.emplace( node->get_name(), node );
+	}
 }
 
 Scope::~Scope() {
@@ -33,13 +36,14 @@ Scope::~Scope() {
 
 void Scope::AddNode(Node* node){
 	nodes.push_back( node );
+	// emplace keeps the first node with that name
+	nodes_by_name.emplace( node->get_name(), node );
 }
 
-Node* Scope::GetNode(std::string node_name){
-	for( auto const &node : nodes){
-		if( node->get_name().compare( node_name )== 0){
-			return node;
-		}
+Node* Scope::GetNode(const std::string& node_name) const{
+	auto const it = nodes_by_name.find( node_name );
+	if( it!=nodes_by_name.end() ){
+		return it->second;
 	}
 	return nullptr;
 }
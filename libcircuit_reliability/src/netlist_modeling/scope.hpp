@@ -12,6 +12,7 @@
 /// c++ std required libraries
 #include <string>
 #include <vector>
+#include <unordered_map>
 /// radiation simulator
 #include "node.hpp"
 
@@ -35,10 +36,12 @@ public:
 	void set_altered(bool altered) { this->altered = altered; }
 	void set_is_subcircuit_scope( bool is_subcircuit_scope ) {
 		this->is_subcircuit_scope = is_subcircuit_scope; }
+	/// Nodes have to be added with AddNode, so they are indexed by name
 	std::vector<Node*>* get_nodes() { return &nodes; }
 
 	void AddNode(Node* node);
-	Node* GetNode(std::string node_name);
+	/// First node added with that name, nullptr if not found
+	Node* GetNode(const std::string& node_name) const;
 
 private:
 	std::string name;
@@ -46,6 +49,8 @@ private:
 	std::string main_statement_name;
 	bool altered;
 	std::vector<Node*> nodes;
+	/// nodes indexed by name (first node added with each name)
+	std::unordered_map<std::string, Node*> nodes_by_name;
 	bool is_subcircuit_scope;
 };
 
@@ -110,6 +110,7 @@ public:
 	 * @param essential_analysis
 	 */
 	void set_essential_analysis( bool essential_analysis ){ this->essential_analysis = essential_analysis; }
+	bool get_essential_analysis() const { return essential_analysis; }
 
 	/**
 	 * @brief Mutes the exportation of all non essential (radiation_simulator) analysis
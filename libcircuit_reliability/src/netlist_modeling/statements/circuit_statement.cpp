@@ -5,6 +5,8 @@
  *  Author: fernando
  */
 
+// c++ std libraries
+#include <algorithm>
 #include "boost/filesystem.hpp"   // includes all needed Boost.Filesystem declarations
 #include <boost/algorithm/string.hpp>
 
@@ -48,6 +50,7 @@ CircuitStatement::CircuitStatement( ) {
 		+ "_"+ number2String(id) + "_scope", name , false );
 	this->belonging_scope = own_scope;
 	this->considerate_dependencies = false;
+	this->defer_global_nodes = false;
 	// Dependency
 	this->scanned_for_instances_dependency = true;
 	this->consider_instances_dependency = false;
@@ -87,6 +90,7 @@ CircuitStatement::CircuitStatement( const bool considerate_dependencies ) {
 		+ "_"+ number2String(id) + "_scope", name , false );
 	this->belonging_scope = own_scope;
 	this->considerate_dependencies = considerate_dependencies;
+	this->defer_global_nodes = false;
 	// Dependency
 	this->scanned_for_instances_dependency = true;
 	this->consider_instances_dependency = false;
@@ -137,6 +141,7 @@ CircuitStatement::CircuitStatement(const CircuitStatement& orig) {
 	// post_parsing_statement_handler
 	this->post_parsing_statement_handler = orig.post_parsing_statement_handler;
 	this->considerate_dependencies = orig.considerate_dependencies;
+	this->defer_global_nodes = false;
 	// Dependency
 	this->scanned_for_instances_dependency = true;
 	this->consider_instances_dependency = false;
@@ -351,6 +356,12 @@ void CircuitStatement::AddIncludeStatementAndRegister( IncludeStatement* stateme
 	referenced_include_statements.push_back( statement );
 }
 
+void CircuitStatement::RemoveIncludeStatement( IncludeStatement* statement ){
+	RemoveStatement( statement );
+	referenced_include_statements.erase( std::remove( referenced_include_statements.begin(),
+		referenced_include_statements.end(), statement ), referenced_include_statements.end() );
+}
+
 void CircuitStatement::AddSimulationSpecialStatement( Statement* statement ){
 	simulation_special_children.push_back( statement );
 }
@@ -358,6 +369,10 @@ void CircuitStatement::AddSimulationSpecialStatement( Statement* statement ){
 // Calls to Experiment environment
 
 void CircuitStatement::AddGlobalNode( Node* node ){
+	if( defer_global_nodes ){
+		deferred_global_nodes.push_back( node );
+		return;
+	}
 	experiment_environment->AddGlobalNode( node );
 }
 
@@ -83,6 +83,17 @@ public:
 	bool get_considerate_dependencies() const {
 		return considerate_dependencies;
 	}
+	/**
+	 * @brief Global nodes are kept in the circuit instead of
+	 * being added to the environment (concurrent parsing)
+	 *
+	 * @param defer_global_nodes
+	 */
+	void set_defer_global_nodes( bool defer_global_nodes ) {
+		this->defer_global_nodes = defer_global_nodes;}
+	std::vector<Node*>* get_deferred_global_nodes() {
+		return &deferred_global_nodes;
+	}
 
 	// Instances in circuit
 	std::vector<CircuitStatement*>* get_referenced_circuit_statements() {
@@ -143,6 +154,8 @@ public:
 		bool& parsingSpectreCode, const bool permissiveParsingMode );
 
 	void AddIncludeStatementAndRegister( IncludeStatement* statement );
+	/// Removes (not deletes) an include statement added with AddIncludeStatementAndRegister
+	void RemoveIncludeStatement( IncludeStatement* statement );
 
 	void AddReferencedIncludeStatement( IncludeStatement* referenced_include_statement );
 	void AddReferencedCircuitStatement( CircuitStatement* referenced_circuit_statement );
@@ -180,6 +193,10 @@ private:
 	PostParsingStatementHandler* post_parsing_statement_handler;
 	/// Considerates dependencies
 	bool considerate_dependencies;
+	/// Global nodes are deferred
+	bool defer_global_nodes;
+	/// Global nodes found while deferred
+	std::vector<Node*> deferred_global_nodes;
 	/// simulation mode children: analysis and control statements
 	std::vector<Statement*> simulation_special_children;
 
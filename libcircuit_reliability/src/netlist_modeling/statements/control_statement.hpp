@@ -36,6 +36,7 @@ public:
 		std::string& currentReadLine, int& statementCount, bool& endOfFile,
 		bool& parsingSpectreCode, const bool permissiveParsingMode  );
 	void set_param_set_case( bool param_set_case){this->param_set_case=param_set_case;}
+	bool get_param_set_case() const { return param_set_case; }
 
 private:
 	bool advanced_control_statement;
@@ -26,6 +26,7 @@ public:
 	bool ParseSimpleStatement( Statement& global_scope_parent, std::string & statementCode, int& statementCount );
 
 	bool get_allows_mute() const{ return allows_mute; }
+	void set_allows_mute( bool allows_mute ){ this->allows_mute = allows_mute; }
 
 private:
 	bool allows_mute;
@@ -193,6 +193,16 @@ void Statement::MuteNonMainTransientAnalysis(){
 	}
 }
 
+/// Overriden in subcircuit statement
+void Statement::ShiftIds( const int offset ){
+	if( id!=kNotDefinedInt ){
+		id += offset;
+	}
+	for( auto const & c : children ){
+		c->ShiftIds( offset );
+	}
+}
+
 Node* Statement::GetNode(const int position){
 	if(has_nodes) {
 		return nodes.at(position);
@@ -240,22 +250,24 @@ bool Statement::ParseParameters(std::string& statementCode, const bool allowUnva
 		log_io->ReportPlain2Log( "parsing parameters: statementCode= '" + statementCode + "'" );
 	#endif
 	std::vector<std::string> paramTokens; //p1=v1->{p1, v1}
-	std::vector<std::string> statementTokens; //...p1=v1...->{..., p1=v1...}
 	std::string paramStatement;
 	// remove 'parameters' word from the begining
 	boost::replace_first( statementCode, "parameters", kEmptyWord);
 	// remove excessive empty lines
 	RemoveExcessiveEmptyLines( statementCode );
-	// apply regex expression
-	std::string usedRegex = kParameterRegExNotUnvalued;
-	if( allowUnvaluedParameters ){
-		usedRegex = kParameterRegEx;
-	}
-	boost::regex ip_regex( usedRegex );
+	// apply regex expression, compiled once (const regex can be shared by threads)
+	static const boost::regex parameter_regex( kParameterRegEx );
+	static const boost::regex parameter_regex_not_unvalued( kParameterRegExNotUnvalued );
+	const boost::regex& ip_regex = allowUnvaluedParameters ? parameter_regex : parameter_regex_not_unvalued;
+	// code before the first parameter
+	size_t statementCodeLength = statementCode.size();
 
 	boost::sregex_iterator it(statementCode.begin(), statementCode.end(), ip_regex);
 	boost::sregex_iterator end;
 	for (; it != end; ++it) {
+		if( statementCodeLength==statementCode.size() ){
+			statementCodeLength = it->position();
+		}
 		paramStatement = it->str();
 		boost::split(paramTokens, paramStatement, boost::is_any_of(kEqualsWord), boost::token_compress_on);
 		if( paramTokens.front().compare("")!=0
@@ -272,8 +284,7 @@ bool Statement::ParseParameters(std::string& statementCode, const bool allowUnva
 		}
 	}
 	//remove parameters subcode in statementcode
-	boost::algorithm::split_regex( statementTokens, statementCode, boost::regex( usedRegex ) ) ;
-	statementCode = statementTokens.front();
+	statementCode.resize( statementCodeLength );
 	boost::algorithm::trim(statementCode);
 	completedStatement = true;
 	return completedStatement;
@@ -531,7 +542,7 @@ void Statement::RemoveExcessiveEmptyLines( std::string& s){
 	// s = result;
 
 	// Using regex_replace
-	boost::regex r("\n+");
+	static const boost::regex r("\n+");
 	s = boost::regex_replace(s,r,"\n");
 }
 
@@ -161,6 +161,19 @@ public:
 	 */
 	virtual void MuteNonMainTransientAnalysis();
 
+	/**
+	 * @brief Shifts the id of the statement and its children
+	 * @details Netlists parsed concurrently number their statements from 0,
+	 * their final ids are assigned once the include tree is complete.
+	 * Overriden in subcircuit_statement.hpp class (scope name)
+	 *
+	 * @param offset
+	 */
+	virtual void ShiftIds( const int offset );
+
+	/// Serializes/restores the parsed statements (io_handling/parsed_netlist_cache.hpp)
+	friend class ParsedNetlistCache;
+
 protected:
 	// Logger
 	LogIO* log_io;
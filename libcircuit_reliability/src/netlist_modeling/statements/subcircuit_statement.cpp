@@ -201,6 +201,12 @@ void SubcircuitStatement::UpdateOwnScope(){
 	own_scope->set_main_statement_name( name );
 }
 
+void SubcircuitStatement::ShiftIds( const int offset ){
+	Statement::ShiftIds( offset );
+	// scope name depends on the id
+	UpdateOwnScope();
+}
+
 bool SubcircuitStatement::ParseSubcircuitStatement(
 		Statement& global_scope_parent, std::ifstream* file,
 		std::vector<std::string>& lineTockens, std::string & statementCode,
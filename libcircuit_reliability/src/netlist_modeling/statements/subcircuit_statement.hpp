@@ -25,6 +25,8 @@ public:
 	virtual std::string ExportCircuitStatement( const std::string& indentation ) override;
 
 	std::vector<InstanceStatement*>* get_progeny() {return &progeny; }
+	bool get_is_inline() const { return is_inline; }
+	void set_is_inline( bool is_inline ) { this->is_inline = is_inline; }
 
 	bool ParseSubcircuitStatement( Statement& global_scope_parent, std::ifstream* file,
 		std::vector<std::string>& lineTockens, std::string & statementCode,
@@ -38,6 +40,8 @@ public:
 
 	//Update Scope
 	void UpdateOwnScope();
+
+	virtual void ShiftIds( const int offset ) override;
 private:
 	bool is_inline;
 	// InstanceStatements whose
@@ -50,6 +50,7 @@ bool PostParsingStatementHandler::AnalyzeStatementDependency(){
 	log_io->ReportPlainStandard( kTab +  "--> " + number2String(analog_model_statements_found.size()) + " analog models.");
 	log_io->ReportPlainStandard( kTab +  "--> " + number2String(instance_statements_found.size()) + " instances.");
 	bool dependencyFound;
+	IndexDependencyParents();
 	// Models:
 	for(std::vector<ModelStatement*>::iterator it_m = model_statements_found.begin();
 				it_m != model_statements_found.end(); it_m++){
@@ -208,26 +209,10 @@ bool PostParsingStatementHandler::FindDependency( Statement* statement ){
 	bool found = false;
 	if( statement->get_consider_instances_dependency() ){
 		Statement* dependencyParent = statement;
-		for(std::vector<SubcircuitStatement*>::iterator it_s = subcircuit_statements_found.begin();
-					it_s != subcircuit_statements_found.end(); it_s++){
-			if( (*it_s)->get_name().compare(statement->get_master_name())==0 ){
-				dependencyParent = *it_s;
-				found = true;
-			}
-		}
-		for(std::vector<AnalogModelStatement*>::iterator it_am = analog_model_statements_found.begin();
-					it_am != analog_model_statements_found.end(); it_am++){
-			if( (*it_am)->get_name().compare(statement->get_master_name())==0 ){
-				dependencyParent = *it_am;
-				found = true;
-			}
-		}
-		for(std::vector<ModelStatement*>::iterator it_m = model_statements_found.begin();
-					it_m != model_statements_found.end(); it_m++){
-			if( (*it_m)->get_name().compare(statement->get_master_name())==0 ){
-				dependencyParent = *it_m;
-				found = true;
-			}
+		auto const it_dp = dependency_parents_by_name.find( statement->get_master_name() );
+		if( it_dp!=dependency_parents_by_name.end() ){
+			dependencyParent = it_dp->second;
+			found = true;
 		}
 		if( dependencyParent==statement ){
 			log_io->ReportRedStandard( kTab +  "--> Statement dependencyParent not found for " + statement->get_name() + " "
@@ -244,6 +229,20 @@ bool PostParsingStatementHandler::FindDependency( Statement* statement ){
 	return found;
 }
 
+void PostParsingStatementHandler::IndexDependencyParents(){
+	dependency_parents_by_name.clear();
+	// later insertions overwrite the previous ones
+	for( auto const &s : subcircuit_statements_found ){
+		dependency_parents_by_name[s->get_name()] = s;
+	}
+	for( auto const &am : analog_model_statements_found ){
+		dependency_parents_by_name[am->get_name()] = am;
+	}
+	for( auto const &m : model_statements_found ){
+		dependency_parents_by_name[m->get_name()] = m;
+	}
+}
+
 // Subcircuit listings
 void PostParsingStatementHandler::AddSubcircuitStatementFound( SubcircuitStatement* subcircuit_statement_found ){
 	subcircuit_statements_found.push_back( subcircuit_statement_found );
@@ -285,3 +284,20 @@ void PostParsingStatementHandler::AddTransistorStatementFound( TransistorStateme
 void PostParsingStatementHandler::AddAnalysisStatementFound( AnalysisStatement* analysis_statement_found ){
 	analysis_statements_found.push_back( analysis_statement_found );
 }
+
+void PostParsingStatementHandler::AppendStatementsFound( const PostParsingStatementHandler& statementsFound ){
+	primitive_statements_found.insert( primitive_statements_found.end(),
+		statementsFound.primitive_statements_found.begin(), statementsFound.primitive_statements_found.end() );
+	analog_model_statements_found.insert( analog_model_statements_found.end(),
+		statementsFound.analog_model_statements_found.begin(), statementsFound.analog_model_statements_found.end() );
+	model_statements_found.insert( model_statements_found.end(),
+		statementsFound.model_statements_found.begin(), statementsFound.model_statements_found.end() );
+	instance_statements_found.insert( instance_statements_found.end(),
+		statementsFound.instance_statements_found.begin(), statementsFound.instance_statements_found.end() );
+	transistor_statements_found.insert( transistor_statements_found.end(),
+		statementsFound.transistor_statements_found.begin(), statementsFound.transistor_statements_found.end() );
+	subcircuit_statements_found.insert( subcircuit_statements_found.end(),
+		statementsFound.subcircuit_statements_found.begin(), statementsFound.subcircuit_statements_found.end() );
+	analysis_statements_found.insert( analysis_statements_found.end(),
+		statementsFound.analysis_statements_found.begin(), statementsFound.analysis_statements_found.end() );
+}
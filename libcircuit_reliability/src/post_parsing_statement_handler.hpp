@@ -17,6 +17,7 @@
 ///PostParsingStatementHandler Class
 // c++ std required libraries includes
 #include <string>
+#include <unordered_map>
 // radiation simulator includes
 #include "simulations_handling/simulation_modes_handler.hpp" 
 // radiation io simulator includes
@@ -79,6 +80,16 @@ public:
 	 * @return vector of subcircuits statements found
 	 */
 	std::vector<SubcircuitStatement*>* get_subcircuit_statements_found(){ return &subcircuit_statements_found; }
+
+	std::vector<AnalogModelStatement*>* get_analog_model_statements_found(){ return &analog_model_statements_found; }
+
+	std::vector<ModelStatement*>* get_model_statements_found(){ return &model_statements_found; }
+
+	std::vector<InstanceStatement*>* get_instance_statements_found(){ return &instance_statements_found; }
+
+	std::vector<TransistorStatement*>* get_transistor_statements_found(){ return &transistor_statements_found; }
+
+	std::vector<AnalysisStatement*>* get_analysis_statements_found(){ return &analysis_statements_found; }
 	
 	/**
  	* @details Adds an analog model statement to the list of analog model statements found
@@ -116,6 +127,13 @@ public:
  	*/
 	void AddAnalysisStatementFound( AnalysisStatement* analysisStatementGound );
 
+	/**
+ 	* @details Appends the statements found by other handler,
+ 	* used to register the netlists parsed concurrently in the circuit tree order
+ 	* @param statementsFound <PostParsingStatementHandler&> handler whose statements are appended.
+ 	*/
+	void AppendStatementsFound( const PostParsingStatementHandler& statementsFound );
+
 	/**
 	 * @brief finds the path to the circuit to which the statement belongs
 	 * 
@@ -146,6 +164,16 @@ private:
 	std::vector<SubcircuitStatement*> subcircuit_statements_found;
 	/// analysis statements found
 	std::vector<AnalysisStatement*> analysis_statements_found;
+	/// subcircuits, analog models and models found, indexed by name
+	/// (built by IndexDependencyParents)
+	std::unordered_map<std::string, Statement*> dependency_parents_by_name;
+
+	/**
+ 	* @details Indexes by name the statements that can be dependency parents.
+ 	* When several statements share the name, models take precedence over analog models,
+ 	* and those over subcircuits; within each list the last statement found does.
+ 	*/
+	void IndexDependencyParents();
 
 	/**
  	* @details Finds and set up the dependency of a statement
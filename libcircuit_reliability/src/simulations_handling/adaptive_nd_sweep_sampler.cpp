@@ -0,0 +1,257 @@
+/**
+ * @file adaptive_nd_sweep_sampler.cpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * AdaptiveNDSweepSampler Class Body
+ *
+ */
+
+// c++ std libraries
+#include <cmath>
+#include <limits>
+#include <algorithm>
+// Radiation simulator
+#include "adaptive_nd_sweep_sampler.hpp"
+// constants
+#include "../global_functions_and_constants/global_constants.hpp"
+
+AdaptiveNDSweepSampler::AdaptiveNDSweepSampler(){
+	this->refinement_threshold = 0;
+	this->coarse_stride = kAdaptiveSweepCoarseStride;
+	this->simulated_profiles_count = 0;
+	this->coarse_grid_requested = false;
+}
+
+AdaptiveNDSweepSampler::~AdaptiveNDSweepSampler(){
+}
+
+void AdaptiveNDSweepSampler::Init( const std::vector<unsigned int>& sweepStepsNumbers ){
+	sweep_steps_numbers = sweepStepsNumbers;
+	unsigned int totalProfiles = 1;
+	for( auto const &steps : sweep_steps_numbers ){
+		totalProfiles *= steps;
+	}
+	simulated_profiles.assign( totalProfiles, false );
+	profile_values.assign( totalProfiles, std::numeric_limits<double>::quiet_NaN() );
+	source_profiles.assign( totalProfiles, 0 );
+	simulated_profiles_count = 0;
+	active_cells.clear();
+	converged_cells.clear();
+	coarse_grid_requested = false;
+	// coarse grid bounds of each parameter: 0, stride, 2*stride... last step
+	std::vector<std::vector<unsigned int>> coarseBounds;
+	for( auto const &steps : sweep_steps_numbers ){
+		std::vector<unsigned int> bounds;
+		for( unsigned int i=0; i<steps-1; i+=coarse_stride ){
+			bounds.push_back( i );
+		}
+		bounds.push_back( steps-1 );
+		coarseBounds.push_back( bounds );
+	}
+	// coarse cells, cartesian product of the bound intervals
+	std::vector<unsigned int> intervalIndexes( coarseBounds.size(), 0 );
+	bool moreCells = true;
+	while( moreCells ){
+		SweepCell cell;
+		for( unsigned int d=0; d<coarseBounds.size(); ++d ){
+			auto const &bounds = coarseBounds.at(d);
+			unsigned int lower = bounds.at( intervalIndexes.at(d) );
+			cell.lower_indexes.push_back( lower );
+			cell.upper_indexes.push_back( bounds.size()>1 ? bounds.at( intervalIndexes.at(d)+1 ) : lower );
+		}
+		active_cells.push_back( cell );
+		// next interval indexes, last parameter first
+		moreCells = false;
+		for( int d=coarseBounds.size()-1; d>=0; --d ){
+			unsigned int intervals = coarseBounds.at(d).size()>1 ? coarseBounds.at(d).size()-1 : 1;
+			if( ++intervalIndexes.at(d)<intervals ){
+				moreCells = true;
+				break;
+			}
+			intervalIndexes.at(d) = 0;
+		}
+	}
+}
+
+bool AdaptiveNDSweepSampler::GetNextProfiles( std::vector<unsigned int>& ndProfileIndexes ){
+	ndProfileIndexes.clear();
+	if( !coarse_grid_requested ){
+		coarse_grid_requested = true;
+		for( auto const &cell : active_cells ){
+			RequestCellCorners( cell, ndProfileIndexes );
+		}
+		return !ndProfileIndexes.empty();
+	}
+	// children corners can be already simulated by the neighbour cells
+	while( !active_cells.empty() && ndProfileIndexes.empty() ){
+		std::vector<SweepCell> refinedCells;
+		for( auto const &cell : active_cells ){
+			if( IsSplittableCell( cell ) && IsSharpCell( cell ) ){
+				SplitCell( cell, refinedCells );
+			}else{
+				converged_cells.push_back( cell );
+			}
+		}
+		for( auto const &cell : refinedCells ){
+			RequestCellCorners( cell, ndProfileIndexes );
+		}
+		active_cells = std::move( refinedCells );
+	}
+	return !ndProfileIndexes.empty();
+}
+
+void AdaptiveNDSweepSampler::SetProfileValue( const unsigned int ndProfileIndex, const double value ){
+	profile_values.at(ndProfileIndex) = value;
+	source_profiles.at(ndProfileIndex) = ndProfileIndex;
+}
+
+void AdaptiveNDSweepSampler::InterpolateProfiles(){
+	std::vector<bool> interpolatedProfiles( simulated_profiles );
+	for( auto const &cell : converged_cells ){
+		auto corners = GetCellCorners( cell );
+		std::vector<std::vector<unsigned int>> cornersIndexes;
+		for( auto const &c : corners ){
+			cornersIndexes.push_back( GetParameterCountIndexes(c) );
+		}
+		// profiles inside the cell
+		std::vector<unsigned int> indexes( cell.lower_indexes );
+		bool moreProfiles = true;
+		while( moreProfiles ){
+			unsigned int ndProfileIndex = GetNDProfileIndex( indexes );
+			if( !interpolatedProfiles.at(ndProfileIndex) ){
+				// multilinear interpolation, results of the nearest corner
+				double value = 0;
+				unsigned int minDistance = std::numeric_limits<unsigned int>::max();
+				for( unsigned int c=0; c<corners.size(); ++c ){
+					double weight = 1;
+					unsigned int distance = 0;
+					for( unsigned int d=0; d<indexes.size(); ++d ){
+						unsigned int width = cell.upper_indexes.at(d) - cell.lower_indexes.at(d);
+						if( width==0 ){
+							continue;
+						}
+						double t = static_cast<double>(indexes.at(d) - cell.lower_indexes.at(d))/width;
+						weight *= cornersIndexes.at(c).at(d)==cell.lower_indexes.at(d) ? 1 - t : t;
+						distance += cornersIndexes.at(c).at(d)>indexes.at(d) ?
+							cornersIndexes.at(c).at(d) - indexes.at(d) : indexes.at(d) - cornersIndexes.at(c).at(d);
+					}
+					value += weight*profile_values.at(corners.at(c));
+					if( distance<minDistance ){
+						minDistance = distance;
+						source_profiles.at(ndProfileIndex) = corners.at(c);
+					}
+				}
+				profile_values.at(ndProfileIndex) = value;
+				interpolatedProfiles.at(ndProfileIndex) = true;
+			}
+			// next profile, last parameter first
+			moreProfiles = false;
+			for( int d=indexes.size()-1; d>=0; --d ){
+				if( ++indexes.at(d)<=cell.upper_indexes.at(d) ){
+					moreProfiles = true;
+					break;
+				}
+				indexes.at(d) = cell.lower_indexes.at(d);
+			}
+		}
+	}
+}
+
+std::vector<unsigned int> AdaptiveNDSweepSampler::GetParameterCountIndexes( const unsigned int ndProfileIndex ) const{
+	std::vector<unsigned int> parameterCountIndexes( sweep_steps_numbers.size(), 0 );
+	unsigned int remainder = ndProfileIndex;
+	for( int d=sweep_steps_numbers.size()-1; d>=0; --d ){
+		parameterCountIndexes.at(d) = remainder % sweep_steps_numbers.at(d);
+		remainder /= sweep_steps_numbers.at(d);
+	}
+	return parameterCountIndexes;
+}
+
+unsigned int AdaptiveNDSweepSampler::GetNDProfileIndex( const std::vector<unsigned int>& parameterCountIndexes ) const{
+	// same order as UpdateParameterSweepIndexes, last parameter first
+	unsigned int ndProfileIndex = 0;
+	for( unsigned int d=0; d<sweep_steps_numbers.size(); ++d ){
+		ndProfileIndex = ndProfileIndex*sweep_steps_numbers.at(d) + parameterCountIndexes.at(d);
+	}
+	return ndProfileIndex;
+}
+
+std::vector<unsigned int> AdaptiveNDSweepSampler::GetCellCorners( const SweepCell& cell ) const{
+	std::vector<unsigned int> corners;
+	std::vector<unsigned int> indexes( cell.lower_indexes.size() );
+	for( unsigned int mask=0; mask<(1u<<cell.lower_indexes.size()); ++mask ){
+		for( unsigned int d=0; d<indexes.size(); ++d ){
+			indexes.at(d) = (mask>>d) & 1 ? cell.upper_indexes.at(d) : cell.lower_indexes.at(d);
+		}
+		unsigned int ndProfileIndex = GetNDProfileIndex( indexes );
+		if( std::find( corners.begin(), corners.end(), ndProfileIndex )==corners.end() ){
+			corners.push_back( ndProfileIndex );
+		}
+	}
+	return corners;
+}
+
+bool AdaptiveNDSweepSampler::IsSharpCell( const SweepCell& cell ) const{
+	double minValue = std::numeric_limits<double>::max();
+	double maxValue = -std::numeric_limits<double>::max();
+	for( auto const &c : GetCellCorners( cell ) ){
+		double value = profile_values.at(c);
+		if( std::isnan( value ) ){
+			return true;
+		}
+		minValue = std::min( minValue, value );
+		maxValue = std::max( maxValue, value );
+	}
+	double scale = std::max( std::abs(minValue), std::abs(maxValue) );
+	return scale>0 && (maxValue - minValue)/scale > refinement_threshold;
+}
+
+bool AdaptiveNDSweepSampler::IsSplittableCell( const SweepCell& cell ) const{
+	for( unsigned int d=0; d<cell.lower_indexes.size(); ++d ){
+		if( cell.upper_indexes.at(d) - cell.lower_indexes.at(d)>1 ){
+			return true;
+		}
+	}
+	return false;
+}
+
+void AdaptiveNDSweepSampler::SplitCell( const SweepCell& cell, std::vector<SweepCell>& children ) const{
+	unsigned int dimensions = cell.lower_indexes.size();
+	for( unsigned int mask=0; mask<(1u<<dimensions); ++mask ){
+		SweepCell child;
+		bool validChild = true;
+		for( unsigned int d=0; d<dimensions && validChild; ++d ){
+			unsigned int lower = cell.lower_indexes.at(d);
+			unsigned int upper = cell.upper_indexes.at(d);
+			if( upper - lower>1 ){
+				unsigned int middle = (lower + upper)/2;
+				child.lower_indexes.push_back( (mask>>d) & 1 ? middle : lower );
+				child.upper_indexes.push_back( (mask>>d) & 1 ? upper : middle );
+			}else if( (mask>>d) & 1 ){
+				// not split dimension, only one child
+				validChild = false;
+			}else{
+				child.lower_indexes.push_back( lower );
+				child.upper_indexes.push_back( upper );
+			}
+		}
+		if( validChild ){
+			children.push_back( child );
+		}
+	}
+}
+
+void AdaptiveNDSweepSampler::RequestCellCorners( const SweepCell& cell, std::vector<unsigned int>& ndProfileIndexes ){
+	for( auto const &c : GetCellCorners( cell ) ){
+		if( !simulated_profiles.at(c) ){
+			simulated_profiles.at(c) = true;
+			++simulated_profiles_count;
+			ndProfileIndexes.push_back( c );
+		}
+	}
+}
@@ -0,0 +1,113 @@
+/**
+ * @file adaptive_nd_sweep_sampler.hpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * Adaptive sampling of the ND parameter sweeps.
+ * A coarse grid of profiles is simulated first, and only the cells
+ * whose corner values (critical parameter values) change sharply
+ * are refined, level by level, until the sweep steps are reached.
+ * The profiles that are not simulated are interpolated from the
+ * corners of their converged cell, so every sweep profile has a result.
+ *
+ */
+
+#ifndef ADAPTIVE_ND_SWEEP_SAMPLER_H
+#define ADAPTIVE_ND_SWEEP_SAMPLER_H
+
+// c++ std libraries
+#include <vector>
+
+class AdaptiveNDSweepSampler {
+public:
+	AdaptiveNDSweepSampler();
+	virtual ~AdaptiveNDSweepSampler();
+
+	/// max relative change of the cell corner values, cells above it are refined
+	void set_refinement_threshold( const double refinement_threshold ){
+		this->refinement_threshold = refinement_threshold; }
+	/// sweep steps between the coarse grid profiles
+	void set_coarse_stride( const unsigned int coarse_stride ){
+		this->coarse_stride = coarse_stride>1 ? coarse_stride : 1; }
+
+	/**
+	 * @brief Inits the coarse grid cells
+	 *
+	 * @param sweepStepsNumbers sweep steps of each swept parameter
+	 */
+	void Init( const std::vector<unsigned int>& sweepStepsNumbers );
+
+	/**
+	 * @brief Profiles of the next refinement level
+	 * @details The active cells with sharp changes are split,
+	 * the other ones are converged.
+	 *
+	 * @param ndProfileIndexes profiles to be simulated
+	 * @return false if every cell has converged
+	 */
+	bool GetNextProfiles( std::vector<unsigned int>& ndProfileIndexes );
+
+	/**
+	 * @brief Sets the value of a simulated profile
+	 *
+	 * @param ndProfileIndex
+	 * @param value NaN if the profile could not be simulated (the cell is refined)
+	 */
+	void SetProfileValue( const unsigned int ndProfileIndex, const double value );
+
+	/**
+	 * @brief Interpolates the profiles not simulated, once every cell has converged
+	 */
+	void InterpolateProfiles();
+
+	/**
+	 * @brief Sweep indexes of a profile
+	 *
+	 * @param ndProfileIndex
+	 * @return parameterCountIndexes
+	 */
+	std::vector<unsigned int> GetParameterCountIndexes( const unsigned int ndProfileIndex ) const;
+
+	/// simulated profile providing the results of the profile (itself if simulated)
+	unsigned int GetSourceProfile( const unsigned int ndProfileIndex ) const{
+		return source_profiles.at(ndProfileIndex); }
+	/// simulated or interpolated value of the profile
+	double GetProfileValue( const unsigned int ndProfileIndex ) const{
+		return profile_values.at(ndProfileIndex); }
+	bool IsSimulated( const unsigned int ndProfileIndex ) const{
+		return simulated_profiles.at(ndProfileIndex); }
+	unsigned int get_total_profiles() const{ return simulated_profiles.size(); }
+	unsigned int get_simulated_profiles_count() const{ return simulated_profiles_count; }
+
+private:
+	/// hyperrectangle of the sweep grid, bounds included
+	struct SweepCell {
+		std::vector<unsigned int> lower_indexes;
+		std::vector<unsigned int> upper_indexes;
+	};
+
+	double refinement_threshold;
+	unsigned int coarse_stride;
+	std::vector<unsigned int> sweep_steps_numbers;
+	/// cells whose corners are simulated in the current level
+	std::vector<SweepCell> active_cells;
+	std::vector<SweepCell> converged_cells;
+	std::vector<bool> simulated_profiles;
+	unsigned int simulated_profiles_count;
+	std::vector<double> profile_values;
+	std::vector<unsigned int> source_profiles;
+	bool coarse_grid_requested;
+
+	unsigned int GetNDProfileIndex( const std::vector<unsigned int>& parameterCountIndexes ) const;
+	std::vector<unsigned int> GetCellCorners( const SweepCell& cell ) const;
+	bool IsSharpCell( const SweepCell& cell ) const;
+	bool IsSplittableCell( const SweepCell& cell ) const;
+	void SplitCell( const SweepCell& cell, std::vector<SweepCell>& children ) const;
+	void RequestCellCorners( const SweepCell& cell, std::vector<unsigned int>& ndProfileIndexes );
+};
+
+#endif /* ADAPTIVE_ND_SWEEP_SAMPLER_H */
@@ -0,0 +1,144 @@
+/**
+ * @file critical_parameter_warm_start_store.cpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * CriticalParameterWarmStartStore Class Body
+ *
+ */
+
+// c++ std libraries
+#include <fstream>
+#include <sstream>
+#include <limits>
+// Boost
+#include "boost/filesystem.hpp"  // includes all needed Boost.Filesystem declarations
+// Radiation simulator
+#include "critical_parameter_warm_start_store.hpp"
+// constants
+#include "../global_functions_and_constants/global_constants.hpp"
+#include "../global_functions_and_constants/global_template_functions.hpp"
+
+CriticalParameterWarmStartStore::CriticalParameterWarmStartStore(){
+	this->log_io = nullptr;
+	this->file_path = "";
+}
+
+CriticalParameterWarmStartStore::~CriticalParameterWarmStartStore(){
+}
+
+bool CriticalParameterWarmStartStore::LoadCriticalValues(){
+	if( file_path.empty() || !boost::filesystem::exists( file_path ) ){
+		return true;
+	}
+	std::ifstream file( file_path.c_str() );
+	if( !file.is_open() ){
+		if( log_io!=nullptr ){
+			log_io->ReportError2AllLogs( "Critical values file '" + file_path + "' could not be read." );
+		}
+		return false;
+	}
+	boost::unique_lock<boost::mutex> lock( mutex );
+	// line: scenario_id nd_profile_index critical_value sweep_index_0 ... sweep_index_n
+	std::string line;
+	unsigned int loadedValues = 0;
+	while( std::getline( file, line ) ){
+		if( line.empty() || line.at(0)=='#' ){
+			continue;
+		}
+		std::istringstream lineStream( line );
+		std::string scenarioId;
+		unsigned int ndProfileIndex;
+		ProfileCriticalValue profileCriticalValue;
+		if( !(lineStream >> scenarioId >> ndProfileIndex >> profileCriticalValue.critical_value) ){
+			continue;
+		}
+		unsigned int sweepIndex;
+		while( lineStream >> sweepIndex ){
+			profileCriticalValue.parameter_count_indexes.push_back( sweepIndex );
+		}
+		critical_values[scenarioId][ndProfileIndex] = profileCriticalValue;
+		++loadedValues;
+	}
+	file.close();
+	if( log_io!=nullptr ){
+		log_io->ReportPlainStandard( kTab + "Critical values of previous runs loaded: " + number2String(loadedValues) );
+	}
+	return true;
+}
+
+bool CriticalParameterWarmStartStore::ExportCriticalValues(){
+	if( file_path.empty() ){
+		return true;
+	}
+	std::ofstream file( file_path.c_str() );
+	if( !file.is_open() ){
+		if( log_io!=nullptr ){
+			log_io->ReportError2AllLogs( "Critical values file '" + file_path + "' could not be exported." );
+		}
+		return false;
+	}
+	boost::unique_lock<boost::mutex> lock( mutex );
+	file << "# scenario_id nd_profile_index critical_value sweep_indexes\n";
+	for( auto const & s : critical_values ){
+		for( auto const & p : s.second ){
+			file << s.first << " " << p.first << " " << p.second.critical_value;
+			for( auto const & i : p.second.parameter_count_indexes ){
+				file << " " << i;
+			}
+			file << "\n";
+		}
+	}
+	file.close();
+	return true;
+}
+
+void CriticalParameterWarmStartStore::AddCriticalValue( const std::string& scenarioId, const unsigned int ndProfileIndex,
+	const std::vector<unsigned int>& parameterCountIndexes, const double criticalValue ){
+	boost::unique_lock<boost::mutex> lock( mutex );
+	ProfileCriticalValue& profileCriticalValue = critical_values[scenarioId][ndProfileIndex];
+	profileCriticalValue.parameter_count_indexes = parameterCountIndexes;
+	profileCriticalValue.critical_value = criticalValue;
+}
+
+bool CriticalParameterWarmStartStore::PredictCriticalValue( const std::string& scenarioId,
+	const std::vector<unsigned int>& parameterCountIndexes, double& predictedValue ){
+	boost::unique_lock<boost::mutex> lock( mutex );
+	auto scenario = critical_values.find( scenarioId );
+	if( scenario==critical_values.end() ){
+		return false;
+	}
+	unsigned int minDistance = std::numeric_limits<unsigned int>::max();
+	double nearestValuesSum = 0;
+	unsigned int nearestValuesCount = 0;
+	for( auto const & p : scenario->second ){
+		// profiles of another sweep definition
+		if( p.second.parameter_count_indexes.size()!=parameterCountIndexes.size() ){
+			continue;
+		}
+		unsigned int distance = 0;
+		for( unsigned int i=0; i<parameterCountIndexes.size(); ++i ){
+			distance += p.second.parameter_count_indexes.at(i)>parameterCountIndexes.at(i)
+				? p.second.parameter_count_indexes.at(i) - parameterCountIndexes.at(i)
+				: parameterCountIndexes.at(i) - p.second.parameter_count_indexes.at(i);
+		}
+		if( distance<minDistance ){
+			minDistance = distance;
+			nearestValuesSum = 0;
+			nearestValuesCount = 0;
+		}
+		if( distance==minDistance ){
+			nearestValuesSum += p.second.critical_value;
+			++nearestValuesCount;
+		}
+	}
+	if( nearestValuesCount==0 ){
+		return false;
+	}
+	predictedValue = nearestValuesSum/nearestValuesCount;
+	return true;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file critical_parameter_warm_start_store.hpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * Critical parameter values of the finished ND sweep profiles,
+ * shared by all the scenarios. They predict the initial bracket of the
+ * critical value search of the neighbour profiles (warm start).
+ * The values can be exported and loaded, so reruns of the same
+ * experiment also warm start.
+ *
+ */
+
+#ifndef CRITICAL_PARAMETER_WARM_START_STORE_H
+#define CRITICAL_PARAMETER_WARM_START_STORE_H
+
+// c++ std libraries
+#include <map>
+#include <string>
+#include <vector>
+// Boost
+#include <boost/thread.hpp>
+// Radiation simulator
+#include "../io_handling/log_io.hpp"
+
+class CriticalParameterWarmStartStore {
+public:
+	CriticalParameterWarmStartStore();
+	virtual ~CriticalParameterWarmStartStore();
+
+	void set_log_io( LogIO* log_io ){ this->log_io = log_io; }
+	/// file of previously found critical values (empty: not exported)
+	void set_file_path( const std::string& file_path ){ this->file_path = file_path; }
+	std::string get_file_path() const { return file_path; }
+
+	/**
+	 * @brief Loads the critical values of previous runs, if the file exists
+	 *
+	 * @return false if the file exists but can not be read
+	 */
+	bool LoadCriticalValues();
+
+	/**
+	 * @brief Exports the critical values, previous runs ones included
+	 *
+	 * @return true if the file is correctly exported
+	 */
+	bool ExportCriticalValues();
+
+	/**
+	 * @brief Adds the critical value of a finished profile
+	 *
+	 * @param scenarioId
+	 * @param ndProfileIndex
+	 * @param parameterCountIndexes sweep indexes of the profile
+	 * @param criticalValue
+	 */
+	void AddCriticalValue( const std::string& scenarioId, const unsigned int ndProfileIndex,
+		const std::vector<unsigned int>& parameterCountIndexes, const double criticalValue );
+
+	/**
+	 * @brief Predicts the critical value of a profile
+	 * @details Mean value of the nearest (sweep indexes distance) finished profiles of the scenario
+	 *
+	 * @param scenarioId
+	 * @param parameterCountIndexes sweep indexes of the profile
+	 * @param predictedValue
+	 * @return false if there is no finished profile
+	 */
+	bool PredictCriticalValue( const std::string& scenarioId,
+		const std::vector<unsigned int>& parameterCountIndexes, double& predictedValue );
+
+private:
+	struct ProfileCriticalValue {
+		std::vector<unsigned int> parameter_count_indexes;
+		double critical_value;
+	};
+
+	LogIO* log_io;
+	std::string file_path;
+	boost::mutex mutex;
+	/// scenario id -> nd profile index -> critical value
+	std::map<std::string, std::map<unsigned int, ProfileCriticalValue>> critical_values;
+};
+
+#endif /* CRITICAL_PARAMETER_WARM_START_STORE_H */
@@ -0,0 +1,95 @@
+/**
+ * @file scenario_stager.cpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * ScenarioStager Class Body
+ *
+ */
+
+// posix
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/ioctl.h>
+#ifdef __linux__
+#include <linux/fs.h>
+#endif
+// Boost
+#include "boost/filesystem.hpp"  // includes all needed Boost.Filesystem declarations
+// Radiation simulator
+#include "scenario_stager.hpp"
+// constants
+#include "../global_functions_and_constants/global_constants.hpp"
+#include "../global_functions_and_constants/files_folders_io_constants.hpp"
+
+ScenarioStager::ScenarioStager(){
+}
+
+ScenarioStager::~ScenarioStager(){
+}
+
+bool ScenarioStager::StageFolder( const std::string& scenarioFolder, const std::string& runFolder ) const{
+	boost::system::error_code ec;
+	boost::filesystem::directory_iterator it( scenarioFolder, ec );
+	if( ec ){
+		return false;
+	}
+	bool success = true;
+	for( ; it!=boost::filesystem::directory_iterator(); it.increment( ec ) ){
+		if( !boost::filesystem::is_regular_file( it->status() ) ){
+			continue;
+		}
+		const std::string fileName = it->path().filename().string();
+		if( fileName.compare( kSpectreLogFile )==0 || fileName.compare( kSpectreStandardLogsFile )==0 ){
+			continue;
+		}
+		const std::string source = it->path().string();
+		const std::string destination = runFolder + kFolderSeparator + fileName;
+		if( IsRunOwnedFile( fileName ) ){
+			success = CopyFile( source, destination ) && success;
+		}else if( link( source.c_str(), destination.c_str() )!=0 ){
+			// other filesystem or links not allowed
+			success = ( CloneFile( source, destination ) || CopyFile( source, destination ) ) && success;
+		}
+	}
+	return success && !ec;
+}
+
+bool ScenarioStager::IsRunOwnedFile( const std::string& fileName ) const{
+	// rewritten in place by each run (ExportParametersCircuit)
+	return fileName.compare( kParametersCircuitFile )==0;
+}
+
+bool ScenarioStager::CopyFile( const std::string& source, const std::string& destination ) const{
+	boost::system::error_code ec;
+	boost::filesystem::copy_file( source, destination,
+		boost::filesystem::copy_option::overwrite_if_exists, ec );
+	return !ec;
+}
+
+bool ScenarioStager::CloneFile( const std::string& source, const std::string& destination ) const{
+#ifdef FICLONE
+	int sourceFd = open( source.c_str(), O_RDONLY );
+	if( sourceFd<0 ){
+		return false;
+	}
+	int destinationFd = open( destination.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+	if( destinationFd<0 ){
+		close( sourceFd );
+		return false;
+	}
+	bool cloned = ioctl( destinationFd, FICLONE, sourceFd )==0;
+	close( sourceFd );
+	close( destinationFd );
+	if( !cloned ){
+		unlink( destination.c_str() );
+	}
+	return cloned;
+#else
+	return false;
+#endif
+}
@@ -0,0 +1,48 @@
+/**
+ * @file scenario_stager.hpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * Stages the run folders of the nested simulations (critical parameter
+ * probes, sweep profiles, montecarlo iterations...) from their scenario folder.
+ * The netlists are immutable once the scenario is created, so they are
+ * shared instead of copied:
+ * 		+ hardlink (same filesystem)
+ * 		+ reflink, copy-on-write clone (other filesystem supporting it)
+ * 		+ plain copy (fallback)
+ * The parameters file is rewritten by every run, so it always gets its own copy,
+ * and the spectre logs of the scenario folder are not staged.
+ *
+ */
+
+#ifndef SCENARIO_STAGER_H
+#define SCENARIO_STAGER_H
+
+// c++ std libraries
+#include <string>
+
+class ScenarioStager {
+public:
+	ScenarioStager();
+	virtual ~ScenarioStager();
+
+	/**
+	 * @brief Stages the files (not the folders) of a scenario folder in a run folder
+	 *
+	 * @param scenarioFolder
+	 * @param runFolder previously created
+	 * @return true if every file has been staged
+	 */
+	bool StageFolder( const std::string& scenarioFolder, const std::string& runFolder ) const;
+
+private:
+	bool IsRunOwnedFile( const std::string& fileName ) const;
+	bool CopyFile( const std::string& source, const std::string& destination ) const;
+	bool CloneFile( const std::string& source, const std::string& destination ) const;
+};
+
+#endif /* SCENARIO_STAGER_H */
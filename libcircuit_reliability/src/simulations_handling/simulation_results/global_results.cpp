@@ -73,14 +73,15 @@ bool GlobalResults::ProcessStandardSimulationMode(){
 		outputFile << "# altered_scenario_index simulation_id altered_element_path"
 			<< " correctlySimulated reliability_result folder\n";
 		for( auto const &s : *simulations ){
-			auto pSS = dynamic_cast<StandardSimulation*>(s);
+			// equivalent scenarios report the results of the simulated one
+			auto pSS = dynamic_cast<StandardSimulation*>(s->get_results_simulation());
 			std::string correctlySimulated = pSS->get_correctly_simulated() ? "true " : "false ";
-			outputFile << pSS->get_altered_scenario_index()
-				<< " " << pSS->get_simulation_id()
-				<< " " << pSS->get_altered_statement_path()
+			outputFile << s->get_altered_scenario_index()
+				<< " " << s->get_simulation_id()
+				<< " " << s->get_altered_statement_path()
 				<< " " << correctlySimulated
 				<< " " << (pSS->get_basic_simulation_results())->get_s_reliability_result()
-				<< " " << pSS->get_folder() << "\n";
+				<< " " << s->get_folder() << "\n";
 		}
 	}catch (std::exception const& ex) {
 		std::string ex_what = ex.what();
@@ -121,14 +122,15 @@ bool GlobalResults::ProcessCriticalParameterValueSimulationMode(){
 		outputFile << " #folder #correctlySimulated #affected_by_min_value #affected_by_min_value"
 			<< " #critical_parameter_value" << " #MAG_i_name #MAG_i_maxErrorGlobal #MAG_i_maxErrorMetric\n";
 		for( auto const &s : *simulations ){
-			auto pCPVS = dynamic_cast<CriticalParameterValueSimulation*>(s);
+			// equivalent scenarios report the results of the simulated one
+			auto pCPVS = dynamic_cast<CriticalParameterValueSimulation*>(s->get_results_simulation());
 			std::string correctlySimulated = pCPVS->get_correctly_simulated() ? "true " : "false ";
 			std::string affectedByMinVal = pCPVS->get_affected_by_min_value() ? "true " : "false ";
 			std::string affectedByMaxVal = pCPVS->get_affected_by_min_value() ? "true " : "false ";
-			outputFile << pCPVS->get_altered_scenario_index()
-				<< " " << pCPVS->get_simulation_id()
-				<< " " << pCPVS->get_altered_statement_path()
-				<< " " << pCPVS->get_folder()
+			outputFile << s->get_altered_scenario_index()
+				<< " " << s->get_simulation_id()
+				<< " " << s->get_altered_statement_path()
+				<< " " << s->get_folder()
 				<< " " << correctlySimulated
 				<< " " << affectedByMinVal
 				<< " " << affectedByMaxVal
@@ -282,7 +284,7 @@ bool GlobalResults::ProcessCriticalParameterNDParametersSweepSimulationMode(){
 	std::ofstream outputFile;
 	std::string outputFilePath = data_folder + "/critical_parameter_" + kSummaryFile.c_str();
 	// scenario paths
-	std::map<std::string, std::string> paths;
+	std::multimap<std::string, std::string> paths;
 	// simulationsNDSimulationResults
 	std::vector<NDSimulationResults*> simulationsNDSimulationResults;
 	ResultsProcessor rp;
@@ -293,9 +295,10 @@ bool GlobalResults::ProcessCriticalParameterNDParametersSweepSimulationMode(){
 	auto pFirstMagGPCIMean= auxSim->get_out_p_c_i_mean();
 
 	for( auto const &s : *simulations ){
-		auto pCPNDPSS = dynamic_cast<CriticalParameterNDParameterSweepSimulation*>(s);
+		// equivalent scenarios weight the results of the simulated one
+		auto pCPNDPSS = dynamic_cast<CriticalParameterNDParameterSweepSimulation*>(s->get_results_simulation());
 		paths.insert( std::make_pair(
-			(pCPNDPSS->get_main_nd_simulation_results())->get_general_data_path(), pCPNDPSS->get_simulation_id() ) );
+			(pCPNDPSS->get_main_nd_simulation_results())->get_general_data_path(), s->get_simulation_id() ) );
 		simulationsNDSimulationResults.push_back( pCPNDPSS->get_main_nd_simulation_results() );
 	}
 	// process results
@@ -480,7 +483,7 @@ bool GlobalResults::ProcessMontecarloCriticalParameterNDParametersSweepMode(){
 	std::ofstream outputFile;
 	std::string outputFilePath = data_folder + "/critical_parameter_" + kSummaryFile.c_str();
 	// scenario paths
-	std::map<std::string, std::string> paths;
+	std::multimap<std::string, std::string> paths;
 	std::vector<NDSimulationResults*> simulationsNDSimulationResults;
 	ResultsProcessor rp;
 	auto auxSim = dynamic_cast<MontecarloCriticalParameterNDParametersSweepSimulation*> (simulations->front());
@@ -492,9 +495,10 @@ bool GlobalResults::ProcessMontecarloCriticalParameterNDParametersSweepMode(){
 	auto pFirstMagGPCIMean= auxSim->get_out_p_c_i_mean();
 
 	for( auto const &s : *simulations ){
-		auto pMCPNDPSS = dynamic_cast<MontecarloCriticalParameterNDParametersSweepSimulation*>(s);
+		// equivalent scenarios weight the results of the simulated one
+		auto pMCPNDPSS = dynamic_cast<MontecarloCriticalParameterNDParametersSweepSimulation*>(s->get_results_simulation());
 		paths.insert( std::make_pair(
-			(pMCPNDPSS->get_main_nd_simulation_results())->get_general_data_path(), pMCPNDPSS->get_simulation_id() ) );
+			(pMCPNDPSS->get_main_nd_simulation_results())->get_general_data_path(), s->get_simulation_id() ) );
 		simulationsNDSimulationResults.push_back( pMCPNDPSS->get_main_nd_simulation_results() );
 	}
 	// process results
@@ -688,7 +692,7 @@ bool GlobalResults::GenerateAndPlotParameterPairResults(
 	std::string planesGnuplotScriptFolder;
 	std::string planesImagesFolder;
 	std::string generalParameterResultsFile;
-	std::map<std::string,std::string> planeStructurePaths;
+	std::multimap<std::string,std::string> planeStructurePaths;
 	// planeStructurePaths.reserve( simulationsNDSimulationResults.size() );
 	// fgarcia:
 	auto auxNDSimulationResults = simulationsNDSimulationResults.front();
@@ -20,6 +20,9 @@
 
 MontecarloSimulationResults::MontecarloSimulationResults() {
 	this->spectre_result = kNotDefinedInt;
+	this->spectre_wall_time = 0;
+	this->spectre_cpu_time = 0;
+	this->spectre_max_rss = 0;
 	this->full_id = kNotDefinedString;
 	this->upsets_count = kNotDefinedInt;
 	this->max_critical_parameter_value = kNotDefinedInt + 0.0;
@@ -176,6 +176,16 @@ public:
 
 	void ReserveMetricMontecarloResults( unsigned int metricMontecarloResultsLength );
 
+	/**
+	* @brief resources used by the spectre montecarlo run
+	*/
+	void set_spectre_wall_time( const double spectre_wall_time ){ this->spectre_wall_time = spectre_wall_time; }
+	void set_spectre_cpu_time( const double spectre_cpu_time ){ this->spectre_cpu_time = spectre_cpu_time; }
+	void set_spectre_max_rss( const long spectre_max_rss ){ this->spectre_max_rss = spectre_max_rss; }
+	double get_spectre_wall_time() const{ return spectre_wall_time; }
+	double get_spectre_cpu_time() const{ return spectre_cpu_time; }
+	long get_spectre_max_rss() const{ return spectre_max_rss; }
+
 private:
 	/// simulated parameters: name-value
 	std::map<std::string,std::string> simulation_parameters;
@@ -193,6 +203,12 @@ private:
 	std::vector<metric_montecarlo_results_t*> metric_montecarlo_results;
 	/// spectre result
 	int spectre_result;
+	/// spectre wall time (s)
+	double spectre_wall_time;
+	/// spectre cpu time, user + system (s)
+	double spectre_cpu_time;
+	/// spectre max resident set size (kB)
+	long spectre_max_rss;
 	/// simulation result full_id (also related to the folder)
 	std::string full_id;
 };
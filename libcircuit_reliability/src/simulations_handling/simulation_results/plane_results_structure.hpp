@@ -44,7 +44,7 @@ public:
 
 	void ResizeItemizedPlanesMemory( unsigned int planesCount );
 
-	std::map<std::string, std::string>* get_itemized_data_paths(){ return & itemized_data_paths; };
+	std::multimap<std::string, std::string>* get_itemized_data_paths(){ return & itemized_data_paths; };
 	std::map<std::string, std::string>* get_itemized_image_paths(){ return & itemized_image_paths; };
 	std::vector<std::map<std::string,std::string>>* get_itemized_metrics_image_paths(){ return & itemized_metrics_image_paths; };
 
@@ -57,8 +57,8 @@ protected:
 	std::map<std::string,std::string> general_metrics_image_paths;
 	// for each itemized plane, a map with metric (path_title)
 	std::vector<std::map<std::string,std::string>> itemized_metrics_image_paths;
-	// path, title (qcrit or upsets)
-	std::map<std::string,std::string> itemized_data_paths;
+	// path, title (qcrit or upsets), multimap as processed by ResultsProcessor
+	std::multimap<std::string,std::string> itemized_data_paths;
 	std::map<std::string,std::string> itemized_image_paths;
 };
 
@@ -24,6 +24,9 @@ TransientSimulationResults::TransientSimulationResults() {
 	this->full_id = kNotDefinedString;
 	this->title = kNotDefinedString;
 	this->has_metrics_errors = false;
+	this->spectre_wall_time = 0;
+	this->spectre_cpu_time = 0;
+	this->spectre_max_rss = 0;
 }
 
 TransientSimulationResults::TransientSimulationResults(
@@ -33,6 +36,9 @@ TransientSimulationResults::TransientSimulationResults(
 	this->full_id = orig.full_id;
 	this->title = orig.title;
 	this->has_metrics_errors = orig.has_metrics_errors;
+	this->spectre_wall_time = orig.spectre_wall_time;
+	this->spectre_cpu_time = orig.spectre_cpu_time;
+	this->spectre_max_rss = orig.spectre_max_rss;
 	this->original_file_path = orig.original_file_path;
 	this->processed_file_path = orig.processed_file_path;
 	// data structures
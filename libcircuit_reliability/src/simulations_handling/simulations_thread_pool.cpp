@@ -0,0 +1,155 @@
+/**
+ * @file simulations_thread_pool.cpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * SimulationsThreadPool and SimulationsTaskGroup Classes Body
+ *
+ */
+
+// c++ std libraries
+#include <exception>
+// Boost
+#include <boost/bind.hpp>
+// Radiation simulator
+#include "simulations_thread_pool.hpp"
+// constants
+#include "../global_functions_and_constants/global_template_functions.hpp"
+
+// nesting level of the task run by the current thread (0: not running a pool task)
+static thread_local unsigned int currentTaskDepth = 0;
+// the current thread is a pool worker
+static thread_local bool isPoolWorker = false;
+
+SimulationsThreadPool::SimulationsThreadPool(){
+	this->log_io = nullptr;
+	this->max_parallel_instances = boost::thread::hardware_concurrency()>0 ?
+		boost::thread::hardware_concurrency() : 1;
+	this->started = false;
+	this->stopping = false;
+}
+
+SimulationsThreadPool::~SimulationsThreadPool(){
+	{
+		boost::unique_lock<boost::mutex> lock( mutex );
+		stopping = true;
+		state_changed.notify_all();
+	}
+	workers.join_all();
+}
+
+void SimulationsThreadPool::StartWorkers(){
+	started = true;
+	for( unsigned int i=0; i<max_parallel_instances; ++i ){
+		workers.create_thread( boost::bind(&SimulationsThreadPool::WorkerLoop, this) );
+	}
+	if( log_io!=nullptr ){
+		log_io->ReportPlainStandard( "Simulations thread pool started with "
+			+ number2String(max_parallel_instances) + " workers." );
+	}
+}
+
+void SimulationsThreadPool::WorkerLoop(){
+	isPoolWorker = true;
+	boost::unique_lock<boost::mutex> lock( mutex );
+	while( !stopping ){
+		if( !RunPendingTask( lock ) ){
+			state_changed.wait( lock );
+		}
+	}
+}
+
+void SimulationsThreadPool::Submit( SimulationsTaskGroup& group, const boost::function<void()>& task ){
+	boost::unique_lock<boost::mutex> lock( mutex );
+	if( !started ){
+		StartWorkers();
+	}
+	// backpressure, workers help with nested tasks meanwhile
+	while( group.queued_tasks>=group.max_parallel_tasks ){
+		if( !isPoolWorker || !RunPendingTask( lock ) ){
+			state_changed.wait( lock );
+		}
+	}
+	SimulationTask simulationTask;
+	simulationTask.task = task;
+	simulationTask.group = &group;
+	tasks.push_back( simulationTask );
+	++group.queued_tasks;
+	state_changed.notify_all();
+}
+
+void SimulationsThreadPool::Wait( SimulationsTaskGroup& group ){
+	boost::unique_lock<boost::mutex> lock( mutex );
+	while( group.queued_tasks + group.running_tasks>0 ){
+		if( !isPoolWorker || !RunPendingTask( lock ) ){
+			state_changed.wait( lock );
+		}
+	}
+}
+
+bool SimulationsThreadPool::RunPendingTask( boost::unique_lock<boost::mutex>& lock ){
+	std::deque<SimulationTask>::iterator it = tasks.begin();
+	while( it!=tasks.end() && ( it->group->depth<currentTaskDepth
+			|| it->group->running_tasks>=it->group->max_parallel_tasks ) ){
+		++it;
+	}
+	if( it==tasks.end() ){
+		return false;
+	}
+	SimulationTask simulationTask = *it;
+	tasks.erase( it );
+	SimulationsTaskGroup* group = simulationTask.group;
+	--group->queued_tasks;
+	++group->running_tasks;
+	// a queued slot has been freed
+	state_changed.notify_all();
+	lock.unlock();
+	unsigned int previousTaskDepth = currentTaskDepth;
+	currentTaskDepth = group->depth + 1;
+	try{
+		simulationTask.task();
+	}catch( const std::exception& e ){
+		if( log_io!=nullptr ){
+			log_io->ReportError2AllLogs( "Exception in simulation task: " + std::string( e.what() ) );
+		}
+	}catch( ... ){
+		if( log_io!=nullptr ){
+			log_io->ReportError2AllLogs( "Unknown exception in simulation task." );
+		}
+	}
+	currentTaskDepth = previousTaskDepth;
+	lock.lock();
+	--group->running_tasks;
+	state_changed.notify_all();
+	return true;
+}
+
+SimulationsTaskGroup::SimulationsTaskGroup( SimulationsThreadPool* thread_pool, const unsigned int max_parallel_tasks ){
+	this->thread_pool = thread_pool;
+	this->max_parallel_tasks = max_parallel_tasks>0 ? max_parallel_tasks : 1;
+	this->depth = currentTaskDepth;
+	this->queued_tasks = 0;
+	this->running_tasks = 0;
+}
+
+SimulationsTaskGroup::~SimulationsTaskGroup(){
+	Wait();
+}
+
+void SimulationsTaskGroup::Run( const boost::function<void()>& task ){
+	if( thread_pool==nullptr ){
+		task();
+		return;
+	}
+	thread_pool->Submit( *this, task );
+}
+
+void SimulationsTaskGroup::Wait(){
+	if( thread_pool!=nullptr ){
+		thread_pool->Wait( *this );
+	}
+}
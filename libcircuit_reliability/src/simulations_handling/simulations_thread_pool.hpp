@@ -0,0 +1,128 @@
+/**
+ * @file simulations_thread_pool.hpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * Bounded pool of persistent worker threads shared by every simulation
+ * level (scenarios, profiles, montecarlo instances).
+ * 		+ SimulationsThreadPool: global concurrency limit of the whole experiment
+ * 		+ SimulationsTaskGroup: the tasks of a simulation level, with its own
+ * 		  max_parallel_* limit. A new task starts as soon as any slot frees.
+ * A worker waiting for its group runs the queued tasks of nested levels,
+ * so nested parallelism never oversubscribes nor deadlocks the pool.
+ *
+ */
+
+#ifndef SIMULATIONS_THREAD_POOL_H
+#define SIMULATIONS_THREAD_POOL_H
+
+// c++ std libraries
+#include <deque>
+// Boost
+#include <boost/thread.hpp>
+#include <boost/function.hpp>
+// Radiation simulator
+#include "../io_handling/log_io.hpp"
+
+class SimulationsTaskGroup;
+
+class SimulationsThreadPool {
+public:
+	SimulationsThreadPool();
+	virtual ~SimulationsThreadPool();
+
+	/**
+	 * @brief Sets the global number of concurrent tasks (worker threads)
+	 * @details Only taken into account before the first task is run
+	 *
+	 * @param max_parallel_instances
+	 */
+	void set_max_parallel_instances( const unsigned int max_parallel_instances ){
+		this->max_parallel_instances = max_parallel_instances>0 ? max_parallel_instances : 1; }
+	unsigned int get_max_parallel_instances() const { return max_parallel_instances; }
+	void set_log_io( LogIO* log_io ){ this->log_io = log_io; }
+
+private:
+	friend class SimulationsTaskGroup;
+
+	struct SimulationTask {
+		boost::function<void()> task;
+		SimulationsTaskGroup* group;
+	};
+
+	LogIO* log_io;
+	unsigned int max_parallel_instances;
+	bool started;
+	bool stopping;
+	boost::mutex mutex;
+	boost::condition_variable state_changed;
+	std::deque<SimulationTask> tasks;
+	boost::thread_group workers;
+
+	/**
+	 * @brief Queues a task, blocking while the group has max_parallel_tasks queued tasks
+	 */
+	void Submit( SimulationsTaskGroup& group, const boost::function<void()>& task );
+
+	/**
+	 * @brief Waits for all the tasks of the group
+	 */
+	void Wait( SimulationsTaskGroup& group );
+
+	/**
+	 * @brief Runs (in the current thread) the first eligible queued task
+	 * @details A task is eligible if its group has a free slot and,
+	 * if the current thread is already running a task, the task is nested
+	 * in the current one (deeper level)
+	 *
+	 * @param lock pool lock, released while the task runs
+	 * @return false if there was no eligible task
+	 */
+	bool RunPendingTask( boost::unique_lock<boost::mutex>& lock );
+
+	void StartWorkers();
+	void WorkerLoop();
+};
+
+class SimulationsTaskGroup {
+public:
+	/**
+	 * @brief Constructor
+	 *
+	 * @param thread_pool shared pool. If nullptr, tasks are run in the calling thread
+	 * @param max_parallel_tasks max number of concurrent tasks of the group
+	 */
+	SimulationsTaskGroup( SimulationsThreadPool* thread_pool, const unsigned int max_parallel_tasks );
+	/// waits for the pending tasks
+	virtual ~SimulationsTaskGroup();
+
+	/**
+	 * @brief Runs a task in the pool
+	 * @details Blocks while the group already has max_parallel_tasks queued,
+	 * so the caller does not create more simulations than the ones to be run.
+	 *
+	 * @param task
+	 */
+	void Run( const boost::function<void()>& task );
+
+	/**
+	 * @brief Waits for all the tasks of the group
+	 */
+	void Wait();
+
+private:
+	friend class SimulationsThreadPool;
+
+	SimulationsThreadPool* thread_pool;
+	unsigned int max_parallel_tasks;
+	/// nesting level of the thread that created the group
+	unsigned int depth;
+	unsigned int queued_tasks;
+	unsigned int running_tasks;
+};
+
+#endif /* SIMULATIONS_THREAD_POOL_H */
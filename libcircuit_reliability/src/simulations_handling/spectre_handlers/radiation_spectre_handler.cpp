@@ -5,6 +5,8 @@
  *      Author: fernando, fgarcia@die.upm.es
  */
 
+// c++ std libraries
+#include <cctype>
 // Reliability simulator
 #include "radiation_spectre_handler.hpp"
 #include "../spectre_simulations/golden_simulation.hpp"
@@ -16,6 +18,7 @@
 
 #include "../../io_handling/results_processor.hpp"
 #include "../../io_handling/raw_format_processor.hpp"
+#include "../../metric_modeling/ocean_eval_metric.hpp"
 
 #include "../simulation_results/global_results.hpp"
 #include "../spectre_simulations/critical_parameter_value_simulation.hpp"
@@ -45,10 +48,18 @@ RadiationSpectreHandler::RadiationSpectreHandler() {
 	this->export_matlab_script = false;
 	// files
 	this->export_metric_errors = false;
+	this->streaming_analysis = false;
+	this->binary_processed_transients = false;
+	this->critical_parameter_parallel_probes = 1;
+	this->critical_parameter_warm_start = false;
+	this->critical_parameter_root_finding = false;
+	this->critical_parameter_batch_probes = false;
+	this->adaptive_sweep_threshold = 0;
+	this->deduplicate_equivalent_scenarios = false;
+	this->deduplicated_scenarios = 0;
 	this->delete_spectre_folders = false;
 	this->delete_spectre_transients = true;
 	this->delete_processed_transients = true;
-	this->golden_metrics_structure = nullptr;
 	// montecarlo iterations
 	this->montecarlo_iterations = 1;
 	// parallel
@@ -66,12 +77,6 @@ RadiationSpectreHandler::~RadiationSpectreHandler() {
 	deleteContentsOfVectorOfPointers( metrics_2be_found );
 	// ReorderMetrics clears unsorted_metrics_2be_found
 	// deleteContentsOfVectorOfPointers( unsorted_metrics_2be_found );
-	if( golden_metrics_structure ){
-		#ifdef DESTRUCTORS_VERBOSE
-			log_io->ReportPlainStandard( "golden_metrics_structure");
-		#endif
-		delete golden_metrics_structure;
-	}
 	#ifdef DESTRUCTORS_VERBOSE
 		log_io->ReportPlainStandard( "simulations");
 	#endif
@@ -87,9 +92,48 @@ void RadiationSpectreHandler::AddSimulationParameter( SimulationParameter* simul
 }
 
 void RadiationSpectreHandler::AddScenarioFolderPath( const int alteredScenarioId,
-	const std::string alteredScenarioFolderPath, const std::string alteredStatementPath ){
-	altered_scenarios.push_back( new AlteredScenarioSummary(alteredScenarioId,
-		alteredScenarioFolderPath, alteredStatementPath) );
+	const std::string alteredScenarioFolderPath, const std::string alteredStatementPath,
+	const std::string structuralKey ){
+	auto as = new AlteredScenarioSummary(alteredScenarioId,
+		alteredScenarioFolderPath, alteredStatementPath, structuralKey);
+	if( deduplicate_equivalent_scenarios && !structuralKey.empty() ){
+		auto it_k = scenario_indexes_by_structural_key.find( structuralKey );
+		if( it_k==scenario_indexes_by_structural_key.end() ){
+			scenario_indexes_by_structural_key.emplace( structuralKey, altered_scenarios.size() );
+		}else{
+			as->set_equivalent_scenario_index( it_k->second );
+			++deduplicated_scenarios;
+		}
+	}
+	altered_scenarios.push_back( as );
+}
+
+bool RadiationSpectreHandler::ContainsNameToken( const std::string& text, const std::string& name ){
+	if( name.empty() ){
+		return false;
+	}
+	auto isNameChar = []( const char c ){
+		return std::isalnum( static_cast<unsigned char>(c) ) || c=='_' || c=='!'; };
+	for( std::size_t pos = text.find( name ); pos!=std::string::npos; pos = text.find( name, pos + 1 ) ){
+		const std::size_t end = pos + name.size();
+		if( ( pos==0 || !isNameChar( text[pos - 1] ) ) && ( end==text.size() || !isNameChar( text[end] ) ) ){
+			return true;
+		}
+	}
+	return false;
+}
+
+bool RadiationSpectreHandler::IsReferencedByMetrics( const std::string& name ) const{
+	for( auto const & m : unsorted_metrics_2be_found ){
+		if( ContainsNameToken( m->get_name(), name ) ){
+			return true;
+		}
+		if( !m->is_transient_magnitude()
+			&& ContainsNameToken( static_cast<OceanEvalMetric*>(m)->get_ocean_eval_expression(), name ) ){
+			return true;
+		}
+	}
+	return false;
 }
 
 bool RadiationSpectreHandler::ExportScenariosList(){
@@ -118,8 +162,16 @@ bool RadiationSpectreHandler::RunSimulations(){
 	// Report simulation
 	log_io->ReportGreenStandard( kTab + simulation_mode->get_description());
 	log_io->ReportGreenStandard( "RadiationSpectreHandler Simulation Parameters: " + number2String( simulation_parameters.size()) );
-	// Thread group
-	boost::thread_group tgScenarios;
+	// Scenarios task group, run in the shared pool
+	thread_pool.set_log_io( log_io );
+	resource_broker.set_log_io( log_io );
+	if( critical_parameter_warm_start ){
+		warm_start_store.set_log_io( log_io );
+		if( !warm_start_store.LoadCriticalValues() ){
+			log_io->ReportError2AllLogs( "Critical values of previous runs not loaded." );
+		}
+	}
+	SimulationsTaskGroup tgScenarios( &thread_pool, max_parallel_scenario_instances );
 	int radiationScenarioCounter = 0;
 	// Golden netlist and Radiation subcircuit AHDL netlist
 	// Golden results are processed
@@ -141,6 +193,10 @@ bool RadiationSpectreHandler::RunSimulations(){
 	if( !ExportScenariosList() || !ExportProfilesList() ){
 		log_io->ReportError2AllLogs( kTab + "Error exporting scenarios and profiles." );
 	}
+	if( deduplicate_equivalent_scenarios ){
+		log_io->ReportCyanStandard( k2Tab + number2String( deduplicated_scenarios )
+			+ " scenarios are equivalent to a previous one and will not be simulated." );
+	}
 	// reserve memory
 	simulations.reserve( altered_scenarios.size() );
 	// retrieve numruns and set it to '1', for manual handling in kMontecarloCriticalParameterNDParametersSweepMode
@@ -161,17 +217,7 @@ bool RadiationSpectreHandler::RunSimulations(){
 	}
 	// run
 	log_io->ReportInfo2AllLogs("[performance] Reliability Simulations started: " + GetCurrentDateTime("%d-%m-%Y.%X"));
-	unsigned int concurrentScenarioThreads = 0;
 	for( auto const & as : altered_scenarios ){
-		// limit concurrent parallel scenarios
-		if( concurrentScenarioThreads == max_parallel_scenario_instances ){
-			// Wait for threads
-			#ifdef SPECTRE_SIMULATIONS_VERBOSE
-			log_io->ReportPlainStandard( "Waiting for some Scenario threads to end." );
-			#endif
-			tgScenarios.join_all();
-			concurrentScenarioThreads = 0;
-		}
 		SpectreSimulation* sss;
 		switch( simulation_mode->get_id() ){
 			case kStandardMode: {
@@ -200,6 +246,7 @@ bool RadiationSpectreHandler::RunSimulations(){
 					pParameterSweep->set_max_parallel_profile_instances( max_parallel_profile_instances );
 					pParameterSweep->set_plot_last_transients( plot_last_transients );
 					pParameterSweep->set_plot_critical_parameter_value_evolution( plot_critical_parameter_value_evolution );
+					pParameterSweep->set_adaptive_sweep_threshold( adaptive_sweep_threshold );
 				}
 			break;
 			case kMontecarloCriticalParameterNDParametersSweepMode: {
@@ -215,6 +262,7 @@ bool RadiationSpectreHandler::RunSimulations(){
 					pMCPNDPSS->set_plot_last_transients( plot_last_transients );
 					pMCPNDPSS->set_max_parallel_montecarlo_instances( max_parallel_montecarlo_instances );
 					pMCPNDPSS->set_plot_critical_parameter_value_evolution( plot_critical_parameter_value_evolution );
+					pMCPNDPSS->set_adaptive_sweep_threshold( adaptive_sweep_threshold );
 				}
 			break;
 			default: {
@@ -248,7 +296,12 @@ bool RadiationSpectreHandler::RunSimulations(){
 			// }
 		}
 		sss->set_log_io( log_io );
-		sss->set_golden_metrics_structure( golden_metrics_structure );
+		sss->set_thread_pool( &thread_pool );
+		sss->set_resource_broker( &resource_broker );
+		if( critical_parameter_warm_start ){
+			sss->set_warm_start_store( &warm_start_store );
+		}
+		sss->set_golden_metrics_structure( golden_metrics_store.get() );
 		// Spectre command and args
 		sss->set_spectre_command( spectre_command );
 		sss->set_pre_spectre_command( pre_spectre_command );
@@ -269,6 +322,11 @@ bool RadiationSpectreHandler::RunSimulations(){
 		sss->set_plot_scatters( plot_scatters );
 		sss->set_plot_transients( plot_transients );
 		sss->set_export_metric_errors( export_metric_errors );
+		sss->set_streaming_analysis( streaming_analysis );
+		sss->set_binary_processed_transients( binary_processed_transients );
+		sss->set_critical_parameter_parallel_probes( critical_parameter_parallel_probes );
+		sss->set_critical_parameter_root_finding( critical_parameter_root_finding );
+		sss->set_critical_parameter_batch_probes( critical_parameter_batch_probes );
 		// plotting variables
 		sss->set_interpolate_plots_ratio( interpolate_plots_ratio );
 		// analysis
@@ -277,19 +335,31 @@ bool RadiationSpectreHandler::RunSimulations(){
 		sss->set_process_metrics( true );
 		// add simulation to list
 		simulations.push_back(sss);
+		// equivalent scenarios share the results of the simulated one
+		if( as->get_equivalent_scenario_index()!=kNotDefinedInt ){
+			sss->set_equivalent_simulation( simulations.at( as->get_equivalent_scenario_index() ) );
+			log_io->ReportPlainStandard( kTab + "->Altered netlist #" + number2String(radiationScenarioCounter)
+				+ " equivalent to #" + number2String( as->get_equivalent_scenario_index() ) + ", not simulated." );
+			++radiationScenarioCounter;
+			continue;
+		}
 		// Run the threads
 		log_io->ReportPlainStandard( kTab + "->Simulating altered netlist #" + number2String(radiationScenarioCounter) );
 		// fgarcia, this reference can be a problem¿?
 		// boost::thread radiation_t(boost::bind(&SpectreSimulation::HandleSpectreSimulation, boost::ref(sss)));
-		tgScenarios.create_thread(boost::bind(&SpectreSimulation::HandleSpectreSimulation, sss));
+		// limit of concurrent parallel scenarios handled by the task group
+		tgScenarios.Run( boost::bind(&SpectreSimulation::HandleSpectreSimulation, sss) );
 		log_io->ReportThread( "Altered Scenario Simulation #" + number2String(radiationScenarioCounter), 1 );
 		// Update counters
 		++radiationScenarioCounter;
-		++concurrentScenarioThreads;
 	}
 	//wait each thread
-	tgScenarios.join_all();
+	tgScenarios.Wait();
+	if( critical_parameter_warm_start && !warm_start_store.ExportCriticalValues() ){
+		log_io->ReportError2AllLogs( "Critical values not exported." );
+	}
 	log_io->ReportInfo2AllLogs("[performance] Reliability Simulations ended: " + GetCurrentDateTime("%d-%m-%Y.%X"));
+	resource_broker.ReportStatistics();
 	log_io->ReportPlainStandard( "->All Spectre instances have ended." );
 	log_io->ReportPlainStandard( "->Processing scenario statistics." );
 	bool partialResult = ProcessScenarioStatistics();
@@ -309,6 +379,7 @@ bool RadiationSpectreHandler::SimulateStandardAHDLNetlist( ){
 	radiation_AHDL_s->set_main_analysis( simulation_mode->get_analysis_statement() );
 	radiation_AHDL_s->set_main_transient_analysis( simulation_mode->get_main_transient_analysis() );
 	radiation_AHDL_s->set_log_io( log_io );
+	radiation_AHDL_s->set_resource_broker( &resource_broker );
 	// not needed
 	// radiation_AHDL_s->set_plot_transients( false );
 	// Not required cause metrics are not processed
@@ -382,6 +453,7 @@ bool RadiationSpectreHandler::SimulateGoldenAHDLNetlist( ){
 	ahdl_golden_ss->set_main_analysis( simulation_mode->get_analysis_statement() );
 	ahdl_golden_ss->set_main_transient_analysis( simulation_mode->get_main_transient_analysis() );
 	ahdl_golden_ss->set_log_io( log_io );
+	ahdl_golden_ss->set_resource_broker( &resource_broker );
 	ahdl_golden_ss->set_plot_transients( false );
 	ahdl_golden_ss->set_plot_scatters( false );
 	ahdl_golden_ss->set_top_folder( top_folder );
@@ -453,6 +525,8 @@ bool RadiationSpectreHandler::SimulateGoldenNetlist( ){
 	golden_ss->set_main_analysis( simulation_mode->get_analysis_statement() );
 	golden_ss->set_main_transient_analysis( simulation_mode->get_main_transient_analysis() );
 	golden_ss->set_log_io( log_io );
+	golden_ss->set_thread_pool( &thread_pool );
+	golden_ss->set_resource_broker( &resource_broker );
 	golden_ss->set_plot_scatters( plot_scatters );
 	golden_ss->set_plot_transients( plot_transients );
 	golden_ss->set_top_folder( top_folder );
@@ -478,7 +552,7 @@ bool RadiationSpectreHandler::SimulateGoldenNetlist( ){
 	golden_t.join();
 	log_io->ReportGreenStandard( "Golden netlist simulated and processed.");
 
-	// We copy the golden metrics, because golden_ss object is going to be destroyed
+	// We share the golden metrics store, which outlives the golden_ss object
 	// analysis/radiation parameters are pointers, and they are not destroyed in the
 	// golden_ss radiation_AHDL_s destruction
 	// Does not need to be copied because is not a GoldenSimulation member
@@ -491,7 +565,7 @@ bool RadiationSpectreHandler::SimulateGoldenNetlist( ){
 			delete golden_ss;
 			return false;
 		}
-		golden_metrics_structure = pGPSS->GetGoldenMetrics();
+		golden_metrics_store = pGPSS->GetGoldenMetrics();
 	}else{
 		GoldenSimulation* pGS =  dynamic_cast<GoldenSimulation*>(golden_ss);
 		if( pGS->get_simulation_results()->get_spectre_result() > 0
@@ -500,7 +574,7 @@ bool RadiationSpectreHandler::SimulateGoldenNetlist( ){
 			delete golden_ss;
 			return false;
 		}
-		golden_metrics_structure = pGS->GetGoldenMetrics();
+		golden_metrics_store = pGS->GetGoldenMetrics();
 	}
 	//delete all simulations
 	delete golden_ss;
@@ -12,11 +12,16 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <memory>
+#include <unordered_map>
 // Boost
 #include <boost/thread.hpp>
 // Radiation simulator
 // radiation io simulator includes
 #include "../spectre_simulations/spectre_simulation.hpp"
+#include "../simulations_thread_pool.hpp"
+#include "../spectre_resource_broker.hpp"
+#include "../critical_parameter_warm_start_store.hpp"
 #include "../simulation_mode.hpp"
 #include "../../io_handling/log_io.hpp"
 // Netlist modeling
@@ -95,6 +100,14 @@ public:
 	bool get_plot_transients(){ return plot_transients; }
 	void set_export_metric_errors( bool export_metric_errors ) { this->export_metric_errors = export_metric_errors; }
 	bool get_export_metric_errors(){ return export_metric_errors; }
+	void set_streaming_analysis( const bool streaming_analysis ) { this->streaming_analysis = streaming_analysis; }
+	bool get_streaming_analysis(){ return streaming_analysis; }
+	void set_binary_processed_transients( const bool binary_processed_transients ) {
+		this->binary_processed_transients = binary_processed_transients; }
+	bool get_binary_processed_transients(){ return binary_processed_transients; }
+	void set_critical_parameter_parallel_probes( const unsigned int critical_parameter_parallel_probes ) {
+		this->critical_parameter_parallel_probes = critical_parameter_parallel_probes; }
+	unsigned int get_critical_parameter_parallel_probes(){ return critical_parameter_parallel_probes; }
 
 	bool get_plot_last_transients(){ return plot_last_transients; }
 	void set_plot_last_transients( const bool plot_last_transients) { this->plot_last_transients = plot_last_transients; }
@@ -136,10 +149,116 @@ public:
 	void set_max_parallel_scenario_instances( int max_parallel_scenario_instances ){
 		this->max_parallel_scenario_instances = max_parallel_scenario_instances; }
 
+	/**
+	 * @brief Sets the global max number of concurrent simulations (all levels)
+	 *
+	 * @param max_parallel_instances
+	 */
+	void set_max_parallel_instances( unsigned int max_parallel_instances ){
+		thread_pool.set_max_parallel_instances( max_parallel_instances ); }
+
+	/**
+	 * @brief Enables the critical value search warm start from the finished neighbour profiles
+	 *
+	 * @param critical_parameter_warm_start
+	 */
+	void set_critical_parameter_warm_start( const bool critical_parameter_warm_start ){
+		this->critical_parameter_warm_start = critical_parameter_warm_start; }
+	bool get_critical_parameter_warm_start(){ return critical_parameter_warm_start; }
+
+	/**
+	 * @brief Enables the regula falsi critical value search, driven by the metric errors
+	 *
+	 * @param critical_parameter_root_finding
+	 */
+	void set_critical_parameter_root_finding( const bool critical_parameter_root_finding ){
+		this->critical_parameter_root_finding = critical_parameter_root_finding; }
+	bool get_critical_parameter_root_finding(){ return critical_parameter_root_finding; }
+
+	/**
+	 * @brief Enables the batched critical value probes, one spectre run per search round
+	 *
+	 * @param critical_parameter_batch_probes
+	 */
+	void set_critical_parameter_batch_probes( const bool critical_parameter_batch_probes ){
+		this->critical_parameter_batch_probes = critical_parameter_batch_probes; }
+	bool get_critical_parameter_batch_probes(){ return critical_parameter_batch_probes; }
+
+	/**
+	 * @brief Sets the refinement threshold of the adaptive ND sweeps (0: full sweeps)
+	 *
+	 * @param adaptive_sweep_threshold
+	 */
+	void set_adaptive_sweep_threshold( const double adaptive_sweep_threshold ){
+		this->adaptive_sweep_threshold = adaptive_sweep_threshold; }
+	double get_adaptive_sweep_threshold(){ return adaptive_sweep_threshold; }
+
+	/**
+	 * @brief Sets the file storing the critical values, for the warm start of reruns
+	 *
+	 * @param critical_parameter_warm_start_file
+	 */
+	void set_critical_parameter_warm_start_file( const std::string& critical_parameter_warm_start_file ){
+		warm_start_store.set_file_path( critical_parameter_warm_start_file ); }
+
+	/**
+	 * @brief Sets the max number of concurrent Spectre runs (licenses), 0: no limit
+	 *
+	 * @param max_spectre_instances
+	 */
+	void set_max_spectre_instances( unsigned int max_spectre_instances ){
+		resource_broker.set_max_spectre_instances( max_spectre_instances ); }
+
+	/**
+	 * @brief Sets the memory (MB) shared by the concurrent Spectre runs, 0: no limit
+	 *
+	 * @param spectre_memory_budget
+	 */
+	void set_spectre_memory_budget( double spectre_memory_budget ){
+		resource_broker.set_memory_budget( spectre_memory_budget ); }
+
+
+	/**
+	 * @brief Simulates once each set of electrically equivalent altered scenarios
+	 *
+	 * @param deduplicate_equivalent_scenarios
+	 */
+	void set_deduplicate_equivalent_scenarios( const bool deduplicate_equivalent_scenarios ){
+		this->deduplicate_equivalent_scenarios = deduplicate_equivalent_scenarios; }
+	bool get_deduplicate_equivalent_scenarios() const{ return deduplicate_equivalent_scenarios; }
+
+	/**
+	 * @brief Whether a metric (magnitude or ocean eval expression) refers to the name
+	 * @details Scenarios altering a referenced statement are not equivalent to any other.
+	 * The name has to be a whole token of the hierarchical metric name or the expression.
+	 *
+	 * @param name statement name
+	 */
+	bool IsReferencedByMetrics( const std::string& name ) const;
+
+	/**
+	 * @brief Whether a hierarchical name or an ocean eval expression contains a name as a whole token
+	 * @details Tokens are delimited by any character other than alphanumerics, '_' and '!'
+	 * (hierarchy separators '.', ':' and '/', quotes, parenthesis, operators...),
+	 * so that I1 is found in I1.M0:d or VT("/I1/out") but not in I10 or XI1.
+	 *
+	 * @param text hierarchical name or ocean eval expression
+	 * @param name statement name
+	 */
+	static bool ContainsNameToken( const std::string& text, const std::string& name );
 
 	void AddMetric( Metric* metric );
+	/**
+	 * @brief Adds an altered scenario
+	 *
+	 * @param alteredScenarioId
+	 * @param alteredScenarioFolderPath
+	 * @param alteredStatementPath
+	 * @param structuralKey equal for electrically equivalent scenarios, empty if not comparable
+	 */
 	void AddScenarioFolderPath( const int alteredScenarioId,
-		const std::string alteredScenarioFolderPath, const std::string alteredStatementPath );
+		const std::string alteredScenarioFolderPath, const std::string alteredStatementPath,
+		const std::string structuralKey );
 
 	std::vector<SpectreSimulation*>* get_simulations(){ return &simulations; }
 
@@ -204,6 +323,12 @@ private:
 	bool plot_critical_parameter_value_evolution;
 	/// exports metric errors
 	bool export_metric_errors;
+	/// verdict only critical parameter simulations, transients are analyzed while read
+	bool streaming_analysis;
+	/// altered processed transients exported as float64 columns
+	bool binary_processed_transients;
+	/// critical parameter values simulated concurrently per search round (1: bisection)
+	unsigned int critical_parameter_parallel_probes;
 
 	/// ESimulationsMode
 	SimulationMode* simulation_mode;
@@ -226,8 +351,8 @@ private:
 	std::vector<Metric*> unsorted_metrics_2be_found;
 	// Metrics which are going to be processed
 	std::vector<Metric*> metrics_2be_found;
-	// Golden Metrics
-	NDMetricsStructure* golden_metrics_structure;
+	// Golden Metrics, shared (read-only) by every simulation
+	std::shared_ptr<NDMetricsStructure> golden_metrics_store;
 	bool export_matlab_script;
 	int interpolate_plots_ratio;
 	/// max parallel instances per parameter_sweep
@@ -236,6 +361,26 @@ private:
 	unsigned int max_parallel_montecarlo_instances;
 	// max parallel instances per scenario
 	unsigned int max_parallel_scenario_instances;
+	/// workers shared by scenarios, profiles and montecarlo instances
+	SimulationsThreadPool thread_pool;
+	/// Spectre licenses and memory tokens
+	SpectreResourceBroker resource_broker;
+	/// critical value search warm start
+	bool critical_parameter_warm_start;
+	/// critical value search by root finding
+	bool critical_parameter_root_finding;
+	/// critical value probes batched in a single spectre run
+	bool critical_parameter_batch_probes;
+	/// adaptive ND sweeps refinement threshold
+	double adaptive_sweep_threshold;
+	/// critical values of the finished profiles
+	CriticalParameterWarmStartStore warm_start_store;
+	/// equivalent scenarios simulated once
+	bool deduplicate_equivalent_scenarios;
+	/// index of the first scenario of each structural key
+	std::unordered_map<std::string, unsigned int> scenario_indexes_by_structural_key;
+	/// scenarios pointing to an equivalent one
+	unsigned int deduplicated_scenarios;
 
 	bool ExportScenariosList();
 	bool ExportProfilesList();
@@ -38,10 +38,15 @@ VariabilitySpectreHandler::VariabilitySpectreHandler() {
 	this->export_matlab_script = false;
 	// files
 	this->export_metric_errors = false;
+	this->streaming_analysis = false;
+	this->binary_processed_transients = false;
+	this->critical_parameter_parallel_probes = 1;
+	this->critical_parameter_warm_start = false;
+	this->critical_parameter_root_finding = false;
+	this->critical_parameter_batch_probes = false;
 	this->delete_spectre_folders = false;
 	this->delete_spectre_transients = true;
 	this->delete_processed_transients = true;
-	this->golden_metrics_structure = nullptr;
 	// montecarlo iterations
 	this->montecarlo_iterations = 1;
 	// parallel
@@ -58,12 +63,6 @@ VariabilitySpectreHandler::~VariabilitySpectreHandler() {
 	deleteContentsOfVectorOfPointers( metrics_2be_found );
 	// ReorderMetrics clears unsorted_metrics_2be_found
 	// deleteContentsOfVectorOfPointers( unsorted_metrics_2be_found );
-	if( golden_metrics_structure ){
-		#ifdef DESTRUCTORS_VERBOSE
-			log_io->ReportPlainStandard( "golden_metrics_structure");
-		#endif
-		delete golden_metrics_structure;
-	}
 	#ifdef DESTRUCTORS_VERBOSE
 		log_io->ReportPlainStandard( "simulations");
 	#endif
@@ -90,8 +89,16 @@ bool VariabilitySpectreHandler::RunSimulations(){
 	// Report simulation
 	log_io->ReportGreenStandard( kTab + simulation_mode->get_description());
 	log_io->ReportGreenStandard( "RadiationSpectreHandler Simulation Parameters: " + number2String( simulation_parameters.size()) );
-	// Thread group
-	boost::thread_group tgScenarios;
+	// Scenarios task group, run in the shared pool
+	thread_pool.set_log_io( log_io );
+	resource_broker.set_log_io( log_io );
+	if( critical_parameter_warm_start ){
+		warm_start_store.set_log_io( log_io );
+		if( !warm_start_store.LoadCriticalValues() ){
+			log_io->ReportError2AllLogs( "Critical values of previous runs not loaded." );
+		}
+	}
+	SimulationsTaskGroup tgScenarios( &thread_pool, 1 );
 	int radiationScenarioCounter = 0;
 	// Golden netlist and AHDL netlist
 	// Golden results are processed
@@ -150,7 +157,12 @@ bool VariabilitySpectreHandler::RunSimulations(){
 	// max_parallel_montecarlo_instances controlled by spectre
 	sss->set_max_parallel_profile_instances( max_parallel_profile_instances );
 	sss->set_log_io( log_io );
-	sss->set_golden_metrics_structure( golden_metrics_structure );
+	sss->set_thread_pool( &thread_pool );
+	sss->set_resource_broker( &resource_broker );
+	if( critical_parameter_warm_start ){
+		sss->set_warm_start_store( &warm_start_store );
+	}
+	sss->set_golden_metrics_structure( golden_metrics_store.get() );
 	// Spectre command and args
 	sss->set_spectre_command( spectre_command );
 	sss->set_pre_spectre_command( pre_spectre_command );
@@ -174,6 +186,11 @@ bool VariabilitySpectreHandler::RunSimulations(){
 	sss->set_plot_scatters( plot_scatters );
 	sss->set_plot_transients( plot_transients );
 	sss->set_export_metric_errors( export_metric_errors );
+	sss->set_streaming_analysis( streaming_analysis );
+	sss->set_binary_processed_transients( binary_processed_transients );
+	sss->set_critical_parameter_parallel_probes( critical_parameter_parallel_probes );
+	sss->set_critical_parameter_root_finding( critical_parameter_root_finding );
+	sss->set_critical_parameter_batch_probes( critical_parameter_batch_probes );
 	// plotting variables
 	sss->set_interpolate_plots_ratio( interpolate_plots_ratio );
 	// analysis
@@ -187,11 +204,15 @@ bool VariabilitySpectreHandler::RunSimulations(){
 	log_io->ReportThread( "Variability Scenario Simulation #" + number2String(radiationScenarioCounter), 1 );
 	// fgarcia, this reference can be a problem¿?
 	// boost::thread radiation_t(boost::bind(&SpectreSimulation::HandleSpectreSimulation, boost::ref(sss)));
-	tgScenarios.create_thread(boost::bind(&SpectreSimulation::HandleSpectreSimulation, sss));
+	tgScenarios.Run( boost::bind(&SpectreSimulation::HandleSpectreSimulation, sss) );
 	++radiationScenarioCounter;
 	//wait each thread
-	tgScenarios.join_all();
+	tgScenarios.Wait();
+	if( critical_parameter_warm_start && !warm_start_store.ExportCriticalValues() ){
+		log_io->ReportError2AllLogs( "Critical values not exported." );
+	}
 	log_io->ReportInfo2AllLogs("[performance] Reliability Simulations ended: " + GetCurrentDateTime("%d-%m-%Y.%X"));
+	resource_broker.ReportStatistics();
 	log_io->ReportPlainStandard( "->All Spectre instances have ended." );
 	log_io->ReportPlainStandard( kTab + "->All simulations have ended." );
 	return true;
@@ -208,6 +229,7 @@ bool VariabilitySpectreHandler::SimulateStandardAHDLNetlist( ){
 	var_AHDL_s->set_main_analysis( simulation_mode->get_analysis_statement() );
 	var_AHDL_s->set_main_transient_analysis( simulation_mode->get_main_transient_analysis() );
 	var_AHDL_s->set_log_io( log_io );
+	var_AHDL_s->set_resource_broker( &resource_broker );
 	var_AHDL_s->CopySimulationParameters( simulation_parameters );
 	log_io->ReportPurpleStandard( "var_AHDL_s simulation_parameters: " + number2String(var_AHDL_s->get_simulation_parameters()->size()));
 	// not needed
@@ -283,6 +305,7 @@ bool VariabilitySpectreHandler::SimulateGoldenAHDLNetlist( ){
 	ahdl_golden_ss->set_main_analysis( simulation_mode->get_analysis_statement() );
 	ahdl_golden_ss->set_main_transient_analysis( simulation_mode->get_main_transient_analysis() );
 	ahdl_golden_ss->set_log_io( log_io );
+	ahdl_golden_ss->set_resource_broker( &resource_broker );
 	ahdl_golden_ss->set_plot_transients( false );
 	ahdl_golden_ss->set_plot_scatters( false );
 	ahdl_golden_ss->set_top_folder( top_folder );
@@ -339,6 +362,8 @@ bool VariabilitySpectreHandler::SimulateGoldenNetlist( ){
 	golden_ss->set_main_analysis( simulation_mode->get_analysis_statement() );
 	golden_ss->set_main_transient_analysis( simulation_mode->get_main_transient_analysis() );
 	golden_ss->set_log_io( log_io );
+	golden_ss->set_thread_pool( &thread_pool );
+	golden_ss->set_resource_broker( &resource_broker );
 	golden_ss->set_plot_transients( plot_transients );
 	golden_ss->set_plot_scatters( false );
 	golden_ss->set_top_folder( top_folder );
@@ -364,7 +389,7 @@ bool VariabilitySpectreHandler::SimulateGoldenNetlist( ){
 	golden_t.join();
 	log_io->ReportGreenStandard( "Golden netlist simulated and processed.");
 
-	// We copy the golden metrics, because golden_ss object is going to be destroyed
+	// We share the golden metrics store, which outlives the golden_ss object
 	// analysis/radiation parameters are pointers, and they are not destroyed in the
 	// golden_ss var_AHDL_s destruction
 	// Does not need to be copied because is not a GoldenSimulation member
@@ -375,13 +400,13 @@ bool VariabilitySpectreHandler::SimulateGoldenNetlist( ){
 		delete golden_ss;
 		return false;
 	}
-	log_io->ReportGreenStandard( "copying the golden metrics.");
+	log_io->ReportGreenStandard( "sharing the golden metrics.");
 	if( golden_ss==nullptr ){
 		log_io->ReportError2AllLogs( "golden_ss==nullptr" );
 		return false;
 	}
-	golden_metrics_structure = golden_ss->GetGoldenMetrics();
-	log_io->ReportGreenStandard( "golden metrics copied. Deleting golden_ss");
+	golden_metrics_store = golden_ss->GetGoldenMetrics();
+	log_io->ReportGreenStandard( "golden metrics shared. Deleting golden_ss");
 	//delete all simulations
 	delete golden_ss;
 	log_io->ReportGreenStandard( "golden_ss deleted");
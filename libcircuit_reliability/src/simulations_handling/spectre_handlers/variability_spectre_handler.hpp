@@ -12,11 +12,15 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <memory>
 // Boost
 #include <boost/thread.hpp>
 // Radiation simulator
 // radiation io simulator includes
 #include "../spectre_simulations/spectre_simulation.hpp"
+#include "../simulations_thread_pool.hpp"
+#include "../spectre_resource_broker.hpp"
+#include "../critical_parameter_warm_start_store.hpp"
 #include "../simulation_mode.hpp"
 #include "../../io_handling/log_io.hpp"
 // Netlist modeling
@@ -111,6 +115,14 @@ public:
 	void set_plot_transients( bool plot_transients) { this->plot_transients = plot_transients; }
 	bool get_export_metric_errors(){ return export_metric_errors; }
 	void set_export_metric_errors( bool export_metric_errors) { this->export_metric_errors = export_metric_errors; }
+	bool get_streaming_analysis(){ return streaming_analysis; }
+	void set_streaming_analysis( bool streaming_analysis) { this->streaming_analysis = streaming_analysis; }
+	bool get_binary_processed_transients(){ return binary_processed_transients; }
+	void set_binary_processed_transients( bool binary_processed_transients) {
+		this->binary_processed_transients = binary_processed_transients; }
+	unsigned int get_critical_parameter_parallel_probes(){ return critical_parameter_parallel_probes; }
+	void set_critical_parameter_parallel_probes( unsigned int critical_parameter_parallel_probes) {
+		this->critical_parameter_parallel_probes = critical_parameter_parallel_probes; }
 	bool get_plot_last_transients(){ return plot_last_transients; }
 	void set_plot_last_transients( bool plot_last_transients) { this->plot_last_transients = plot_last_transients; }
 
@@ -133,6 +145,65 @@ public:
 	void set_max_parallel_montecarlo_instances( unsigned int max_parallel_montecarlo_instances ){
 		this->max_parallel_montecarlo_instances = max_parallel_montecarlo_instances; }
 
+	/**
+	 * @brief Sets the global max number of concurrent simulations (all levels)
+	 *
+	 * @param max_parallel_instances
+	 */
+	void set_max_parallel_instances( unsigned int max_parallel_instances ){
+		thread_pool.set_max_parallel_instances( max_parallel_instances ); }
+
+	/**
+	 * @brief Enables the critical value search warm start from the finished neighbour profiles
+	 *
+	 * @param critical_parameter_warm_start
+	 */
+	void set_critical_parameter_warm_start( const bool critical_parameter_warm_start ){
+		this->critical_parameter_warm_start = critical_parameter_warm_start; }
+	bool get_critical_parameter_warm_start(){ return critical_parameter_warm_start; }
+
+	/**
+	 * @brief Enables the regula falsi critical value search, driven by the metric errors
+	 *
+	 * @param critical_parameter_root_finding
+	 */
+	void set_critical_parameter_root_finding( const bool critical_parameter_root_finding ){
+		this->critical_parameter_root_finding = critical_parameter_root_finding; }
+	bool get_critical_parameter_root_finding(){ return critical_parameter_root_finding; }
+
+	/**
+	 * @brief Enables the batched critical value probes, one spectre run per search round
+	 *
+	 * @param critical_parameter_batch_probes
+	 */
+	void set_critical_parameter_batch_probes( const bool critical_parameter_batch_probes ){
+		this->critical_parameter_batch_probes = critical_parameter_batch_probes; }
+	bool get_critical_parameter_batch_probes(){ return critical_parameter_batch_probes; }
+
+	/**
+	 * @brief Sets the file storing the critical values, for the warm start of reruns
+	 *
+	 * @param critical_parameter_warm_start_file
+	 */
+	void set_critical_parameter_warm_start_file( const std::string& critical_parameter_warm_start_file ){
+		warm_start_store.set_file_path( critical_parameter_warm_start_file ); }
+
+	/**
+	 * @brief Sets the max number of concurrent Spectre runs (licenses), 0: no limit
+	 *
+	 * @param max_spectre_instances
+	 */
+	void set_max_spectre_instances( unsigned int max_spectre_instances ){
+		resource_broker.set_max_spectre_instances( max_spectre_instances ); }
+
+	/**
+	 * @brief Sets the memory (MB) shared by the concurrent Spectre runs, 0: no limit
+	 *
+	 * @param spectre_memory_budget
+	 */
+	void set_spectre_memory_budget( double spectre_memory_budget ){
+		resource_broker.set_memory_budget( spectre_memory_budget ); }
+
 	void AddMetric( Metric* metric );
 
 	std::vector<SpectreSimulation*>* get_simulations(){ return &simulations; }
@@ -190,6 +261,12 @@ private:
 	bool plot_last_transients;
 	/// exports metric errors
 	bool export_metric_errors;
+	/// verdict only critical parameter simulations, transients are analyzed while read
+	bool streaming_analysis;
+	/// altered processed transients exported as float64 columns
+	bool binary_processed_transients;
+	/// critical parameter values simulated concurrently per search round (1: bisection)
+	unsigned int critical_parameter_parallel_probes;
 
 	/// ESimulationsMode
 	SimulationMode* simulation_mode;
@@ -213,14 +290,26 @@ private:
 	std::vector<Metric*> unsorted_metrics_2be_found;
 	// Metrics which are going to be processed
 	std::vector<Metric*> metrics_2be_found;
-	// Golden Metrics
-	NDMetricsStructure* golden_metrics_structure;
+	// Golden Metrics, shared (read-only) by every simulation
+	std::shared_ptr<NDMetricsStructure> golden_metrics_store;
 	bool export_matlab_script;
 	int interpolate_plots_ratio;
 	/// max parallel instances per parameter_sweep
 	int max_parallel_profile_instances;
 	/// max parallel instances per parameter
 	unsigned int max_parallel_montecarlo_instances;
+	/// workers shared by scenarios, profiles and montecarlo instances
+	SimulationsThreadPool thread_pool;
+	/// Spectre licenses and memory tokens
+	SpectreResourceBroker resource_broker;
+	/// critical value search warm start
+	bool critical_parameter_warm_start;
+	/// critical value search by root finding
+	bool critical_parameter_root_finding;
+	/// critical value probes batched in a single spectre run
+	bool critical_parameter_batch_probes;
+	/// critical values of the finished profiles
+	CriticalParameterWarmStartStore warm_start_store;
 
 	bool SimulateGoldenNetlist( );
 	bool SimulateStandardAHDLNetlist( );
@@ -0,0 +1,129 @@
+/**
+ * @file spectre_process_launcher.cpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * SpectreProcessLauncher Class Body
+ *
+ */
+
+// c++ std libraries
+#include <cerrno>
+#include <chrono>
+#include <sstream>
+// posix
+#include <fcntl.h>
+#include <spawn.h>
+#include <unistd.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+// Radiation simulator
+#include "spectre_process_launcher.hpp"
+
+extern char** environ;
+
+SpectreProcessLauncher::SpectreProcessLauncher(){
+}
+
+SpectreProcessLauncher::~SpectreProcessLauncher(){
+}
+
+bool SpectreProcessLauncher::SplitCommand( const std::string& command, std::vector<std::string>& arguments ) const{
+	if( command.find_first_of( "\"'\\|&;<>()$`*?~{}" )!=std::string::npos ){
+		return false;
+	}
+	std::istringstream commandStream( command );
+	std::string argument;
+	while( commandStream >> argument ){
+		arguments.push_back( argument );
+	}
+	return !arguments.empty();
+}
+
+std::vector<std::string> SpectreProcessLauncher::CreateEnvironment(
+	const std::vector<std::string>& environmentVariables ) const{
+	std::vector<std::string> environment;
+	// the parent environment is not modified by any thread, it can be read concurrently
+	for( char** ev=environ; ev!=nullptr && *ev!=nullptr; ++ev ){
+		std::string variable( *ev );
+		std::string name = variable.substr( 0, variable.find('=') + 1 );
+		bool replaced = false;
+		for( auto const &v : environmentVariables ){
+			if( v.compare( 0, name.size(), name )==0 ){
+				replaced = true;
+				break;
+			}
+		}
+		if( !replaced ){
+			environment.push_back( variable );
+		}
+	}
+	environment.insert( environment.end(), environmentVariables.begin(), environmentVariables.end() );
+	return environment;
+}
+
+int SpectreProcessLauncher::Launch( const std::vector<std::string>& arguments,
+	const std::vector<std::string>& environmentVariables,
+	const std::string& outputFilePath, ProcessUsage& usage ) const{
+	usage.wall_time = 0;
+	usage.cpu_time = 0;
+	usage.max_rss = 0;
+	if( arguments.empty() ){
+		return 127;
+	}
+	std::vector<std::string> environment = CreateEnvironment( environmentVariables );
+	std::vector<char*> argv;
+	for( auto const &a : arguments ){
+		argv.push_back( const_cast<char*>( a.c_str() ) );
+	}
+	argv.push_back( nullptr );
+	std::vector<char*> envp;
+	for( auto const &e : environment ){
+		envp.push_back( const_cast<char*>( e.c_str() ) );
+	}
+	envp.push_back( nullptr );
+	// stdout redirected to the log file
+	posix_spawn_file_actions_t fileActions;
+	posix_spawn_file_actions_init( &fileActions );
+	if( !outputFilePath.empty() ){
+		posix_spawn_file_actions_addopen( &fileActions, STDOUT_FILENO,
+			outputFilePath.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644 );
+	}
+	auto startTime = std::chrono::steady_clock::now();
+	pid_t pid;
+	int spawnResult = posix_spawnp( &pid, argv.at(0), &fileActions, nullptr, argv.data(), envp.data() );
+	posix_spawn_file_actions_destroy( &fileActions );
+	if( spawnResult!=0 ){
+		return 127;
+	}
+	int status = 0;
+	struct rusage childUsage;
+	pid_t waitResult;
+	do{
+		waitResult = wait4( pid, &status, 0, &childUsage );
+	}while( waitResult<0 && errno==EINTR );
+	usage.wall_time = std::chrono::duration<double>( std::chrono::steady_clock::now() - startTime ).count();
+	if( waitResult<0 ){
+		return 127;
+	}
+	usage.cpu_time = childUsage.ru_utime.tv_sec + childUsage.ru_utime.tv_usec*1e-6
+		+ childUsage.ru_stime.tv_sec + childUsage.ru_stime.tv_usec*1e-6;
+	usage.max_rss = childUsage.ru_maxrss;
+	if( WIFEXITED(status) ){
+		return WEXITSTATUS(status);
+	}
+	if( WIFSIGNALED(status) ){
+		return 128 + WTERMSIG(status);
+	}
+	return 127;
+}
+
+int SpectreProcessLauncher::LaunchShell( const std::string& command,
+	const std::vector<std::string>& environmentVariables, ProcessUsage& usage ) const{
+	return Launch( {"/bin/sh", "-c", command}, environmentVariables, "", usage );
+}
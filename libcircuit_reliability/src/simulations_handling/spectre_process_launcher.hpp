@@ -0,0 +1,75 @@
+/**
+ * @file spectre_process_launcher.hpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * Launches the simulator processes with posix_spawn, instead of std::system.
+ * 		+ The parent process is not forked through /bin/sh.
+ * 		+ Each child gets its own environment block, so the global
+ * 		  environment is never modified (putenv is not thread safe).
+ * 		+ The resources used by each child (wall time, cpu time
+ * 		  and max resident memory) are collected with wait4.
+ *
+ */
+
+#ifndef SPECTRE_PROCESS_LAUNCHER_H
+#define SPECTRE_PROCESS_LAUNCHER_H
+
+// c++ std libraries
+#include <string>
+#include <vector>
+
+class SpectreProcessLauncher {
+public:
+	/// resources used by a child process
+	struct ProcessUsage {
+		double wall_time;
+		double cpu_time;
+		long max_rss;
+	};
+
+	SpectreProcessLauncher();
+	virtual ~SpectreProcessLauncher();
+
+	/**
+	 * @brief Splits a command in arguments
+	 *
+	 * @param command
+	 * @param arguments
+	 * @return false if the command requires a shell (quotes, redirections, pipes, variables...)
+	 */
+	bool SplitCommand( const std::string& command, std::vector<std::string>& arguments ) const;
+
+	/**
+	 * @brief Launches a process and waits for it
+	 *
+	 * @param arguments argv, arguments[0] is searched in PATH
+	 * @param environmentVariables 'NAME=VALUE' variables added to (or replacing) the parent environment
+	 * @param outputFilePath child stdout file, empty: parent stdout
+	 * @param usage resources used by the child
+	 * @return exit status of the child, 128+signal if it was killed, 127 if it could not be launched
+	 */
+	int Launch( const std::vector<std::string>& arguments,
+		const std::vector<std::string>& environmentVariables,
+		const std::string& outputFilePath, ProcessUsage& usage ) const;
+
+	/**
+	 * @brief Launches a shell command (/bin/sh -c) and waits for it
+	 *
+	 * @param command
+	 * @param environmentVariables 'NAME=VALUE' variables added to (or replacing) the parent environment
+	 * @param usage resources used by the child
+	 * @return exit status of the child, 128+signal if it was killed, 127 if it could not be launched
+	 */
+	int LaunchShell( const std::string& command,
+		const std::vector<std::string>& environmentVariables, ProcessUsage& usage ) const;
+
+private:
+	std::vector<std::string> CreateEnvironment( const std::vector<std::string>& environmentVariables ) const;
+};
+
+#endif /* SPECTRE_PROCESS_LAUNCHER_H */
@@ -0,0 +1,136 @@
+/**
+ * @file spectre_resource_broker.cpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * SpectreResourceBroker Class Body
+ *
+ */
+
+// c++ std libraries
+#include <chrono>
+// Boost
+#include "boost/filesystem.hpp"  // includes all needed Boost.Filesystem declarations
+// Radiation simulator
+#include "spectre_resource_broker.hpp"
+// constants
+#include "../global_functions_and_constants/global_constants.hpp"
+#include "../global_functions_and_constants/global_template_functions.hpp"
+#include "../global_functions_and_constants/files_folders_io_constants.hpp"
+
+SpectreResourceBroker::SpectreResourceBroker(){
+	this->log_io = nullptr;
+	this->max_spectre_instances = 0;
+	this->memory_budget = 0;
+	this->running_instances = 0;
+	this->memory_in_use = 0;
+	this->next_ticket = 0;
+	this->serving_ticket = 0;
+	this->queue_depth = 0;
+	this->max_queue_depth = 0;
+	this->granted_tokens = 0;
+	this->total_wait_time = 0;
+	this->max_wait_time = 0;
+}
+
+SpectreResourceBroker::~SpectreResourceBroker(){
+}
+
+double SpectreResourceBroker::EstimateNetlistWeight( const std::string& netlistFolder ) const{
+	boost::system::error_code ec;
+	boost::uintmax_t netlistBytes = 0;
+	boost::filesystem::directory_iterator it( netlistFolder, ec );
+	if( !ec ){
+		for( ; it!=boost::filesystem::directory_iterator(); it.increment( ec ) ){
+			const std::string fileName = it->path().filename().string();
+			if( fileName.size()>=kCircutFileSufix.size()
+				&& fileName.compare( fileName.size()-kCircutFileSufix.size(), kCircutFileSufix.size(), kCircutFileSufix )==0 ){
+				boost::uintmax_t fileBytes = boost::filesystem::file_size( it->path(), ec );
+				if( !ec ){
+					netlistBytes += fileBytes;
+				}
+			}
+		}
+	}
+	return kSpectreBaseMemoryMB + kSpectreMemoryMBPerNetlistKB*netlistBytes/1024.0;
+}
+
+bool SpectreResourceBroker::TokenAvailable( const double weight ) const{
+	return ( max_spectre_instances==0 || running_instances<max_spectre_instances )
+		&& ( memory_budget<=0 || running_instances==0 || memory_in_use + weight<=memory_budget );
+}
+
+void SpectreResourceBroker::Acquire( const double weight ){
+	std::chrono::steady_clock::time_point requestTime = std::chrono::steady_clock::now();
+	boost::unique_lock<boost::mutex> lock( mutex );
+	unsigned long ticket = next_ticket++;
+	++queue_depth;
+	if( max_queue_depth<queue_depth ){
+		max_queue_depth = queue_depth;
+	}
+	while( ticket!=serving_ticket || !TokenAvailable( weight ) ){
+		token_released.wait( lock );
+	}
+	++serving_ticket;
+	--queue_depth;
+	++running_instances;
+	memory_in_use += weight;
+	++granted_tokens;
+	double waitTime = std::chrono::duration<double>( std::chrono::steady_clock::now() - requestTime ).count();
+	total_wait_time += waitTime;
+	if( max_wait_time<waitTime ){
+		max_wait_time = waitTime;
+	}
+	// the next request may also fit
+	token_released.notify_all();
+}
+
+void SpectreResourceBroker::Release( const double weight ){
+	boost::unique_lock<boost::mutex> lock( mutex );
+	--running_instances;
+	memory_in_use -= weight;
+	if( running_instances==0 ){
+		memory_in_use = 0;
+	}
+	token_released.notify_all();
+}
+
+void SpectreResourceBroker::ReportStatistics(){
+	if( log_io==nullptr ){
+		return;
+	}
+	boost::unique_lock<boost::mutex> lock( mutex );
+	log_io->ReportInfo2AllLogs( "[performance] Spectre tokens granted: " + number2String(granted_tokens)
+		+ ", max queue depth: " + number2String(max_queue_depth)
+		+ ", total wait time: " + number2String(total_wait_time) + "s"
+		+ ", max wait time: " + number2String(max_wait_time) + "s" );
+}
+
+unsigned int SpectreResourceBroker::get_queue_depth(){
+	boost::unique_lock<boost::mutex> lock( mutex );
+	return queue_depth;
+}
+
+unsigned int SpectreResourceBroker::get_max_queue_depth(){
+	boost::unique_lock<boost::mutex> lock( mutex );
+	return max_queue_depth;
+}
+
+unsigned long SpectreResourceBroker::get_granted_tokens(){
+	boost::unique_lock<boost::mutex> lock( mutex );
+	return granted_tokens;
+}
+
+double SpectreResourceBroker::get_total_wait_time(){
+	boost::unique_lock<boost::mutex> lock( mutex );
+	return total_wait_time;
+}
+
+double SpectreResourceBroker::get_max_wait_time(){
+	boost::unique_lock<boost::mutex> lock( mutex );
+	return max_wait_time;
+}
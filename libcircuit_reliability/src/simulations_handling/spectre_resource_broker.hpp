@@ -0,0 +1,111 @@
+/**
+ * @file spectre_resource_broker.hpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * Tokens required by every Spectre run, shared by all the simulation levels.
+ * 		+ max_spectre_instances: simulator licenses (concurrent Spectre runs)
+ * 		+ memory_budget: RAM (MB), each run is weighted with the expected
+ * 		  memory of its netlist
+ * Tokens are granted in request order. Queue depth and wait times
+ * are accounted for tuning the limits.
+ *
+ */
+
+#ifndef SPECTRE_RESOURCE_BROKER_H
+#define SPECTRE_RESOURCE_BROKER_H
+
+// c++ std libraries
+#include <string>
+// Boost
+#include <boost/thread.hpp>
+// Radiation simulator
+#include "../io_handling/log_io.hpp"
+
+class SpectreResourceBroker {
+public:
+	SpectreResourceBroker();
+	virtual ~SpectreResourceBroker();
+
+	/**
+	 * @brief Sets the max number of concurrent Spectre runs (0: no limit)
+	 *
+	 * @param max_spectre_instances
+	 */
+	void set_max_spectre_instances( const unsigned int max_spectre_instances ){
+		this->max_spectre_instances = max_spectre_instances; }
+	unsigned int get_max_spectre_instances() const { return max_spectre_instances; }
+	/**
+	 * @brief Sets the memory (MB) shared by the concurrent Spectre runs (0: no limit)
+	 *
+	 * @param memory_budget
+	 */
+	void set_memory_budget( const double memory_budget ){
+		this->memory_budget = memory_budget; }
+	double get_memory_budget() const { return memory_budget; }
+	void set_log_io( LogIO* log_io ){ this->log_io = log_io; }
+
+	/**
+	 * @brief Expected Spectre memory (MB) of the netlists in a simulation folder
+	 *
+	 * @param netlistFolder
+	 * @return token weight
+	 */
+	double EstimateNetlistWeight( const std::string& netlistFolder ) const;
+
+	/**
+	 * @brief Blocks until a token of the given weight is granted
+	 * @details A run heavier than the whole budget is granted when no other run is active
+	 *
+	 * @param weight
+	 */
+	void Acquire( const double weight );
+
+	/**
+	 * @brief Returns a previously acquired token
+	 *
+	 * @param weight
+	 */
+	void Release( const double weight );
+
+	/**
+	 * @brief Reports the tokens counters
+	 */
+	void ReportStatistics();
+
+	unsigned int get_queue_depth();
+	unsigned int get_max_queue_depth();
+	unsigned long get_granted_tokens();
+	/// accumulated wait time (s)
+	double get_total_wait_time();
+	/// longest wait time (s)
+	double get_max_wait_time();
+
+private:
+	LogIO* log_io;
+	boost::mutex mutex;
+	boost::condition_variable token_released;
+	// limits
+	unsigned int max_spectre_instances;
+	double memory_budget;
+	// in use
+	unsigned int running_instances;
+	double memory_in_use;
+	// request order
+	unsigned long next_ticket;
+	unsigned long serving_ticket;
+	// counters
+	unsigned int queue_depth;
+	unsigned int max_queue_depth;
+	unsigned long granted_tokens;
+	double total_wait_time;
+	double max_wait_time;
+
+	bool TokenAvailable( const double weight ) const;
+};
+
+#endif /* SPECTRE_RESOURCE_BROKER_H */
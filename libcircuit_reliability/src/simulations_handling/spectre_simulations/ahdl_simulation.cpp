@@ -34,7 +34,6 @@ void AHDLSimulation::RunSimulation( ){
 		log_io->ReportError2AllLogs( "RunSimulation had not been previously set up. ");
 		return;
 	}
-	ConfigureEnvironmentVariables();
 	ShowEnvironmentVariables();
 	if (simulation_parameters==nullptr){
 		log_io->ReportError2AllLogs( "simulation_parameters is nullptr. ");
@@ -56,16 +55,10 @@ bool AHDLSimulation::TestSetUp(){
 }
 
 int AHDLSimulation::RunSpectre(){
-	std::string execCommand = spectre_command + " "
-		+ spectre_command_log_arg + " " + folder + kFolderSeparator + kSpectreLogFile + " "
-		+ spectre_command_folder_arg + " " + folder + kFolderSeparator + kSpectreResultsFolder + " "
-		+ folder + kFolderSeparator + kMainNetlistFile
-		+ " " + post_spectre_command + " " + folder + kFolderSeparator + kSpectreStandardLogsFile ;
-
 	log_io->ReportPlainStandard( k2Tab + "#" + simulation_id + " scenario: Simulating singular scenario."  );
 	log_io->ReportPlain2Log( k2Tab + "#" + simulation_id + " scenario: Simulating singular scenario." );
 
-	int spectre_result = std::system( execCommand.c_str() ) ;
+	int spectre_result = ExecuteSpectre( folder, &basic_simulation_results );
 	if(spectre_result>0){
 		correctly_simulated = false;
 		log_io->ReportError2AllLogs( "Unexpected Spectre spectre_result for singular scenario #"
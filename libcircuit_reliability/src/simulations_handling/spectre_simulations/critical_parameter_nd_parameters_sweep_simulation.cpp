@@ -14,10 +14,12 @@
 
 // math
 #include <cmath>
+#include <limits>
 // Boost
 #include "boost/filesystem.hpp" // includes all needed Boost.Filesystem declarations
 // Radiation simulator
 #include "critical_parameter_nd_parameters_sweep_simulation.hpp"
+#include "../scenario_stager.hpp"
 #include "../../io_handling/results_processor.hpp"
 #include "../../io_handling/raw_format_processor.hpp"
 // constants
@@ -35,6 +37,7 @@ CriticalParameterNDParameterSweepSimulation::CriticalParameterNDParameterSweepSi
 	this->max_parallel_profile_instances = 15;
 	this->plot_last_transients = false;
 	this->plot_critical_parameter_value_evolution = false;
+	this->adaptive_sweep_threshold = 0;
 	// injection mode related
 	this->has_additional_injection = false;
 }
@@ -53,7 +56,7 @@ void CriticalParameterNDParameterSweepSimulation::RunSimulation( ){
 		 log_io->ReportError2AllLogs( "RunSimulation had not been previously set up. ");
 		 return;
 	}
-	boost::thread_group mainTG;
+	SimulationsTaskGroup mainTG( thread_pool, max_parallel_profile_instances );
 	// params to be sweeped
 	std::vector<SimulationParameter*> parameters2sweep;
 	// Threads Creation
@@ -75,36 +78,42 @@ void CriticalParameterNDParameterSweepSimulation::RunSimulation( ){
 		correctly_processed = false;
 		return;
 	}
-	// Environment: maybe ConfigureEnvironmentVariables is required. see critical_parameter_1d_....
+	// Environment: each spectre process gets its own ahdl environment (GetSpectreEnvironmentVariables)
 	log_io->ReportThread( "Total threads to be simulated: " + number2String(totalThreads) + ". Max number of sweep threads: " + number2String(max_parallel_profile_instances), 1 );
-	// parallel threads control
-	unsigned int runningThreads = 0;
-	unsigned int threadsCount = 0;
-	// current parameter sweep indexes
-	std::vector<unsigned int> parameterCountIndexes(parameters2sweep.size(), 0);
 	critical_parameter_value_simulations_vector.set_group_name("critical_parameter_value_simulations_vector");
-	critical_parameter_value_simulations_vector.ReserveSimulationsInMemory( totalThreads );
-	while( threadsCount<totalThreads ){
-		// wait for resources
-		WaitForResources( runningThreads, max_parallel_profile_instances, mainTG, threadsCount );
-		// CreateProfile sets all parameter values, and after the simulation object
-		// is created it can be updated.
-		// Thus, it avoids race conditions when updating parameterCountIndexes and parameters2sweep
-		CriticalParameterValueSimulation* pCPVS = CreateProfile(parameterCountIndexes, parameters2sweep, threadsCount);
-		if( pCPVS==nullptr ){
-			log_io->ReportError2AllLogs( "Null CreateProfile " + number2String(threadsCount) );
+	profile_simulation_positions.resize( totalThreads );
+	if( adaptive_sweep_threshold>0 ){
+		if( !RunAdaptiveSweep( mainTG, parameters2sweep ) ){
 			correctly_simulated = false;
 			correctly_processed = false;
 			return;
 		}
-		critical_parameter_value_simulations_vector.AddSpectreSimulation( pCPVS );
-		mainTG.add_thread( new boost::thread(boost::bind(&CriticalParameterValueSimulation::RunSimulation, pCPVS)) );
-		// update variables
-		UpdateParameterSweepIndexes( parameterCountIndexes, parameters2sweep);
-		++threadsCount;
-		++runningThreads;
-	}
-	mainTG.join_all();
+	}else{
+		unsigned int threadsCount = 0;
+		// current parameter sweep indexes
+		std::vector<unsigned int> parameterCountIndexes(parameters2sweep.size(), 0);
+		critical_parameter_value_simulations_vector.ReserveSimulationsInMemory( totalThreads );
+		while( threadsCount<totalThreads ){
+			// CreateProfile sets all parameter values, and after the simulation object
+			// is created it can be updated.
+			// Thus, it avoids race conditions when updating parameterCountIndexes and parameters2sweep
+			CriticalParameterValueSimulation* pCPVS = CreateProfile(parameterCountIndexes, parameters2sweep, threadsCount);
+			if( pCPVS==nullptr ){
+				log_io->ReportError2AllLogs( "Null CreateProfile " + number2String(threadsCount) );
+				correctly_simulated = false;
+				correctly_processed = false;
+				return;
+			}
+			profile_simulation_positions.at(threadsCount) = threadsCount;
+			critical_parameter_value_simulations_vector.AddSpectreSimulation( pCPVS );
+			mainTG.Run( boost::bind(&CriticalParameterNDParameterSweepSimulation::RunProfile,
+				this, pCPVS, parameterCountIndexes) );
+			// update variables
+			UpdateParameterSweepIndexes( parameterCountIndexes, parameters2sweep);
+			++threadsCount;
+		}
+		mainTG.Wait();
+	}
 	// check if every simulation ended correctly
 	correctly_simulated = critical_parameter_value_simulations_vector.CheckCorrectlySimulated();
 	correctly_processed = critical_parameter_value_simulations_vector.CheckCorrectlyProcessed();
@@ -117,6 +126,63 @@ void CriticalParameterNDParameterSweepSimulation::RunSimulation( ){
 	log_io->ReportPlain2Log( "END OF CriticalParameterNDParameterSweepSimulation::RunSimulation" );
 }
 
+bool CriticalParameterNDParameterSweepSimulation::RunAdaptiveSweep(
+	SimulationsTaskGroup& mainTG, std::vector<SimulationParameter*>& parameters2sweep ){
+	std::vector<unsigned int> sweepStepsNumbers;
+	for( auto const &p : parameters2sweep ){
+		sweepStepsNumbers.push_back( p->get_sweep_steps_number() );
+	}
+	adaptive_sampler.set_refinement_threshold( adaptive_sweep_threshold );
+	adaptive_sampler.Init( sweepStepsNumbers );
+	std::vector<unsigned int> levelProfiles;
+	unsigned int level = 0;
+	while( adaptive_sampler.GetNextProfiles( levelProfiles ) ){
+		log_io->ReportThread( "#" + simulation_id + " adaptive sweep level " + number2String(level++)
+			+ ", profiles: " + number2String(levelProfiles.size()), 1 );
+		std::vector<CriticalParameterValueSimulation*> levelSimulations;
+		for( auto const &ndProfileIndex : levelProfiles ){
+			auto parameterCountIndexes = adaptive_sampler.GetParameterCountIndexes( ndProfileIndex );
+			CriticalParameterValueSimulation* pCPVS = CreateProfile(parameterCountIndexes, parameters2sweep, ndProfileIndex);
+			if( pCPVS==nullptr ){
+				log_io->ReportError2AllLogs( "Null CreateProfile " + number2String(ndProfileIndex) );
+				mainTG.Wait();
+				return false;
+			}
+			profile_simulation_positions.at(ndProfileIndex) = critical_parameter_value_simulations_vector.get_spectre_simulations()->size();
+			critical_parameter_value_simulations_vector.AddSpectreSimulation( pCPVS );
+			levelSimulations.push_back( pCPVS );
+			mainTG.Run( boost::bind(&CriticalParameterNDParameterSweepSimulation::RunProfile,
+				this, pCPVS, parameterCountIndexes) );
+		}
+		// the next level depends on the critical values of this one
+		mainTG.Wait();
+		for( auto const &pCPVS : levelSimulations ){
+			adaptive_sampler.SetProfileValue( pCPVS->get_n_d_profile_index(),
+				pCPVS->get_correctly_simulated() && pCPVS->get_correctly_processed() ?
+					pCPVS->get_critical_parameter_value() : std::numeric_limits<double>::quiet_NaN() );
+		}
+	}
+	adaptive_sampler.InterpolateProfiles();
+	log_io->ReportPlainStandard( k2Tab + "#" + simulation_id + " adaptive sweep, simulated profiles: "
+		+ number2String(adaptive_sampler.get_simulated_profiles_count()) + "/"
+		+ number2String(adaptive_sampler.get_total_profiles()) );
+	return true;
+}
+
+CriticalParameterValueSimulation* CriticalParameterNDParameterSweepSimulation::GetProfileSimulation(
+	const unsigned int ndProfileIndex ){
+	unsigned int sourceProfile = adaptive_sweep_threshold>0 ? adaptive_sampler.GetSourceProfile( ndProfileIndex ) : ndProfileIndex;
+	return dynamic_cast<CriticalParameterValueSimulation*>(
+		critical_parameter_value_simulations_vector.get_spectre_simulations()->at( profile_simulation_positions.at(sourceProfile) ) );
+}
+
+double CriticalParameterNDParameterSweepSimulation::GetProfileCriticalValue( const unsigned int ndProfileIndex ){
+	if( adaptive_sweep_threshold>0 ){
+		return adaptive_sampler.GetProfileValue( ndProfileIndex );
+	}
+	return GetProfileSimulation( ndProfileIndex )->get_critical_parameter_value();
+}
+
 CriticalParameterValueSimulation* CriticalParameterNDParameterSweepSimulation::CreateProfile(
 	const std::vector<unsigned int>& parameterCountIndexes,
 	std::vector<SimulationParameter*>& parameters2sweep, const unsigned int ndProfileIndex ){
@@ -129,15 +195,10 @@ CriticalParameterValueSimulation* CriticalParameterNDParameterSweepSimulation::C
 		 log_io->ReportError2AllLogs( "Error running profile" );
 		 return nullptr;
 	}
-	// copy only files to folder
-	// find . -maxdepth 1 -type f -exec cp {} destination_path \;
-	std::string copyNetlists0 = "find ";
-	std::string copyNetlists1 = " -maxdepth 1 -type f -exec cp {} ";
-	std::string copyNetlists2 = " \\;";
-	std::string copyNetlists;
-	copyNetlists = copyNetlists0 + folder + copyNetlists1 + currentFolder + copyNetlists2;
-	if( std::system( copyNetlists.c_str() ) > 0){
-		 log_io->ReportError2AllLogs( k2Tab + "-> Error while copying netlist to '" + currentFolder + "'." );
+	// stage only files to folder, the netlists are shared (hardlinks)
+	ScenarioStager scenarioStager;
+	if( !scenarioStager.StageFolder( folder, currentFolder ) ){
+		 log_io->ReportError2AllLogs( k2Tab + "-> Error while staging netlist in '" + currentFolder + "'." );
 		 log_io->ReportError2AllLogs( "Error running sweep" );
 		 return nullptr;
 	}
@@ -165,6 +226,8 @@ CriticalParameterValueSimulation* CriticalParameterNDParameterSweepSimulation::C
 	// pCPVS->set_parameter_index( paramIndex );
 	// pCPVS->set_sweep_index( sweepIndex );
 	pCPVS->set_log_io( log_io );
+	pCPVS->set_thread_pool( thread_pool );
+	pCPVS->set_resource_broker( resource_broker );
 	pCPVS->set_altered_scenario_index( altered_scenario_index );
 	pCPVS->set_golden_metrics_structure( golden_metrics_structure );
 	// Spectre command and args
@@ -190,7 +253,12 @@ CriticalParameterValueSimulation* CriticalParameterNDParameterSweepSimulation::C
 	pCPVS->set_main_transient_analysis( main_transient_analysis );
 	pCPVS->set_process_metrics( true );
 	pCPVS->set_export_processed_metrics( export_processed_metrics );
+	pCPVS->set_binary_processed_transients( binary_processed_transients );
 	pCPVS->set_export_metric_errors( export_metric_errors );
+	pCPVS->set_streaming_analysis( streaming_analysis );
+	pCPVS->set_critical_parameter_parallel_probes( critical_parameter_parallel_probes );
+	pCPVS->set_critical_parameter_root_finding( critical_parameter_root_finding );
+	pCPVS->set_critical_parameter_batch_probes( critical_parameter_batch_probes );
 	// copy of simulation_parameters
 	pCPVS->CopySimulationParameters( *simulation_parameters );
 	/// Update golden parameter
@@ -209,6 +277,22 @@ CriticalParameterValueSimulation* CriticalParameterNDParameterSweepSimulation::C
 	return pCPVS;
 }
 
+void CriticalParameterNDParameterSweepSimulation::RunProfile( CriticalParameterValueSimulation* pCPVS,
+	const std::vector<unsigned int> parameterCountIndexes ){
+	// initial bracket predicted from the neighbour profiles finished so far
+	double predictedCriticalValue;
+	if( warm_start_store!=nullptr
+		&& warm_start_store->PredictCriticalValue( simulation_id, parameterCountIndexes, predictedCriticalValue ) ){
+		pCPVS->set_warm_start_critical_value( predictedCriticalValue );
+	}
+	pCPVS->RunSimulation();
+	// neighbour profiles warm start
+	if( warm_start_store!=nullptr && pCPVS->get_correctly_simulated() && pCPVS->get_correctly_processed() ){
+		warm_start_store->AddCriticalValue( simulation_id, pCPVS->get_n_d_profile_index(),
+			parameterCountIndexes, pCPVS->get_critical_parameter_value() );
+	}
+}
+
 bool CriticalParameterNDParameterSweepSimulation::TestSetUp(){
 	if( golden_critical_parameter==nullptr
 		 || simulation_parameters==nullptr ){
@@ -373,13 +457,15 @@ bool CriticalParameterNDParameterSweepSimulation::GenerateAndPlotGeneralResults(
 		unsigned int profileCount = 0;
 		bool severalSweepParameter = parameters2sweep.size()>1;
 		auto sweepParameter = parameters2sweep.at(0);
-		for( auto const &simulation : *(critical_parameter_value_simulations_vector.get_spectre_simulations()) ){
-			CriticalParameterValueSimulation* convSim = dynamic_cast<CriticalParameterValueSimulation*>(simulation);
+		for( unsigned int ndProfileIndex=0; ndProfileIndex<profile_simulation_positions.size(); ++ndProfileIndex ){
+			// adaptive sweeps: not simulated profiles get the results of the nearest simulated one
+			CriticalParameterValueSimulation* convSim = GetProfileSimulation( ndProfileIndex );
+			double criticalParameterValue = GetProfileCriticalValue( ndProfileIndex );
 			std::string auxIndexes = getIndexCode( auxiliarIndexes );
 			std::string auxSpectreError = convSim->get_correctly_simulated() ? "0" : "1";
 			gnuplotMapFile << std::defaultfloat << ( severalSweepParameter ? profileCount : sweepParameter->GetSweepValue(profileCount) )
-				<< " " << auxIndexes << " " << convSim->get_critical_parameter_value();
-			maxCritCharge = convSim->get_critical_parameter_value()>maxCritCharge ? convSim->get_critical_parameter_value() : maxCritCharge;
+				<< " " << auxIndexes << " " << criticalParameterValue;
+			maxCritCharge = criticalParameterValue>maxCritCharge ? criticalParameterValue : maxCritCharge;
 			// mag errors
 			auto magErrors = convSim->get_last_valid_transient_simulation_results()->get_metrics_errors();
 			for( auto const &m : *magErrors ){
@@ -488,19 +574,18 @@ bool CriticalParameterNDParameterSweepSimulation::GenerateAndPlotItemizedPlane(
 		gnuplotMapFile << "#" << p1->get_name() << " " << p2->get_name()
 			<< " "  << golden_critical_parameter->get_name()
 			<< " #MAG_i_name #MAG_i_maxErrorMetric #MAG_i_maxErrorGlobal\n";
-		unsigned int profileCount = 0;
 		unsigned int p1SweepCount = 0;
 		unsigned int p2SweepCount = 0;
-		for( auto const &simulation : *(critical_parameter_value_simulations_vector.get_spectre_simulations()) ){
-			if( vectorContains(profileIndexesInPlane, profileCount) ){
-				CriticalParameterValueSimulation* convSim = dynamic_cast<CriticalParameterValueSimulation*>(simulation);
+		for( unsigned int ndProfileIndex=0; ndProfileIndex<profile_simulation_positions.size(); ++ndProfileIndex ){
+			if( vectorContains(profileIndexesInPlane, ndProfileIndex) ){
+				CriticalParameterValueSimulation* convSim = GetProfileSimulation( ndProfileIndex );
 				if( p2SweepCount==p2->get_sweep_steps_number() ){
 					p2SweepCount = 0;
 					++p1SweepCount;
 					gnuplotMapFile << "\n";
 				}
 				gnuplotMapFile << p1->GetSweepValue(p1SweepCount) << " " << p2->GetSweepValue(p2SweepCount++)
-					<< " " << convSim->get_critical_parameter_value();
+					<< " " << GetProfileCriticalValue( ndProfileIndex );
 				// mag errors
 				auto magErrors = convSim->get_last_valid_transient_simulation_results()->get_metrics_errors();
 				for( auto const &m : *magErrors ){
@@ -508,7 +593,6 @@ bool CriticalParameterNDParameterSweepSimulation::GenerateAndPlotItemizedPlane(
 				}
 				gnuplotMapFile << "\n";
 			}// update counters
-			++profileCount;
 			UpdateParameterSweepIndexes( auxiliarIndexes, parameters2sweep );
 		}
 	}catch (std::exception const& ex) {
@@ -19,6 +19,7 @@
 #include "spectre_simulation.hpp"
 #include "spectre_simulations_vector.hpp"
 #include "critical_parameter_value_simulation.hpp"
+#include "../adaptive_nd_sweep_sampler.hpp"
 // netlist modeling
 #include "../../netlist_modeling/simulation_parameter.hpp"
 #include "../../netlist_modeling/statements/control_statement.hpp"
@@ -85,6 +86,16 @@ public:
 	void set_plot_critical_parameter_value_evolution ( const bool plot_critical_parameter_value_evolution) {
 		this->plot_critical_parameter_value_evolution = plot_critical_parameter_value_evolution; }
 
+	/**
+	 * @brief Sets adaptive_sweep_threshold
+	 * @details Max relative change of the critical values in a not refined sweep cell.
+	 * 0 simulates the full cartesian sweep.
+	 *
+	 * @param adaptive_sweep_threshold
+	 */
+	void set_adaptive_sweep_threshold( const double adaptive_sweep_threshold ){
+		this->adaptive_sweep_threshold = adaptive_sweep_threshold; }
+
 	// for use outside [profile files]
 	std::vector<unsigned int>* get_out_profile_c_i_mean(){ return &out_profile_c_i_mean; }
 		// for use outside [planes files]
@@ -114,6 +125,11 @@ private:
 	bool plot_last_transients;
 	/// plot_critical_parameter_value_evolution
 	bool plot_critical_parameter_value_evolution;
+	/// adaptive sampling of the sweep (0: full sweep)
+	double adaptive_sweep_threshold;
+	AdaptiveNDSweepSampler adaptive_sampler;
+	/// nd profile index -> position in critical_parameter_value_simulations_vector
+	std::vector<unsigned int> profile_simulation_positions;
 
 	/// offset to crit max value
 	const unsigned int out_gnuplot_crit_param_offset = 3;
@@ -155,6 +171,42 @@ private:
 		const std::string& currentFolder, const std::vector<unsigned int> & parameterCountIndexes,
 		std::vector<SimulationParameter*>& parameters2sweep, const int ndProfileIndex  );
 
+	/**
+	 * @brief Simulates the coarse grid profiles and refines the cells with sharp critical value changes
+	 *
+	 * @param mainTG
+	 * @param parameters2sweep
+	 * @return false if a profile can not be created
+	 */
+	bool RunAdaptiveSweep( SimulationsTaskGroup& mainTG, std::vector<SimulationParameter*>& parameters2sweep );
+
+	/**
+	 * @brief Simulation providing the results of a profile
+	 * @details The profile one or, in adaptive sweeps, the nearest simulated profile one
+	 *
+	 * @param ndProfileIndex
+	 * @return critical parameter value simulation
+	 */
+	CriticalParameterValueSimulation* GetProfileSimulation( const unsigned int ndProfileIndex );
+
+	/**
+	 * @brief Simulated or, in adaptive sweeps, interpolated critical value of a profile
+	 *
+	 * @param ndProfileIndex
+	 * @return critical parameter value
+	 */
+	double GetProfileCriticalValue( const unsigned int ndProfileIndex );
+
+	/**
+	 * @brief Runs a profile, warm started from the neighbour profiles finished so far.
+	 * Its critical value is stored for the warm start of the next ones
+	 *
+	 * @param pCPVS
+	 * @param parameterCountIndexes sweep indexes of the profile
+	 */
+	void RunProfile( CriticalParameterValueSimulation* pCPVS,
+		const std::vector<unsigned int> parameterCountIndexes );
+
 	/**
 	 * @brief Virtual overrides TestSetup
 	 *
@@ -11,15 +11,22 @@
  *
  */
 
+// c++ std libraries
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <limits>
 // Boost
 #include "boost/filesystem.hpp" // includes all needed Boost.Filesystem declarations
 // Radiation simulator
 #include "critical_parameter_value_simulation.hpp"
+#include "../scenario_stager.hpp"
 // constants
 #include "../../global_functions_and_constants/gnuplot_constants.hpp"
 #include "../../global_functions_and_constants/global_constants.hpp"
 #include "../../global_functions_and_constants/global_template_functions.hpp"
 #include "../../global_functions_and_constants/files_folders_io_constants.hpp"
+#include "../../global_functions_and_constants/include_statement_constants.hpp"
 
 CriticalParameterValueSimulation::CriticalParameterValueSimulation() {
 	this->critical_parameter_value = kNotDefinedInt;
@@ -32,6 +39,9 @@ CriticalParameterValueSimulation::CriticalParameterValueSimulation() {
 	// critical parameter
 	this->plot_last_transients = false;
 	this->plot_critical_parameter_value_evolution = false;
+	// warm start
+	this->warm_start = false;
+	this->warm_start_critical_value = kNotDefinedInt;
 }
 
 CriticalParameterValueSimulation::~CriticalParameterValueSimulation(){
@@ -75,8 +85,17 @@ void CriticalParameterValueSimulation::RunSimulation(){
 	double currentCriticalParameterValue;
 	std::string s_currentCriticalParameterValue;
 	// Environment
-	ConfigureEnvironmentVariables();
 	ShowEnvironmentVariables();
+	// k-ary section search. Montecarlo nested probes share the processed results file
+	if( critical_parameter_parallel_probes>1 || warm_start || critical_parameter_root_finding ){
+		if( is_montecarlo_nested_simulation && export_processed_metrics ){
+			log_io->ReportPlain2Log( k2Tab + "#" + simulation_id
+				+ " scenario: processed metrics are exported, the critical value is searched by bisection." );
+		}else{
+			RunBracketedCriticalValueSearch();
+			return;
+		}
+	}
 	// only for nested simulations
 	TransientSimulationResults* lastResults;
 	parameterVariationCount = 0;
@@ -85,8 +104,7 @@ void CriticalParameterValueSimulation::RunSimulation(){
 	lastResults = maxValueResults;
 	currentCriticalParameterValue = golden_critical_parameter->get_value_max();
 	critical_parameter_values_evolution.push_back( currentCriticalParameterValue );
-	// Register Parameters
-	maxValueResults->RegisterSimulationParameters(simulation_parameters);
+	critical_parameter_values_rounds.push_back( parameterVariationCount );
 	// simulation_id is already "s_x_prof"
 	maxValueResults->set_full_id( simulation_id + "_pvc_" + number2String(parameterVariationCount) + "_mc_NaN" );
 	maxValueResults->set_title( maxValueResults->get_full_id() );
@@ -121,8 +139,7 @@ void CriticalParameterValueSimulation::RunSimulation(){
 	lastResults = minValueResults;
 	currentCriticalParameterValue = golden_critical_parameter->get_value_min();
 	critical_parameter_values_evolution.push_back( currentCriticalParameterValue );
-	// Register Parameters
-	minValueResults->RegisterSimulationParameters(simulation_parameters);
+	critical_parameter_values_rounds.push_back( parameterVariationCount );
 	minValueResults->set_full_id( simulation_id + "_pvc_" + number2String(parameterVariationCount) + "_mc_NaN" );
 	minValueResults->set_title( maxValueResults->get_full_id() );
 	if( !SimulateParameterCriticalValue( *minValueResults, parameterVariationCount,
@@ -179,11 +196,10 @@ void CriticalParameterValueSimulation::RunSimulation(){
 	double previousCriticalParameterValue = currentCriticalParameterValue;
 	while( !endOfSweep ){
 		critical_parameter_values_evolution.push_back( currentCriticalParameterValue );
+		critical_parameter_values_rounds.push_back( parameterVariationCount );
 		TransientSimulationResults* variationResults = new TransientSimulationResults();
 		variationResults->set_full_id( simulation_id + "_pvc_" + number2String(parameterVariationCount) + "_mc_NaN" );
 		variationResults->set_title( maxValueResults->get_full_id() );
-		// Register Parameters
-		variationResults->RegisterSimulationParameters( simulation_parameters );
 		// simulate
 		if( !SimulateParameterCriticalValue( *variationResults, parameterVariationCount,
 			currentCriticalParameterValue, localSimulationFolder, localSimulationId ) ){
@@ -243,6 +259,543 @@ void CriticalParameterValueSimulation::RunSimulation(){
 	ReportEndOfCriticalParameterValueSimulation( localSimulationFolder, localSimulationId, *lastResults, SENSITIVE_2_OTHER );
 }
 
+void CriticalParameterValueSimulation::RunBracketedCriticalValueSearch(){
+	int parameterVariationCount = 0;
+	unsigned int round = 0;
+	#ifdef SPECTRE_SIMULATIONS_VERBOSE
+		if(!is_nested_simulation ){
+			log_io->ReportPlainStandard( k2Tab + "#" + simulation_id
+				+ " scenario, concurrent probes: "  + number2String(critical_parameter_parallel_probes)
+				+ ", warm start: "  + number2String(warm_start)
+				+ ", root finding: "  + number2String(critical_parameter_root_finding)
+				+ ", parameter value change mode: "  + number2String(golden_critical_parameter->get_value_change_mode()));
+		}
+	#endif
+	// probes of the max working and min not working parameter values simulated.
+	// Their results are kept until they are updated
+	ParameterProbe workingProbe;
+	ParameterProbe notWorkingProbe;
+	int bracketStatus = BRACKET_NOT_FOUND;
+	if( warm_start ){
+		bracketStatus = FindWarmStartBracket( workingProbe, notWorkingProbe, parameterVariationCount, round );
+		if( bracketStatus==BRACKET_NOT_FOUND ){
+			log_io->ReportPlain2Log( k2Tab + "#" + simulation_id + " scenario: warm start failed, searching the whole range." );
+			++round;
+		}
+	}
+	if( bracketStatus==BRACKET_NOT_FOUND ){
+		bracketStatus = FindBoundariesBracket( workingProbe, notWorkingProbe, parameterVariationCount, round );
+	}
+	if( bracketStatus==BRACKET_FOUND ){
+		SearchCriticalValueInBracket( workingProbe, notWorkingProbe, parameterVariationCount, round );
+	}
+}
+
+int CriticalParameterValueSimulation::FindBoundariesBracket(
+	ParameterProbe& workingProbe, ParameterProbe& notWorkingProbe,
+	int& parameterVariationCount, unsigned int& round ){
+	// Max and min values are simulated concurrently
+	std::vector<ParameterProbe> boundaryProbes( 2 );
+	InitProbe( boundaryProbes.at(0), parameterVariationCount++, golden_critical_parameter->get_value_max(), round );
+	InitProbe( boundaryProbes.at(1), parameterVariationCount++, golden_critical_parameter->get_value_min(), round );
+	SimulateProbes( boundaryProbes );
+	ParameterProbe& maxProbe = boundaryProbes.at(0);
+	ParameterProbe& minProbe = boundaryProbes.at(1);
+	if( !maxProbe.simulated && maxProbe.results->get_spectre_result()<=0 ){ //not a spectre problem
+		correctly_simulated = maxProbe.results->get_spectre_result()==0;
+		correctly_processed = false;
+		return SEARCH_ENDED;
+	}
+	if( maxProbe.results->get_reliability_result()==kScenarioNotSensitive ){
+		critical_parameter_value = maxProbe.value;
+		not_affected_by_max_value = true;
+		// min value was not required
+		HandleIntermediatePlotAndRawResults( *minProbe.results, minProbe.id );
+		SetLastTransientSimulationResults( maxProbe.results );
+		// this already plots and deletes (if necesary the files)
+		ReportEndOfCriticalParameterValueSimulation( maxProbe.folder, maxProbe.id, *maxProbe.results, NOT_SENSITIVE_2_MAX );
+		return SEARCH_ENDED;
+	}
+	if( !minProbe.simulated ){
+		correctly_simulated = minProbe.results->get_spectre_result()==0;
+		correctly_processed = false;
+		return SEARCH_ENDED;
+	}
+	if( minProbe.results->get_reliability_result()==kScenarioSensitive ){
+		critical_parameter_value = minProbe.value;
+		affected_by_min_value = true;
+		HandleIntermediatePlotAndRawResults( *maxProbe.results, maxProbe.id );
+		SetLastTransientSimulationResults( minProbe.results );
+		// this already plots and deletes (if necesary the files)
+		ReportEndOfCriticalParameterValueSimulation( minProbe.folder, minProbe.id, *minProbe.results, SENSITIVE_2_MIN );
+		return SEARCH_ENDED;
+	}
+	// handle scenarios (plotting and files deleting)
+	HandleIntermediatePlotAndRawResults( *minProbe.results, minProbe.id );
+	workingProbe = minProbe;
+	notWorkingProbe = maxProbe;
+	return BRACKET_FOUND;
+}
+
+int CriticalParameterValueSimulation::FindWarmStartBracket(
+	ParameterProbe& workingProbe, ParameterProbe& notWorkingProbe,
+	int& parameterVariationCount, unsigned int& round ){
+	const double valueMin = golden_critical_parameter->get_value_min();
+	const double valueMax = golden_critical_parameter->get_value_max();
+	double widening = 1 + kCriticalParameterWarmStartMargin;
+	double predictedMax = std::min( warm_start_critical_value*widening, valueMax );
+	double predictedMin = std::max( warm_start_critical_value/widening, valueMin );
+	if( !(predictedMin<predictedMax) ){
+		return BRACKET_NOT_FOUND;
+	}
+	// Predicted bracket, simulated concurrently
+	std::vector<ParameterProbe> bracketProbes( 2 );
+	InitProbe( bracketProbes.at(0), parameterVariationCount++, predictedMax, round );
+	InitProbe( bracketProbes.at(1), parameterVariationCount++, predictedMin, round );
+	SimulateProbes( bracketProbes );
+	ParameterProbe maxProbe = bracketProbes.at(0);
+	ParameterProbe minProbe = bracketProbes.at(1);
+	bool maxSensitive = maxProbe.results->get_reliability_result()==kScenarioSensitive;
+	bool minSensitive = minProbe.results->get_reliability_result()==kScenarioSensitive;
+	// spectre errors or not monotonic
+	if( !maxProbe.simulated || !minProbe.simulated || (minSensitive && !maxSensitive) ){
+		HandleIntermediatePlotAndRawResults( *maxProbe.results, maxProbe.id );
+		HandleIntermediatePlotAndRawResults( *minProbe.results, minProbe.id );
+		return BRACKET_NOT_FOUND;
+	}
+	// Widen the bracket until it contains the critical value
+	while( !maxSensitive || minSensitive ){
+		double wideningValue;
+		// predicted bracket below the critical value
+		bool wideningUp = !maxSensitive;
+		if( wideningUp ){
+			if( maxProbe.value>=valueMax ){
+				critical_parameter_value = maxProbe.value;
+				not_affected_by_max_value = true;
+				HandleIntermediatePlotAndRawResults( *minProbe.results, minProbe.id );
+				SetLastTransientSimulationResults( maxProbe.results );
+				ReportEndOfCriticalParameterValueSimulation( maxProbe.folder, maxProbe.id, *maxProbe.results, NOT_SENSITIVE_2_MAX );
+				return SEARCH_ENDED;
+			}
+			HandleIntermediatePlotAndRawResults( *minProbe.results, minProbe.id );
+			minProbe = maxProbe;
+			minSensitive = false;
+			wideningValue = std::min( maxProbe.value*widening*widening, valueMax );
+		}else{
+			if( minProbe.value<=valueMin ){
+				critical_parameter_value = minProbe.value;
+				affected_by_min_value = true;
+				HandleIntermediatePlotAndRawResults( *maxProbe.results, maxProbe.id );
+				SetLastTransientSimulationResults( minProbe.results );
+				ReportEndOfCriticalParameterValueSimulation( minProbe.folder, minProbe.id, *minProbe.results, SENSITIVE_2_MIN );
+				return SEARCH_ENDED;
+			}
+			HandleIntermediatePlotAndRawResults( *maxProbe.results, maxProbe.id );
+			maxProbe = minProbe;
+			maxSensitive = true;
+			wideningValue = std::max( minProbe.value/(widening*widening), valueMin );
+		}
+		// each failed prediction doubles the widening exponent
+		widening *= widening;
+		++round;
+		std::vector<ParameterProbe> wideningProbes( 1 );
+		InitProbe( wideningProbes.at(0), parameterVariationCount++, wideningValue, round );
+		SimulateProbes( wideningProbes );
+		ParameterProbe& wideningProbe = wideningProbes.at(0);
+		if( !wideningProbe.simulated ){
+			HandleIntermediatePlotAndRawResults( *maxProbe.results, maxProbe.id );
+			HandleIntermediatePlotAndRawResults( *wideningProbe.results, wideningProbe.id );
+			return BRACKET_NOT_FOUND;
+		}
+		if( wideningUp ){
+			maxProbe = wideningProbe;
+			maxSensitive = maxProbe.results->get_reliability_result()==kScenarioSensitive;
+		}else{
+			minProbe = wideningProbe;
+			minSensitive = minProbe.results->get_reliability_result()==kScenarioSensitive;
+		}
+	}
+	HandleIntermediatePlotAndRawResults( *minProbe.results, minProbe.id );
+	workingProbe = minProbe;
+	notWorkingProbe = maxProbe;
+	return BRACKET_FOUND;
+}
+
+void CriticalParameterValueSimulation::SearchCriticalValueInBracket(
+	ParameterProbe& workingProbe, ParameterProbe& notWorkingProbe,
+	int& parameterVariationCount, unsigned int& round ){
+	// stop margin
+	double stopMargin = 1 + golden_critical_parameter->get_value_stop_percentage() / 100;
+	bool endOfSearch = notWorkingProbe.value/workingProbe.value < stopMargin;
+	// Illinois modification of the regula falsi: the failure distance of a bracket side
+	// kept in two consecutive rounds is halved
+	double workingFailureDistance = workingProbe.failure_distance;
+	double notWorkingFailureDistance = notWorkingProbe.failure_distance;
+	int lastUpdatedSide = kNotDefinedInt;
+	// bracket width before the last two rounds, to fall back to bisection
+	double previousBracketWidth = std::numeric_limits<double>::max();
+	double lastBracketWidth = previousBracketWidth;
+	while( !endOfSearch ){
+		++round;
+		std::vector<ParameterProbe> probes;
+		if( critical_parameter_root_finding ){
+			probes.resize( 1 );
+			double bracketWidth = GetBracketWidth( workingProbe.value, notWorkingProbe.value );
+			double probeValue;
+			// regula falsi unless the bracket did not halve in two rounds
+			// or a failure distance is not defined
+			if( bracketWidth>0.5*previousBracketWidth
+				|| workingFailureDistance==0 || notWorkingFailureDistance==0 ){
+				probeValue = GetBracketValue( workingProbe.value, notWorkingProbe.value, 0.5 );
+			}else{
+				probeValue = GetRegulaFalsiValue( workingProbe.value, notWorkingProbe.value,
+					workingFailureDistance, notWorkingFailureDistance );
+			}
+			previousBracketWidth = lastBracketWidth;
+			lastBracketWidth = bracketWidth;
+			InitProbe( probes.at(0), parameterVariationCount++, probeValue, round );
+		}else{
+			probes.resize( critical_parameter_parallel_probes );
+			for( unsigned int i=0; i<probes.size(); ++i ){
+				InitProbe( probes.at(i), parameterVariationCount++,
+					GetBracketValue( workingProbe.value, notWorkingProbe.value,
+						static_cast<double>(i+1)/(critical_parameter_parallel_probes+1) ), round );
+			}
+		}
+		SimulateProbes( probes );
+		// probes are sorted by value, spectre or processing errors are skipped
+		ParameterProbe* lastWorkingProbe = nullptr;
+		ParameterProbe* firstNotWorkingProbe = nullptr;
+		for( auto& probe : probes ){
+			if( !probe.simulated ){
+				log_io->ReportError2AllLogs( "Critical parameter probe skipped. Scenario #" + probe.id );
+				continue;
+			}
+			if( probe.results->get_reliability_result()==kScenarioSensitive ){
+				firstNotWorkingProbe = &probe;
+				break;
+			}
+			lastWorkingProbe = &probe;
+		}
+		if( lastWorkingProbe==nullptr && firstNotWorkingProbe==nullptr ){
+			// no valid probe, the last not working value is reported
+			endOfSearch = true;
+		}
+		if( lastWorkingProbe!=nullptr ){
+			workingProbe = *lastWorkingProbe;
+			workingFailureDistance = workingProbe.failure_distance;
+			if( lastUpdatedSide==kScenarioNotSensitive ){
+				notWorkingFailureDistance /= 2;
+			}
+			lastUpdatedSide = kScenarioNotSensitive;
+		}
+		if( firstNotWorkingProbe!=nullptr ){
+			HandleIntermediatePlotAndRawResults( *notWorkingProbe.results, notWorkingProbe.id );
+			notWorkingProbe = *firstNotWorkingProbe;
+			notWorkingFailureDistance = notWorkingProbe.failure_distance;
+			if( lastUpdatedSide==kScenarioSensitive ){
+				workingFailureDistance /= 2;
+			}
+			lastUpdatedSide = kScenarioSensitive;
+		}
+		// handle scenarios (plotting and files deleting)
+		for( auto& probe : probes ){
+			if( &probe!=firstNotWorkingProbe ){
+				HandleIntermediatePlotAndRawResults( *probe.results, probe.id );
+			}
+		}
+		// Update end condition
+		if( notWorkingProbe.value/workingProbe.value < stopMargin ){
+			endOfSearch = true;
+			#ifdef SPECTRE_SIMULATIONS_VERBOSE
+			if(!is_nested_simulation){
+				log_io->ReportPlainStandard( "#"
+					+ simulation_id + " scenario. rounds: " + number2String(round)
+					+ " maxW: " + number2String(workingProbe.value)
+					+" minNotW: " + number2String(notWorkingProbe.value)
+					+" stopMargin (1+X%): " + number2String(stopMargin));
+			}
+			#endif
+		}
+	}
+	critical_parameter_value = notWorkingProbe.value;
+	SetLastTransientSimulationResults( notWorkingProbe.results );
+	ReportEndOfCriticalParameterValueSimulation( notWorkingProbe.folder, notWorkingProbe.id, *notWorkingProbe.results, SENSITIVE_2_OTHER );
+}
+
+void CriticalParameterValueSimulation::InitProbe( ParameterProbe& probe, const int parameterVariationCount,
+	const double value, const unsigned int round ){
+	probe.results = new TransientSimulationResults();
+	probe.results->set_full_id( simulation_id + "_pvc_" + number2String(parameterVariationCount) + "_mc_NaN" );
+	probe.results->set_title( probe.results->get_full_id() );
+	probe.parameter_variation_count = parameterVariationCount;
+	probe.value = value;
+	probe.simulated = false;
+	probe.failure_distance = 0;
+	// deleted in the destructor
+	transient_simulations_results.push_back( probe.results );
+	critical_parameter_values_evolution.push_back( value );
+	critical_parameter_values_rounds.push_back( round );
+}
+
+void CriticalParameterValueSimulation::SimulateProbes( std::vector<ParameterProbe>& probes ){
+	// probes are simulated one by one if the batch can not be set up
+	if( !CanBatchProbes( probes ) || !SimulateBatchedProbes( probes ) ){
+		SimulationsTaskGroup tgProbes( thread_pool, probes.size() );
+		for( auto& probe : probes ){
+			tgProbes.Run( boost::bind(&CriticalParameterValueSimulation::SimulateProbe, this, boost::ref(probe)) );
+		}
+		tgProbes.Wait();
+	}
+	// probe tasks only write their own results, the member is set once they ended
+	correctly_simulated = std::none_of( probes.begin(), probes.end(),
+		[]( const ParameterProbe& probe ){ return probe.results->get_spectre_result()>0; } );
+}
+
+void CriticalParameterValueSimulation::SimulateProbe( ParameterProbe& probe ){
+	probe.simulated = SimulateParameterCriticalValue( *probe.results, probe.parameter_variation_count,
+		probe.value, probe.folder, probe.id );
+	if( probe.simulated ){
+		probe.failure_distance = GetFailureDistance( *probe.results );
+	}
+}
+
+bool CriticalParameterValueSimulation::CanBatchProbes( const std::vector<ParameterProbe>& probes ){
+	if( !critical_parameter_batch_probes || probes.size()<2
+		|| is_montecarlo_nested_simulation || main_analysis->get_advanced_analysis() ){
+		return false;
+	}
+	auto goldenMetrics = golden_metrics_structure->GetMetricsVector( n_d_profile_index );
+	if( goldenMetrics==nullptr ){
+		return false;
+	}
+	for( auto const & m : *goldenMetrics ){
+		if( !m->is_transient_magnitude() ){
+			return false;
+		}
+	}
+	return true;
+}
+
+bool CriticalParameterValueSimulation::SimulateBatchedProbes( std::vector<ParameterProbe>& probes ){
+	// probe folders, with their own parameters file
+	for( auto& probe : probes ){
+		if( !PrepareParameterCriticalValue( *probe.results, probe.parameter_variation_count,
+				probe.value, probe.folder, probe.id ) ){
+			log_io->ReportError2AllLogs( k2Tab + "-> Error preparing the batched probes, probes simulated one by one." );
+			return false;
+		}
+	}
+	ParameterProbe& firstProbe = probes.front();
+	std::string s_batchCount = number2String( firstProbe.parameter_variation_count );
+	std::string batchFolder = folder + kFolderSeparator + kIntermediateSimulationsFolder + "_pvc_batch_" + s_batchCount;
+	std::string batchId = simulation_id + "_pvc_batch_" + s_batchCount;
+	if( !CreateBatchedProbesNetlist( probes, batchFolder ) ){
+		log_io->ReportError2AllLogs( k2Tab + "-> Error creating the batched probes netlist in '" + batchFolder
+			+ "', probes simulated one by one." );
+		boost::system::error_code ec;
+		boost::filesystem::remove_all( batchFolder, ec );
+		return false;
+	}
+	// Run Spectre, once for every probe
+	int spectreResult = RunSpectre( batchFolder, batchId, firstProbe.parameter_variation_count, *firstProbe.results );
+	for( unsigned int i=0; i<probes.size(); ++i ){
+		ParameterProbe& probe = probes.at(i);
+		// resources are shared by the batch
+		probe.results->set_spectre_wall_time( firstProbe.results->get_spectre_wall_time() );
+		probe.results->set_spectre_cpu_time( firstProbe.results->get_spectre_cpu_time() );
+		probe.results->set_spectre_max_rss( firstProbe.results->get_spectre_max_rss() );
+		probe.results->set_spectre_result( spectreResult );
+		if( spectreResult>0 ){
+			if( probe.parameter_variation_count!=0 ){
+				log_io->ReportError2AllLogs( "Spectre ended with an unexpected value: "
+					+ number2String(spectreResult) + ". Scenario #"  + probe.id );
+			}
+			continue;
+		}
+		if( !DemultiplexBatchedProbe( batchFolder, i, probe ) ){
+			log_io->ReportError2AllLogs( "Batched spectre results not found. Scenario #"  + probe.id );
+			probe.results->set_spectre_result( 1 );
+		}
+	}
+	// Analyze results
+	SimulationsTaskGroup tgProbes( thread_pool, probes.size() );
+	for( auto& probe : probes ){
+		if( probe.results->get_spectre_result()==0 ){
+			tgProbes.Run( boost::bind(&CriticalParameterValueSimulation::AnalyzeBatchedProbe, this, boost::ref(probe)) );
+		}
+	}
+	tgProbes.Wait();
+	if( delete_spectre_folders ){
+		boost::system::error_code ec;
+		boost::filesystem::remove_all( batchFolder, ec );
+	}
+	return true;
+}
+
+void CriticalParameterValueSimulation::AnalyzeBatchedProbe( ParameterProbe& probe ){
+	probe.simulated = AnalyzeParameterCriticalValue( *probe.results, probe.folder, probe.id );
+	if( probe.simulated ){
+		probe.failure_distance = GetFailureDistance( *probe.results );
+	}
+}
+
+bool CriticalParameterValueSimulation::CreateBatchedProbesNetlist(
+	const std::vector<ParameterProbe>& probes, const std::string& batchFolder ){
+	if( !CreateFolder(batchFolder, true ) ){
+		return false;
+	}
+	ScenarioStager scenarioStager;
+	if( !scenarioStager.StageFolder( folder, batchFolder ) ){
+		return false;
+	}
+	// first probe value, exported in the parameters file
+	{
+		boost::unique_lock<boost::mutex> lock( parameters_mutex );
+		local_critical_parameter->set_value( number2String(probes.front().value) );
+		if( !ExportParametersCircuit( batchFolder, probes.front().parameter_variation_count )){
+			return false;
+		}
+	}
+	// the staged main netlist is shared, it is renamed and included by the batch one
+	boost::system::error_code ec;
+	boost::filesystem::rename( batchFolder + kFolderSeparator + kMainNetlistFile,
+		batchFolder + kFolderSeparator + kBatchedMainNetlistFile, ec );
+	if( ec ){
+		return false;
+	}
+	std::ofstream outputFile( batchFolder + kFolderSeparator + kMainNetlistFile );
+	if( !outputFile.is_open() ){
+		return false;
+	}
+	outputFile << kCommentWord1 << " Batch of " << probes.size() << " critical parameter values" << kEmptyLine;
+	outputFile << kLanguageSentence << kEmptyLine;
+	outputFile << kIncludeStatementWord << " \"" << kBatchedMainNetlistFile << "\"" << kEmptyLine;
+	// other probes, alter statement + main analysis copy
+	AnalysisStatement* batchedAnalysis = main_analysis->GetCopy();
+	for( unsigned int i=1; i<probes.size(); ++i ){
+		std::string analysisName = GetBatchedProbeAnalysisName( i );
+		outputFile << kEmptyLine << kCommentWord1 << " Parameter variation #" << probes.at(i).parameter_variation_count
+			<< kEmptyLine << "alter" << kBatchedProbeSufix << i << " alter param=" << local_critical_parameter->get_name()
+			<< " value=" << number2String(probes.at(i).value) << kEmptyLine;
+		batchedAnalysis->set_name( analysisName );
+		outputFile << batchedAnalysis->ExportCircuitStatement( "" ) << kEmptyLine;
+	}
+	delete batchedAnalysis;
+	outputFile.close();
+	return !outputFile.fail();
+}
+
+std::string CriticalParameterValueSimulation::GetBatchedProbeAnalysisName( const unsigned int probeIndex ){
+	if( probeIndex==0 ){
+		return main_analysis->get_name();
+	}
+	return main_analysis->get_name() + kBatchedProbeSufix + number2String(probeIndex);
+}
+
+bool CriticalParameterValueSimulation::DemultiplexBatchedProbe( const std::string& batchFolder,
+	const unsigned int probeIndex, ParameterProbe& probe ){
+	// same paths as if the probe was simulated in its folder
+	std::string batchedResultsFilePath = batchFolder + kFolderSeparator + kSpectreResultsFolder
+		+ kFolderSeparator + GetBatchedProbeAnalysisName( probeIndex ) + kTransientSufix;
+	std::string probeResultsFilePath = GetSpectreResultsFilePath( probe.folder, false );
+	boost::system::error_code ec;
+	boost::filesystem::create_directories( probe.folder + kFolderSeparator + kSpectreResultsFolder, ec );
+	boost::filesystem::rename( batchedResultsFilePath, probeResultsFilePath, ec );
+	if( ec ){
+		return false;
+	}
+	boost::filesystem::create_hard_link( GetSpectreLogFilePath( batchFolder ),
+		GetSpectreLogFilePath( probe.folder ), ec );
+	if( ec ){
+		boost::filesystem::copy_file( GetSpectreLogFilePath( batchFolder ),
+			GetSpectreLogFilePath( probe.folder ), ec );
+	}
+	return !ec;
+}
+
+double CriticalParameterValueSimulation::GetFailureDistance( TransientSimulationResults& simulationResults ){
+	bool sensitive = simulationResults.get_reliability_result()==kScenarioSensitive;
+	auto goldenMetrics = golden_metrics_structure->GetMetricsVector( n_d_profile_index );
+	if( goldenMetrics==nullptr ){
+		return 0;
+	}
+	bool marginsFound = false;
+	double failureDistance = -std::numeric_limits<double>::max();
+	for( auto const & me : *simulationResults.get_metrics_errors() ){
+		if( !me->is_transient_magnitude() ){
+			continue;
+		}
+		for( auto const & m : *goldenMetrics ){
+			if( m->is_transient_magnitude() && m->get_name()==me->get_metric_name() ){
+				// error time spans decide the verdict, and partially compared transients
+				// only give lower bounds: the distance is not on the verdict scale
+				if( static_cast<Magnitude*>(m)->get_analyze_error_in_time()
+					|| me->get_max_error_margin_ratio()==kNotDefinedInt ){
+					return 0;
+				}
+				// max abs error/band margin of the samples, ommited thresholds excluded
+				failureDistance = std::max( failureDistance, me->get_max_error_margin_ratio() - 1 );
+				marginsFound = true;
+				break;
+			}
+		}
+	}
+	// the verdict has been decided by other metrics (ocean eval metrics)
+	if( !marginsFound || !std::isfinite( failureDistance ) || ( failureDistance>0 )!=sensitive ){
+		return 0;
+	}
+	if( sensitive ){
+		return std::max( failureDistance, kCriticalParameterMinFailureDistance );
+	}
+	return std::min( failureDistance, -kCriticalParameterMinFailureDistance );
+}
+
+double CriticalParameterValueSimulation::GetBracketValue( const double maxParameterValueWorking,
+	const double minParameterValueNotWorking, const double ratio ) const{
+	double bracketValue;
+	switch( golden_critical_parameter->get_value_change_mode() ){
+		case kSPLogSmaller:{
+			bracketValue = maxParameterValueWorking*std::pow(minParameterValueNotWorking/maxParameterValueWorking, ratio);
+		}
+		break;
+		default:{
+			bracketValue = maxParameterValueWorking + (minParameterValueNotWorking-maxParameterValueWorking)*ratio;
+		}
+		break;
+	}
+	return bracketValue;
+}
+
+double CriticalParameterValueSimulation::GetBracketWidth( const double maxParameterValueWorking,
+	const double minParameterValueNotWorking ) const{
+	if( golden_critical_parameter->get_value_change_mode()==kSPLogSmaller ){
+		return std::log( minParameterValueNotWorking/maxParameterValueWorking );
+	}
+	return minParameterValueNotWorking - maxParameterValueWorking;
+}
+
+double CriticalParameterValueSimulation::GetRegulaFalsiValue( const double maxParameterValueWorking,
+	const double minParameterValueNotWorking, const double workingFailureDistance,
+	const double notWorkingFailureDistance ) const{
+	// root of the secant between (working, <0) and (not working, >0)
+	double ratio = 0.5;
+	if( notWorkingFailureDistance - workingFailureDistance > 0 ){
+		ratio = -workingFailureDistance/(notWorkingFailureDistance - workingFailureDistance);
+	}
+	// probes at the bracket sides do not shrink it
+	ratio = std::min( std::max( ratio, kCriticalParameterMinRegulaFalsiRatio ), 1 - kCriticalParameterMinRegulaFalsiRatio );
+	return GetBracketValue( maxParameterValueWorking, minParameterValueNotWorking, ratio );
+}
+
+void CriticalParameterValueSimulation::SetLastTransientSimulationResults( TransientSimulationResults* lastResults ){
+	auto it = std::find( transient_simulations_results.begin(), transient_simulations_results.end(), lastResults );
+	if( it!=transient_simulations_results.end() ){
+		transient_simulations_results.erase( it );
+	}
+	transient_simulations_results.push_back( lastResults );
+}
+
 void CriticalParameterValueSimulation::HandleIntermediatePlotAndRawResults(
 	TransientSimulationResults& simulationResults,
 	const std::string localSimulationId ){
@@ -320,16 +873,30 @@ bool CriticalParameterValueSimulation::SimulateParameterCriticalValue(
 		TransientSimulationResults& simulationResults,
 		int parameterVariationCount, double currentCriticalParameterValue,
 		std::string& localSimulationFolder, std::string& localSimulationId ){
+	if( !PrepareParameterCriticalValue( simulationResults, parameterVariationCount,
+			currentCriticalParameterValue, localSimulationFolder, localSimulationId ) ){
+		return false;
+	}
+	// Run Spectre
+	simulationResults.set_spectre_result( RunSpectre( localSimulationFolder, localSimulationId, parameterVariationCount, simulationResults ));
+	if( simulationResults.get_spectre_result() > 0 ){
+		if( parameterVariationCount!=0 ){
+			log_io->ReportError2AllLogs( "Spectre ended with an unexpected value: "
+				+ number2String(simulationResults.get_spectre_result()) + ". Scenario #"  + localSimulationId );
+		}
+		return false;
+	}
+	return AnalyzeParameterCriticalValue( simulationResults, localSimulationFolder, localSimulationId );
+}
+
+bool CriticalParameterValueSimulation::PrepareParameterCriticalValue(
+		TransientSimulationResults& simulationResults,
+		int parameterVariationCount, double currentCriticalParameterValue,
+		std::string& localSimulationFolder, std::string& localSimulationId ){
 	// Current simulation folder
 	localSimulationFolder = folder;
 	std::string s_parameterVariationCount = number2String( parameterVariationCount );
 	std::string s_currentCriticalParameterValue = number2String( currentCriticalParameterValue );
-	// copy only files to folder
-	// find . -maxdepth 1 -type f -exec cp {} destination_path \;
-	std::string copyNetlists0 = "find ";
-	std::string copyNetlists1 = " -maxdepth 1 -type f -exec cp {} ";
-	std::string copyNetlists2 = " \\;";
-	std::string copyNetlists ;
 	// fgarcia
 	// Create the folder structure
 	localSimulationFolder = folder + kFolderSeparator + kIntermediateSimulationsFolder + "_pvc_" + s_parameterVariationCount;
@@ -337,52 +904,77 @@ bool CriticalParameterValueSimulation::SimulateParameterCriticalValue(
 		log_io->ReportError2AllLogs( k2Tab + "-> Error creating folder '" + localSimulationFolder + "'." );
 		return false;
 	}
-	copyNetlists = copyNetlists0 + folder + copyNetlists1 + localSimulationFolder + copyNetlists2;
-	if( std::system( copyNetlists.c_str() ) > 0){
-		log_io->ReportError2AllLogs( k2Tab + "-> Error while copying netlist to '" + localSimulationFolder + "'." );
+	// stage only files to folder, the netlists are shared (hardlinks)
+	ScenarioStager scenarioStager;
+	if( !scenarioStager.StageFolder( folder, localSimulationFolder ) ){
+		log_io->ReportError2AllLogs( k2Tab + "-> Error while staging netlist in '" + localSimulationFolder + "'." );
 		return false;
 	}
 	#ifdef SPECTRE_SIMULATIONS_VERBOSE
 	log_io->ReportPlain2Log( k2Tab + "#" + simulation_id + " scenario, currentCriticalParameterValue:" + s_currentCriticalParameterValue);
 	#endif
-	// Changing critical parameter value
-	local_critical_parameter->set_value( number2String(currentCriticalParameterValue) );
-	// Export current set of parameters
-	if( !ExportParametersCircuit( localSimulationFolder, parameterVariationCount )){
-		log_io->ReportError2AllLogs( "Error creating parameters Circuit ");
-		return false;
-	}
-	localSimulationId = simulation_id + "_pvc_" + s_parameterVariationCount;
-	// Run Spectre
-	simulationResults.set_spectre_result( RunSpectre( localSimulationFolder, localSimulationId, parameterVariationCount ));
-	if( simulationResults.get_spectre_result() > 0 ){
-		if( parameterVariationCount!=0 ){
-			log_io->ReportError2AllLogs( "Spectre ended with an unexpected value: "
-				+ number2String(simulationResults.get_spectre_result()) + ". Scenario #"  + localSimulationId );
+	{
+		// concurrent probes share local_critical_parameter
+		boost::unique_lock<boost::mutex> lock( parameters_mutex );
+		// Changing critical parameter value
+		local_critical_parameter->set_value( number2String(currentCriticalParameterValue) );
+		// Export current set of parameters
+		if( !ExportParametersCircuit( localSimulationFolder, parameterVariationCount )){
+			log_io->ReportError2AllLogs( "Error creating parameters Circuit ");
+			return false;
 		}
-		return false;
+		// Register Parameters
+		simulationResults.RegisterSimulationParameters( simulation_parameters );
 	}
+	localSimulationId = simulation_id + "_pvc_" + s_parameterVariationCount;
+	return true;
+}
+
+bool CriticalParameterValueSimulation::AnalyzeParameterCriticalValue(
+		TransientSimulationResults& simulationResults,
+		const std::string& localSimulationFolder, const std::string& localSimulationId ){
 	// Set up metrics
 	std::vector<Metric*>* analyzedMetrics = CreateMetricsVectorFromGoldenMetrics( n_d_profile_index );
+	// Only the verdict is required when the transients are neither exported nor plotted:
+	// metrics are compared while spectre results are read
+	std::vector<MagnitudeComparator*>* magnitudeComparators = nullptr;
+	if( streaming_analysis && !export_processed_metrics && !export_metric_errors ){
+		magnitudeComparators = CreateMagnitudeComparators( n_d_profile_index, *analyzedMetrics );
+		// the failure distance needs the whole transient
+		if( magnitudeComparators!=nullptr && critical_parameter_root_finding ){
+			for( auto const & mc : *magnitudeComparators ){
+				if( mc!=nullptr ){
+					mc->set_stop_at_first_error( false );
+				}
+			}
+		}
+	}
 	// Reading metrics
-	if( !ProcessSpectreResults( localSimulationFolder, localSimulationId, simulationResults, false, *analyzedMetrics, false, is_montecarlo_nested_simulation ) ){
+	bool analyzed = ProcessSpectreResults( localSimulationFolder, localSimulationId, simulationResults, false,
+		*analyzedMetrics, false, is_montecarlo_nested_simulation, magnitudeComparators );
+	if( !analyzed ){
 		log_io->ReportError2AllLogs( "Error while processing the critical value simulation spectre_results. Scenario #"
 			+ simulation_id );
-		return false;
+	}else{
+		// Interpolating and analyzing metrics
+		#ifdef SPECTRE_SIMULATIONS_VERBOSE
+		log_io->ReportPlain2Log( kTab + "#" + simulation_id + " -> Interpolating spectre_results");
+		#endif
+		// Interpolate results
+		analyzed = InterpolateAndAnalyzeMetrics( simulationResults, *analyzedMetrics, n_d_profile_index,
+			localSimulationId, magnitudeComparators );
+		if( !analyzed ){
+			log_io->ReportError2AllLogs( "Error while interpolating the critical value metrics. Scenario #" + simulation_id );
+		}
 	}
-	// Interpolating and analyzing metrics
-	#ifdef SPECTRE_SIMULATIONS_VERBOSE
-	log_io->ReportPlain2Log( kTab + "#" + simulation_id + " -> Interpolating spectre_results");
-	#endif
-	// Interpolate results
-	if( !InterpolateAndAnalyzeMetrics( simulationResults, *analyzedMetrics, n_d_profile_index, localSimulationId ) ){
-		log_io->ReportError2AllLogs( "Error while interpolating the critical value metrics. Scenario #" + simulation_id );
-		return false;
+	// delete analyzed metrics, also when the probe could not be analyzed
+	if( magnitudeComparators!=nullptr ){
+		deleteContentsOfVectorOfPointers( *magnitudeComparators );
+		delete magnitudeComparators;
 	}
-	// delete analyzed metrics
 	deleteContentsOfVectorOfPointers( *analyzedMetrics);
 	delete analyzedMetrics;
-	return true;
+	return analyzed;
 }
 
 bool CriticalParameterValueSimulation::TestSetUp(){
@@ -424,7 +1016,7 @@ std::string CriticalParameterValueSimulation::GetProcessedResultsFilePath(const
 	if( is_montecarlo_nested_simulation ){
 		return top_folder + kFolderSeparator + kResultsFolder + kFolderSeparator
 		+ kResultsDataFolder + kFolderSeparator + kTransientResultsFolder + kFolderSeparator
-		+ kProcessedPrefix + simulation_id + "_m_" + montecarlo_transient_sufix + kDataSufix;
+		+ kProcessedPrefix + simulation_id + "_m_" + montecarlo_transient_sufix + GetProcessedDataSufix();
 	}else{
 		std::string analysisFinalName = main_analysis->get_name();
 		if( processMainTransient ){
@@ -432,26 +1024,22 @@ std::string CriticalParameterValueSimulation::GetProcessedResultsFilePath(const
 		}
 		return top_folder + kFolderSeparator + kResultsFolder + kFolderSeparator + kResultsDataFolder
 			+ kFolderSeparator + kTransientResultsFolder + kFolderSeparator
-			+ localSimulationId + "_" + kProcessedTransientFile;
+			+ localSimulationId + "_" + GetProcessedTransientFile();
 	}
 }
 
 int CriticalParameterValueSimulation::RunSpectre(
-	const std::string& currentFolder, const std::string& localSimulationId, const unsigned int parameterChangeCount ){
-	std::string execCommand = spectre_command + " "
-		+ spectre_command_log_arg + " " + currentFolder + kFolderSeparator + kSpectreLogFile + " "
-		+ spectre_command_folder_arg + " " + currentFolder + kFolderSeparator + kSpectreResultsFolder + " "
-		+ currentFolder + kFolderSeparator + kMainNetlistFile
-		+ " " + post_spectre_command + " " + currentFolder + kFolderSeparator + kSpectreStandardLogsFile ;
+	const std::string& currentFolder, const std::string& localSimulationId, const unsigned int parameterChangeCount,
+	TransientSimulationResults& simulationResults ){
 	#ifdef SPECTRE_SIMULATIONS_VERBOSE
 	log_io->ReportPlainStandard( k2Tab + "#" + localSimulationId + " scenario: Simulating scenario."
 		" Parameter change #" + number2String( parameterChangeCount ) );
 	log_io->ReportPlain2Log( k2Tab + "#" + localSimulationId + " scenario: Simulating scenario."
-		" Parameter change #" + number2String( parameterChangeCount ) + "exec:'" + execCommand + "'" );
+		" Parameter change #" + number2String( parameterChangeCount ) + " folder:'" + currentFolder + "'" );
 	#endif
-	int spectre_result = std::system( execCommand.c_str() ) ;
+	int spectre_result = ExecuteSpectre( currentFolder, &simulationResults );
+	// correctly_simulated is set by the caller, probes run concurrently
 	if(spectre_result>0){
-		correctly_simulated = false;
 		if( parameterChangeCount==0 ){
 			log_io->ReportWarning2AllLogs( "Unexpected Spectre spectre_result for scenario #"
 				+ localSimulationId + ": spectre output = " + number2String(spectre_result) );
@@ -464,7 +1052,6 @@ int CriticalParameterValueSimulation::RunSpectre(
 		}
 		return spectre_result;
 	}
-	correctly_simulated = true;
 	#ifdef SPECTRE_SIMULATIONS_VERBOSE
 	log_io->ReportGreenStandard( k2Tab + "#" + localSimulationId + " scenario: ENDED."
 		" Parameter change #" + number2String( parameterChangeCount ) + ", spectre_result=" + number2String(spectre_result) );
@@ -508,8 +1095,9 @@ int CriticalParameterValueSimulation::CreateGnuplotCriticalParameterEvolution(){
 	gnuplotScriptFile <<  kTransientSimilarLinesPalette;
 	// Create file
 	critParameterEvolutionDataFile.open( critParameterEvolutionDataPath.c_str() );
-	for( auto const & cv : critical_parameter_values_evolution ){
-		critParameterEvolutionDataFile << cv << "\n";
+	for( unsigned int i=0; i<critical_parameter_values_evolution.size(); ++i ){
+		critParameterEvolutionDataFile << critical_parameter_values_rounds.at(i)
+			<< " " << critical_parameter_values_evolution.at(i) << "\n";
 	}
 	critParameterEvolutionDataFile.close();
 	// plots
@@ -519,7 +1107,7 @@ int CriticalParameterValueSimulation::CreateGnuplotCriticalParameterEvolution(){
 	gnuplotScriptFile <<  "set output \"" << outputImagePath  << "\"\n";
 
 	// critical parameter
-	gnuplotScriptFile <<  "set xlabel \"Iteration\"\n";
+	gnuplotScriptFile <<  "set xlabel \"Search Round\"\n";
 	gnuplotScriptFile <<  "set ylabel \"Critical Parameter Value\"\n";
 	gnuplotScriptFile <<  "set title \"Critical Parameter Value Evolution \"\n";
 	gnuplotScriptFile <<  "set key bottom right\n";
@@ -527,7 +1115,7 @@ int CriticalParameterValueSimulation::CreateGnuplotCriticalParameterEvolution(){
 		gnuplotScriptFile << "set logscale y\n";
 	}
 	// Plot
-	gnuplotScriptFile <<  "plot '" << critParameterEvolutionDataPath << "' w lp ls 1 title 'Critical Parameter Value Evolution' \n";
+	gnuplotScriptFile <<  "plot '" << critParameterEvolutionDataPath << "' u 1:2 w lp ls 1 title 'Critical Parameter Value Evolution' \n";
 	gnuplotScriptFile << "unset output\n";
 	// Add images path
 	critical_parameter_values_evolution_image_path = outputImagePath;
@@ -15,6 +15,8 @@
 #ifndef CRITICAL_PARAMETER_VALUE_SIMULATION_H
 #define CRITICAL_PARAMETER_VALUE_SIMULATION_H
 
+// Boost
+#include <boost/thread.hpp>
 // Radiation simulator
 #include "spectre_simulation.hpp"
 // netlist modeling
@@ -37,6 +39,17 @@ public:
 		this->plot_last_transients = plot_last_transients;
 	}
 
+	/**
+	 * @brief Sets the predicted critical parameter value
+	 * @details The search starts from a bracket around it, widened if the prediction fails
+	 *
+	 * @param warm_start_critical_value
+	 */
+	void set_warm_start_critical_value( const double warm_start_critical_value ){
+		this->warm_start_critical_value = warm_start_critical_value;
+		this->warm_start = true;
+	}
+
 	void set_plot_critical_parameter_value_evolution( const bool plot_critical_parameter_value_evolution ){
 		this->plot_critical_parameter_value_evolution = plot_critical_parameter_value_evolution;
 	}
@@ -79,6 +92,23 @@ private:
 	static constexpr unsigned int NOT_SENSITIVE_2_MAX = 0;
 	static constexpr unsigned int SENSITIVE_2_MIN = 1;
 	static constexpr unsigned int SENSITIVE_2_OTHER = 2;
+	// bracket search status
+	static constexpr int BRACKET_FOUND = 0;
+	static constexpr int BRACKET_NOT_FOUND = 1;
+	static constexpr int SEARCH_ENDED = 2;
+
+	/// critical parameter value simulated in a search round
+	struct ParameterProbe {
+		TransientSimulationResults* results;
+		int parameter_variation_count;
+		double value;
+		std::string folder;
+		std::string id;
+		bool simulated;
+		/// signed distance to failure (>0 sensitive), from the metric errors.
+		/// 0 if not defined, then the round bisects
+		double failure_distance;
+	};
 
 	/// plot_critical_parameter_value_evolution
 	bool plot_critical_parameter_value_evolution;
@@ -93,11 +123,19 @@ private:
 
 	/// critical_parameter_values_evolution
 	std::vector<double> critical_parameter_values_evolution;
+	/// search round of each critical_parameter_values_evolution value
+	std::vector<unsigned int> critical_parameter_values_rounds;
 	std::string critical_parameter_values_evolution_image_path;
 	/// Not affected with the max quantity
 	bool not_affected_by_max_value;
 	/// Is affected by the min quantity
 	bool affected_by_min_value;
+	/// the search starts around warm_start_critical_value
+	bool warm_start;
+	/// predicted critical parameter value
+	double warm_start_critical_value;
+	/// local_critical_parameter value and exported parameters, shared by concurrent probes
+	boost::mutex parameters_mutex;
 
 	virtual std::string GetSpectreResultsFilePath(const std::string& currentFolder,
 		const bool& processMainTransient) override;
@@ -122,6 +160,220 @@ private:
 		int parameterVariationCount, double currentParameterValue,
 		std::string& localSimulationFolder, std::string& localSimulationId  );
 
+	/**
+	 * @brief Creates the folder of a critical parameter value and exports its parameters
+	 *
+	 * @param simulationResults
+	 * @param parameterVariationCount
+	 * @param currentParameterValue
+	 * @param localSimulationFolder
+	 * @param localSimulationId
+	 * @return true if the method correctly ends.
+	 */
+	bool PrepareParameterCriticalValue( TransientSimulationResults& simulationResults,
+		int parameterVariationCount, double currentParameterValue,
+		std::string& localSimulationFolder, std::string& localSimulationId );
+
+	/**
+	 * @brief Processes and analyzes the spectre results of a critical parameter value
+	 *
+	 * @param simulationResults
+	 * @param localSimulationFolder
+	 * @param localSimulationId
+	 * @return true if the method correctly ends.
+	 */
+	bool AnalyzeParameterCriticalValue( TransientSimulationResults& simulationResults,
+		const std::string& localSimulationFolder, const std::string& localSimulationId );
+
+	/**
+	 * @brief k-ary section search of the critical parameter value
+	 * @details The initial bracket is the warm start one, if any, or the max and min values.
+	 * Then, each round simulates critical_parameter_parallel_probes values
+	 * inside the current bracket at once, shrinking it by a factor of probes+1.
+	 */
+	void RunBracketedCriticalValueSearch();
+
+	/**
+	 * @brief Simulates concurrently the max and min values
+	 *
+	 * @param workingProbe probe of the max working value
+	 * @param notWorkingProbe probe of the min not working value
+	 * @param parameterVariationCount
+	 * @param round
+	 * @return BRACKET_FOUND or SEARCH_ENDED (the end is already reported)
+	 */
+	int FindBoundariesBracket(
+		ParameterProbe& workingProbe, ParameterProbe& notWorkingProbe,
+		int& parameterVariationCount, unsigned int& round );
+
+	/**
+	 * @brief Simulates the bracket around warm_start_critical_value
+	 * @details The failing side is widened, doubling the widening exponent each time,
+	 * up to the max/min values
+	 *
+	 * @param workingProbe probe of the max working value
+	 * @param notWorkingProbe probe of the min not working value
+	 * @param parameterVariationCount
+	 * @param round
+	 * @return BRACKET_FOUND, BRACKET_NOT_FOUND (spectre errors) or SEARCH_ENDED (the end is already reported)
+	 */
+	int FindWarmStartBracket(
+		ParameterProbe& workingProbe, ParameterProbe& notWorkingProbe,
+		int& parameterVariationCount, unsigned int& round );
+
+	/**
+	 * @brief Shrinks the bracket until the stop margin, reporting the end of the simulation
+	 * @details k-ary section or, if critical_parameter_root_finding,
+	 * Illinois regula falsi on the failure distance safeguarded by bisection
+	 *
+	 * @param workingProbe probe of the max working value
+	 * @param notWorkingProbe probe of the min not working value
+	 * @param parameterVariationCount
+	 * @param round
+	 */
+	void SearchCriticalValueInBracket(
+		ParameterProbe& workingProbe, ParameterProbe& notWorkingProbe,
+		int& parameterVariationCount, unsigned int& round );
+
+	/**
+	 * @brief Creates the results of a probe and registers its value in the evolution
+	 *
+	 * @param probe
+	 * @param parameterVariationCount
+	 * @param value
+	 * @param round search round
+	 */
+	void InitProbe( ParameterProbe& probe, const int parameterVariationCount,
+		const double value, const unsigned int round );
+
+	/**
+	 * @brief Simulates concurrently the probes of a round
+	 *
+	 * @param probes
+	 */
+	void SimulateProbes( std::vector<ParameterProbe>& probes );
+
+	/**
+	 * @brief Task of SimulateProbes
+	 *
+	 * @param probe
+	 */
+	void SimulateProbe( ParameterProbe& probe );
+
+	/**
+	 * @brief Whether the probes of a round can be simulated in a single spectre run
+	 * @details Requires critical_parameter_batch_probes, a main analysis that
+	 * is not a montecarlo one, and only transient metrics
+	 * (ocean eval metrics are read from the spectre log, shared by the batch)
+	 *
+	 * @param probes
+	 * @return true if the probes can be batched
+	 */
+	bool CanBatchProbes( const std::vector<ParameterProbe>& probes );
+
+	/**
+	 * @brief Simulates the probes of a round in a single spectre run
+	 * @details The first probe value is exported in the parameters file,
+	 * the other ones are set with alter statements, each one followed by
+	 * a copy of the main analysis. The results of each analysis are
+	 * moved to the probe folder, and then the probes are analyzed concurrently.
+	 *
+	 * @param probes
+	 * @return false if the batch could not be set up, spectre has not been run
+	 */
+	bool SimulateBatchedProbes( std::vector<ParameterProbe>& probes );
+
+	/**
+	 * @brief Task of SimulateBatchedProbes
+	 *
+	 * @param probe
+	 */
+	void AnalyzeBatchedProbe( ParameterProbe& probe );
+
+	/**
+	 * @brief Creates the folder and the main netlist of a batch of probes
+	 *
+	 * @param probes
+	 * @param batchFolder
+	 * @return true if the method correctly ends.
+	 */
+	bool CreateBatchedProbesNetlist( const std::vector<ParameterProbe>& probes,
+		const std::string& batchFolder );
+
+	/**
+	 * @brief Name of the main analysis of a probe in a batch
+	 *
+	 * @param probeIndex
+	 * @return analysis name
+	 */
+	std::string GetBatchedProbeAnalysisName( const unsigned int probeIndex );
+
+	/**
+	 * @brief Moves the batched results of a probe to its folder
+	 * @details The spectre standard log of the batch is linked too.
+	 *
+	 * @param batchFolder
+	 * @param probeIndex
+	 * @param probe
+	 * @return true if the probe results were found
+	 */
+	bool DemultiplexBatchedProbe( const std::string& batchFolder,
+		const unsigned int probeIndex, ParameterProbe& probe );
+
+	/**
+	 * @brief Signed distance to failure of a simulated probe
+	 * @details Max error/error margin - 1 of the transient magnitudes, the margin of each
+	 * sample being the one of its band (ones, zeros or default).
+	 * Positive if the scenario is sensitive, negative otherwise.
+	 *
+	 * @param simulationResults
+	 * @return failure distance, 0 if it does not agree with the verdict
+	 * (error time spans, ocean eval metrics or partially compared transients)
+	 */
+	double GetFailureDistance( TransientSimulationResults& simulationResults );
+
+	/**
+	 * @brief Value inside the bracket, depending on the value change mode
+	 *
+	 * @param maxParameterValueWorking
+	 * @param minParameterValueNotWorking
+	 * @param ratio 0 (working side) to 1 (not working side)
+	 * @return bracket value
+	 */
+	double GetBracketValue( const double maxParameterValueWorking,
+		const double minParameterValueNotWorking, const double ratio ) const;
+
+	/**
+	 * @brief Bracket width, depending on the value change mode
+	 *
+	 * @param maxParameterValueWorking
+	 * @param minParameterValueNotWorking
+	 * @return bracket width
+	 */
+	double GetBracketWidth( const double maxParameterValueWorking,
+		const double minParameterValueNotWorking ) const;
+
+	/**
+	 * @brief Regula falsi value, interpolating the failure distances of the bracket sides
+	 *
+	 * @param maxParameterValueWorking
+	 * @param minParameterValueNotWorking
+	 * @param workingFailureDistance
+	 * @param notWorkingFailureDistance
+	 * @return probe value
+	 */
+	double GetRegulaFalsiValue( const double maxParameterValueWorking,
+		const double minParameterValueNotWorking, const double workingFailureDistance,
+		const double notWorkingFailureDistance ) const;
+
+	/**
+	 * @brief Moves the results to the end of transient_simulations_results,
+	 * so they are the last valid ones
+	 *
+	 * @param lastResults
+	 */
+	void SetLastTransientSimulationResults( TransientSimulationResults* lastResults );
+
 	/**
 	 * @brief Plots and deletes the transient, if appropriate
 	 *
@@ -140,10 +392,12 @@ private:
 	 * @param currentFolder
 	 * @param scenario_id
 	 * @param parameterChangeCount
+	 * @param simulationResults stores the resources used by spectre
 	 * @return spectre output
 	 */
 	int RunSpectre( const std::string& currentFolder,
-		const std::string& localSimulationId, const unsigned int parameterChangeCount );
+		const std::string& localSimulationId, const unsigned int parameterChangeCount,
+		TransientSimulationResults& simulationResults );
 
 	/**
 	 * @brief Virtual overrides TestSetup
@@ -19,6 +19,7 @@
 #include "boost/filesystem.hpp" // includes all needed Boost.Filesystem declarations
 // Reliability simulator
 #include "golden_nd_parameters_sweep_simulation.hpp"
+#include "../scenario_stager.hpp"
 // #include "../simulation_results/results_summary_critical_parameter_1d_parameters_sweep.hpp"
 #include "../../io_handling/raw_format_processor.hpp"
 // constants
@@ -38,12 +39,6 @@ GoldenNDParametersSweepSimulation::~GoldenNDParametersSweepSimulation(){
 	#ifdef DESTRUCTORS_VERBOSE
 		std::cout <<  "GoldenNDParametersSweepSimulation destructor. direction:" << this << "\n";
 	#endif
-	if( golden_metrics_structure ){
-		#ifdef DESTRUCTORS_VERBOSE
-			std::cout << "GoldenNDParametersSweepSimulation deleting golden_metrics_structure\n" ;
-		#endif
-		delete golden_metrics_structure;
-	}
 	// not required
 	// delete golden_simulations_vector;
 	// deleteContentsOfVectorOfPointers( golden_simulations_vector );
@@ -55,18 +50,13 @@ void GoldenNDParametersSweepSimulation::RunSimulation(){
 		return;
 	}
 	// Environment
-	ConfigureEnvironmentVariables();
 	ShowEnvironmentVariables();
 	// metrics_structure
 	// in 1d-> vector of vectors? ok
-	std::vector<std::vector<Metric*>*>* gms = new std::vector<std::vector<Metric*>*>();
-	std::vector<std::string>* fs = new std::vector<std::string>();
-
-	golden_metrics_structure = new NDMetricsStructure();
-	golden_metrics_structure->set_metrics_structure(gms);
-	golden_metrics_structure->set_files_structure(fs);
+	golden_metrics_store = std::make_shared<NDMetricsStructure>();
+	golden_metrics_structure = golden_metrics_store.get();
 	// main threads group
-	boost::thread_group mainTG;
+	SimulationsTaskGroup mainTG( thread_pool, max_parallel_profile_instances );
 	// params to be sweeped
 	std::vector<SimulationParameter*> parameters2sweep;
 	// Threads Creation
@@ -91,8 +81,6 @@ void GoldenNDParametersSweepSimulation::RunSimulation(){
 	log_io->ReportThread( "Total threads to be simulated: " + number2String(totalThreads) + ". Max number of sweep threads: " + number2String(max_parallel_profile_instances), 1 );
 
 	auto parameterSimulationIndexes2Simulate = GetGoldenProfiles2Simulate( parameters2sweep );
-	// parallel threads control
-	unsigned int runningThreads = 0;
 	// // made atomic
 	// std::atomic<unsigned int> threadsCount(0);
 	// threadsCount = 0;
@@ -101,6 +89,7 @@ void GoldenNDParametersSweepSimulation::RunSimulation(){
 	std::vector<unsigned int> parameterCountIndexes(parameters2sweep.size(), 0);
 	// results
 	golden_simulations_vector.ReserveSimulationsInMemory( totalThreads );
+	golden_metrics_store->ReserveProfiles( totalThreads );
 	golden_simulations_vector.set_group_name("golden_n-dimensional_analysis");
 	// non simulated GS
 	std::vector<GoldenSimulation*> nonSimulatedGS;
@@ -111,8 +100,6 @@ void GoldenNDParametersSweepSimulation::RunSimulation(){
 	// Threads Creation
 	GoldenSimulation* lastComputedGS = nullptr;
 	while( threadsCount<totalThreads ){
-		// wait for resources
-		WaitForResources( runningThreads, max_parallel_profile_instances, mainTG, threadsCount );
 		// CreateProfile sets all parameter values, and after the simulation object
 		// is created it can be updated.
 		// Thus, it avoids race conditions when updating parameterCountIndexes and parameters2sweep
@@ -128,9 +115,7 @@ void GoldenNDParametersSweepSimulation::RunSimulation(){
 		if( simulateThread ){
 			lastComputedGS = pGS;
 			simulatedGS.push_back( pGS );
-			mainTG.add_thread( new boost::thread(boost::bind(&GoldenSimulation::RunSimulation, pGS)) );
-			// update variables
-			++runningThreads;
+			mainTG.Run( boost::bind(&GoldenSimulation::RunSimulation, pGS) );
 		}else{
 			if( lastComputedGS==nullptr ){
 				log_io->ReportError2AllLogs( "lastComputedGS==nullptr" + pGS->get_simulation_id() );
@@ -145,8 +130,8 @@ void GoldenNDParametersSweepSimulation::RunSimulation(){
 		UpdateParameterSweepIndexes( parameterCountIndexes, parameters2sweep);
 		++threadsCount;
 	}
-	mainTG.join_all();
-	log_io->ReportPlain2Log( "GoldenNDParametersSweepSimulation: mainTG.join_all()" );
+	mainTG.Wait();
+	log_io->ReportPlain2Log( "GoldenNDParametersSweepSimulation: mainTG.Wait()" );
 	// copy results from simulated GS
 	for( auto const &pGS : nonSimulatedGS ){
 		auto similarPM = pGS->get_similarComputedGS();
@@ -169,8 +154,8 @@ void GoldenNDParametersSweepSimulation::RunSimulation(){
 			children_correctly_processed = false;
 			return;
 		}
-		gms->push_back( pPM );
-		fs->push_back( pGS->get_singular_results_path() );
+		// the store adopts the simulated metrics, shared by the similar (not simulated) profiles
+		golden_metrics_store->AddProfileMetrics( pPM, pGS->get_singular_results_path(), pGS->ReleaseProcessedMetrics() );
 	}
 	// check if every simulation ended correctly
 	correctly_simulated = golden_simulations_vector.CheckCorrectlySimulated();
@@ -197,15 +182,10 @@ GoldenSimulation* GoldenNDParametersSweepSimulation::CreateProfile(
 			log_io->ReportError2AllLogs( "Error running profile" );
 			return nullptr;
 		}
-		// copy only files to folder
-		// find . -maxdepth 1 -type f -exec cp {} destination_path \;
-		std::string copyNetlists0 = "find ";
-		std::string copyNetlists1 = " -maxdepth 1 -type f -exec cp {} ";
-		std::string copyNetlists2 = " \\;";
-		std::string copyNetlists;
-		copyNetlists = copyNetlists0 + folder + copyNetlists1 + currentFolder + copyNetlists2;
-		if( std::system( copyNetlists.c_str() ) > 0){
-			log_io->ReportError2AllLogs( k2Tab + "-> Error while copying netlist to '" + currentFolder + "'." );
+		// stage only files to folder, the netlists are shared (hardlinks)
+		ScenarioStager scenarioStager;
+		if( !scenarioStager.StageFolder( folder, currentFolder ) ){
+			log_io->ReportError2AllLogs( k2Tab + "-> Error while staging netlist in '" + currentFolder + "'." );
 			log_io->ReportError2AllLogs( "Error running sweep" );
 			return nullptr;
 		}
@@ -219,6 +199,8 @@ GoldenSimulation* GoldenNDParametersSweepSimulation::CreateProfile(
 	pGS->set_n_dimensional(true);
 	pGS->set_n_d_profile_index(ndIndex);
 	pGS->set_log_io( log_io );
+	pGS->set_thread_pool( thread_pool );
+	pGS->set_resource_broker( resource_broker );
 	pGS->set_altered_scenario_index( altered_scenario_index );
 	// pGS->set_golden_metrics_structure( golden_metrics_structure );
 	// Spectre command and args
@@ -271,7 +253,3 @@ bool GoldenNDParametersSweepSimulation::TestSetUp(){
 	return true;
 }
 
-NDMetricsStructure* GoldenNDParametersSweepSimulation::GetGoldenMetrics(){
-	NDMetricsStructure* gms = new NDMetricsStructure(*golden_metrics_structure);
-	return gms;
-}
@@ -48,10 +48,10 @@ public:
 
 	/**
 	 * @brief Retrieve Processed Metrics
-	 * @details Retrieve Processed Metrics
+	 * @details The golden metrics store is shared, not copied
 	 * @return processed NDMetricsStructure
 	 */
-	NDMetricsStructure* GetGoldenMetrics();
+	std::shared_ptr<NDMetricsStructure> GetGoldenMetrics(){ return golden_metrics_store; }
 
 	/**
 	 * @brief Retrieve children_correctly_simulated
@@ -75,6 +75,8 @@ private:
 
 	/// Simulation results, organizated by parameter (first vector)
 	SpectreSimulationsVector golden_simulations_vector;
+	/// golden metrics store, [nd_index] metrics of the profiles
+	std::shared_ptr<NDMetricsStructure> golden_metrics_store;
 	/// Max parallel instances per sweep
 	int max_parallel_profile_instances;
 
@@ -29,6 +29,8 @@ GoldenSimulation::GoldenSimulation() {
 	// injection mode related
 	this->has_additional_injection = false;
 	this->similarComputedGS = nullptr;
+	this->processed_metrics = nullptr;
+	this->processed_metrics_owned = false;
 }
 
 GoldenSimulation::~GoldenSimulation(){
@@ -36,7 +38,7 @@ GoldenSimulation::~GoldenSimulation(){
 	#ifdef DESTRUCTORS_VERBOSE
 	   std::cout<< "GoldenSimulation destructor. direction:" << this << "\n";
 	#endif
-	if( process_metrics && processed_metrics!= nullptr ){
+	if( processed_metrics_owned && processed_metrics!= nullptr ){
 		#ifdef DESTRUCTORS_VERBOSE
 			std::cout<< "Deleting processed_metrics\n";
 		#endif
@@ -63,19 +65,24 @@ bool GoldenSimulation::CopyResultsFromGoldenSimulation( GoldenSimulation* simila
 	correctly_simulated = similarSimulatedGS->get_correctly_simulated();
 	correctly_processed = similarSimulatedGS->get_correctly_processed();
 	singular_results_path = similarSimulatedGS->get_singular_results_path();
-	// processed_metrics
-	processed_metrics = new std::vector<Metric*>();
-	deepCopyVectorOfInheritancePointers( *(similarSimulatedGS->get_processed_metrics()), *processed_metrics );
+	// processed_metrics, shared
+	processed_metrics = similarSimulatedGS->get_processed_metrics();
+	processed_metrics_owned = false;
 	// and nothing else! :D
 	return true;
 }
 
+bool GoldenSimulation::ReleaseProcessedMetrics(){
+	bool owned = processed_metrics_owned;
+	processed_metrics_owned = false;
+	return owned;
+}
+
 void GoldenSimulation::RunSimulation(){
 	if (!TestSetUp()){
 		log_io->ReportError2AllLogs( "RunSimulation had not been previously set up. ");
 		return;
 	}
-	ConfigureEnvironmentVariables();
 	ShowEnvironmentVariables();
 	if (simulation_parameters==nullptr){
 		log_io->ReportError2AllLogs( "simulation_parameters is nullptr. ");
@@ -94,6 +101,7 @@ void GoldenSimulation::RunSimulation(){
 		// Set up metrics
 		// log_io->ReportPlain2Log( k3Tab + "#" + simulation_id + " scenario: creating metrics from golden.");
 		processed_metrics = CreateGoldenMetricsVector();
+		processed_metrics_owned = true;
 		// log_io->ReportPlain2Log( k3Tab + "#" + simulation_id + " scenario: processing results.");
 		// process spectre results
 		if( !ProcessSpectreResults( folder, simulation_id, transient_simulation_results, true, *processed_metrics, true, false ) ){
@@ -102,8 +110,10 @@ void GoldenSimulation::RunSimulation(){
 		}
 		// if simple golden simulation (not sweep)
 		if(!is_nested_simulation){
-			golden_metrics_structure = new NDMetricsStructure();
-			golden_metrics_structure->SimpleInitialization( 1, *processed_metrics, singular_results_path );
+			golden_metrics_store = std::make_shared<NDMetricsStructure>();
+			golden_metrics_store->SimpleInitialization( 1, processed_metrics, singular_results_path );
+			processed_metrics_owned = false;
+			golden_metrics_structure = golden_metrics_store.get();
 		}
 		// plot transiets if required
 		if( correctly_processed && plot_transients ){
@@ -127,12 +137,7 @@ bool GoldenSimulation::TestSetUp(){
 }
 
 int GoldenSimulation::RunSpectre(){
-	std::string execCommand = spectre_command + " "
-		+ spectre_command_log_arg + " " + folder + kFolderSeparator + kSpectreLogFile + " "
-		+ spectre_command_folder_arg + " " + folder + kFolderSeparator + kSpectreResultsFolder + " "
-		+ folder + kFolderSeparator + kMainNetlistFile
-		+ " " + post_spectre_command + " " + folder + kFolderSeparator + kSpectreStandardLogsFile;
-	int spectre_result = std::system( execCommand.c_str() ) ;
+	int spectre_result = ExecuteSpectre( folder, &transient_simulation_results );
 	if( spectre_result>0 ){
 		correctly_simulated = false;
 		log_io->ReportError2AllLogs( "Unexpected Spectre spectre_result for singular scenario #" + simulation_id + ": spectre output = " + number2String(spectre_result) );
@@ -149,10 +154,6 @@ int GoldenSimulation::RunSpectre(){
 	return spectre_result;
 }
 
-NDMetricsStructure* GoldenSimulation::GetGoldenMetrics(){
-	NDMetricsStructure* gms = new NDMetricsStructure(*golden_metrics_structure);
-	return gms;
-}
 
 std::vector<Metric*>* GoldenSimulation::CreateGoldenMetricsVector(){
 	#ifdef SPECTRE_SIMULATIONS_VERBOSE
@@ -15,6 +15,8 @@
 #ifndef GOLDEN_SIMULATION_H
 #define GOLDEN_SIMULATION_H
 
+// c++ std libraries
+#include <memory>
 // Radiation simulator
 #include "spectre_simulation.hpp"
 
@@ -69,10 +71,17 @@ public:
 
 	/**
 	 * @brief Retrieve Processed Metrics
-	 * @details Retrieve Processed Metrics
+	 * @details The golden metrics store is shared, not copied
 	 * @return processed NDMetricsStructure
 	 */
-	NDMetricsStructure* GetGoldenMetrics();
+	std::shared_ptr<NDMetricsStructure> GetGoldenMetrics(){ return golden_metrics_store; }
+
+	/**
+	 * @brief Transfers the processed metrics to a golden metrics store
+	 * @details processed_metrics is still valid while the store is alive
+	 * @return true if the simulation owned the processed metrics (to be adopted by the store)
+	 */
+	bool ReleaseProcessedMetrics();
 
 	/**
 	 * @brief Sets similarComputedGS
@@ -83,8 +92,9 @@ public:
 
 
 	/**
-	 * @brief copies processed_metrics
-	 * @param processed_metrics
+	 * @brief shares the results of a similar simulation
+	 * @details processed_metrics are shared, owned by similarSimulatedGS
+	 * @param similarSimulatedGS
 	 */
 	bool CopyResultsFromGoldenSimulation( GoldenSimulation* similarSimulatedGS );
 
@@ -101,6 +111,10 @@ private:
 	std::string singular_results_path;
 	/// Golden Simulation saves the metrics here
 	std::vector<Metric*>* processed_metrics;
+	/// processed_metrics deleted by this simulation (not shared nor adopted by a store)
+	bool processed_metrics_owned;
+	/// golden metrics store (not nested simulations)
+	std::shared_ptr<NDMetricsStructure> golden_metrics_store;
 	/// Metrics to be found
 	std::vector<Metric*>* metrics_2be_found;
 
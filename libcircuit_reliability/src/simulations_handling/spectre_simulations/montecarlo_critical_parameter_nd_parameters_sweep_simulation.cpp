@@ -14,10 +14,12 @@
 
 // math
 #include <cmath>
+#include <limits>
 // Boost
 // #include "boost/filesystem.hpp" // includes all needed Boost.Filesystem declarations
 // Radiation simulator
 #include "montecarlo_critical_parameter_nd_parameters_sweep_simulation.hpp"
+#include "../scenario_stager.hpp"
 #include "../../io_handling/results_processor.hpp"
 // constants
 #include "../../global_functions_and_constants/gnuplot_constants.hpp"
@@ -30,6 +32,7 @@ MontecarloCriticalParameterNDParametersSweepSimulation::MontecarloCriticalParame
 	this->max_parallel_profile_instances = 10;
 	this->plot_last_transients = false;
 	this->plot_critical_parameter_value_evolution = false;
+	this->adaptive_sweep_threshold = 0;
 	// injection mode related
 	this->has_additional_injection = false;
 }
@@ -55,7 +58,7 @@ void MontecarloCriticalParameterNDParametersSweepSimulation::RunSimulation( ){
 		true, kNotDefinedInt, kNotDefinedInt, kNotDefinedInt, kNotDefinedInt, kNotDefinedInt );
 	AddAdditionalSimulationParameter( numRunParameter );
 	log_io->ReportPurpleStandard( "MC numruns set to:" + numRunParameter->get_value() );
-	boost::thread_group mainTG;
+	SimulationsTaskGroup mainTG( thread_pool, max_parallel_profile_instances );
 	// params to be sweeped
 	std::vector<SimulationParameter*> parameters2sweep;
 	// Threads Creation
@@ -77,39 +80,44 @@ void MontecarloCriticalParameterNDParametersSweepSimulation::RunSimulation( ){
 		correctly_processed = false;
 		return;
 	}
-	// Environment: maybe ConfigureEnvironmentVariables is required. see critical_parameter_ND_....
+	// Environment: each spectre process gets its own ahdl environment (GetSpectreEnvironmentVariables)
 	log_io->ReportThread( "Total threads to be simulated: " + number2String(totalThreads) + ". Max number of sweep threads: " + number2String(max_parallel_profile_instances), 1 );
-	// parallel threads control
-	unsigned int runningThreads = 0;
-	unsigned int threadsCount = 0;
-	// current parameter sweep indexes
-	std::vector<unsigned int> parameterCountIndexes(parameters2sweep.size(), 0);
 	montecarlo_critical_parameter_value_simulations_vector.set_group_name("montecarlo_critical_parameter_value_simulations_vector");
-	montecarlo_critical_parameter_value_simulations_vector.ReserveSimulationsInMemory( totalThreads );
 	log_io->ReportThread( "Total threads to be simulated: " + number2String(totalThreads)
 		+ ". Max number of concurrent profile threads: " + number2String(max_parallel_profile_instances)
 		+ ". Max number of concurrent montecarlo threads: " + number2String(max_parallel_montecarlo_instances), 1 );
-	while( threadsCount<totalThreads ){
-		// wait for resources
-		WaitForResources( runningThreads, max_parallel_profile_instances, mainTG, threadsCount );
-		// CreateProfile sets all parameter values, and after the simulation object
-		// is created it can be updated.
-		// Thus, it avoids race conditions when updating parameterCountIndexes and parameters2sweep
-		MontecarloCriticalParameterValueSimulation* pMCPVS = CreateProfile(parameterCountIndexes, parameters2sweep, threadsCount);
-		if( pMCPVS==nullptr ){
-			log_io->ReportError2AllLogs( "Null CreateProfile " + number2String(threadsCount) );
+	profile_simulation_positions.resize( totalThreads );
+	if( adaptive_sweep_threshold>0 ){
+		if( !RunAdaptiveSweep( mainTG, parameters2sweep ) ){
 			correctly_simulated = false;
 			correctly_processed = false;
 			return;
 		}
-		montecarlo_critical_parameter_value_simulations_vector.AddSpectreSimulation( pMCPVS );
-		mainTG.add_thread( new boost::thread(boost::bind(&MontecarloCriticalParameterValueSimulation::RunSimulation, pMCPVS)) );
-		// update variables
-		UpdateParameterSweepIndexes( parameterCountIndexes, parameters2sweep);
-		++threadsCount;
-		++runningThreads;
-	}
-	mainTG.join_all();
+	}else{
+		unsigned int threadsCount = 0;
+		// current parameter sweep indexes
+		std::vector<unsigned int> parameterCountIndexes(parameters2sweep.size(), 0);
+		montecarlo_critical_parameter_value_simulations_vector.ReserveSimulationsInMemory( totalThreads );
+		while( threadsCount<totalThreads ){
+			// CreateProfile sets all parameter values, and after the simulation object
+			// is created it can be updated.
+			// Thus, it avoids race conditions when updating parameterCountIndexes and parameters2sweep
+			MontecarloCriticalParameterValueSimulation* pMCPVS = CreateProfile(parameterCountIndexes, parameters2sweep, threadsCount);
+			if( pMCPVS==nullptr ){
+				log_io->ReportError2AllLogs( "Null CreateProfile " + number2String(threadsCount) );
+				correctly_simulated = false;
+				correctly_processed = false;
+				return;
+			}
+			profile_simulation_positions.at(threadsCount) = threadsCount;
+			montecarlo_critical_parameter_value_simulations_vector.AddSpectreSimulation( pMCPVS );
+			mainTG.Run( boost::bind(&MontecarloCriticalParameterValueSimulation::RunSimulation, pMCPVS) );
+			// update variables
+			UpdateParameterSweepIndexes( parameterCountIndexes, parameters2sweep);
+			++threadsCount;
+		}
+		mainTG.Wait();
+	}
 	// check if every simulation ended correctly
 	correctly_simulated = montecarlo_critical_parameter_value_simulations_vector.CheckCorrectlySimulated();
 	correctly_processed = montecarlo_critical_parameter_value_simulations_vector.CheckCorrectlyProcessed();
@@ -122,6 +130,56 @@ void MontecarloCriticalParameterNDParametersSweepSimulation::RunSimulation( ){
 	log_io->ReportPlain2Log( "END OF MontecarloCriticalParameterNDParametersSweepSimulation::RunSimulation" );
 }
 
+bool MontecarloCriticalParameterNDParametersSweepSimulation::RunAdaptiveSweep(
+	SimulationsTaskGroup& mainTG, std::vector<SimulationParameter*>& parameters2sweep ){
+	std::vector<unsigned int> sweepStepsNumbers;
+	for( auto const &p : parameters2sweep ){
+		sweepStepsNumbers.push_back( p->get_sweep_steps_number() );
+	}
+	adaptive_sampler.set_refinement_threshold( adaptive_sweep_threshold );
+	adaptive_sampler.Init( sweepStepsNumbers );
+	std::vector<unsigned int> levelProfiles;
+	unsigned int level = 0;
+	while( adaptive_sampler.GetNextProfiles( levelProfiles ) ){
+		log_io->ReportThread( "#" + simulation_id + " adaptive sweep level " + number2String(level++)
+			+ ", profiles: " + number2String(levelProfiles.size()), 1 );
+		std::vector<MontecarloCriticalParameterValueSimulation*> levelSimulations;
+		for( auto const &ndProfileIndex : levelProfiles ){
+			auto parameterCountIndexes = adaptive_sampler.GetParameterCountIndexes( ndProfileIndex );
+			MontecarloCriticalParameterValueSimulation* pMCPVS = CreateProfile(parameterCountIndexes, parameters2sweep, ndProfileIndex);
+			if( pMCPVS==nullptr ){
+				log_io->ReportError2AllLogs( "Null CreateProfile " + number2String(ndProfileIndex) );
+				mainTG.Wait();
+				return false;
+			}
+			profile_simulation_positions.at(ndProfileIndex) = montecarlo_critical_parameter_value_simulations_vector.get_spectre_simulations()->size();
+			montecarlo_critical_parameter_value_simulations_vector.AddSpectreSimulation( pMCPVS );
+			levelSimulations.push_back( pMCPVS );
+			mainTG.Run( boost::bind(&MontecarloCriticalParameterValueSimulation::RunSimulation, pMCPVS) );
+		}
+		// the next level depends on the mean critical values of this one
+		mainTG.Wait();
+		for( auto const &pMCPVS : levelSimulations ){
+			adaptive_sampler.SetProfileValue( pMCPVS->get_n_d_profile_index(),
+				pMCPVS->get_correctly_simulated() && pMCPVS->get_correctly_processed() ?
+					pMCPVS->get_montecarlo_simulation_results()->get_mean_critical_parameter_value()
+					: std::numeric_limits<double>::quiet_NaN() );
+		}
+	}
+	adaptive_sampler.InterpolateProfiles();
+	log_io->ReportPlainStandard( k2Tab + "#" + simulation_id + " adaptive sweep, simulated profiles: "
+		+ number2String(adaptive_sampler.get_simulated_profiles_count()) + "/"
+		+ number2String(adaptive_sampler.get_total_profiles()) );
+	return true;
+}
+
+MontecarloCriticalParameterValueSimulation* MontecarloCriticalParameterNDParametersSweepSimulation::GetProfileSimulation(
+	const unsigned int ndProfileIndex ){
+	unsigned int sourceProfile = adaptive_sweep_threshold>0 ? adaptive_sampler.GetSourceProfile( ndProfileIndex ) : ndProfileIndex;
+	return dynamic_cast<MontecarloCriticalParameterValueSimulation*>(
+		montecarlo_critical_parameter_value_simulations_vector.get_spectre_simulations()->at( profile_simulation_positions.at(sourceProfile) ) );
+}
+
 bool MontecarloCriticalParameterNDParametersSweepSimulation::TestSetUp(){
 	if( golden_critical_parameter==nullptr ){
 		log_io->ReportError2AllLogs( "nullptr golden_critical_parameter in montecarlo_critical_parameter_simulation");
@@ -152,15 +210,10 @@ MontecarloCriticalParameterValueSimulation* MontecarloCriticalParameterNDParamet
 		 log_io->ReportError2AllLogs( "Error running profile" );
 		 return nullptr;
 	}
-	// copy only files to folder
-	// find . -maxdepth 1 -type f -exec cp {} destination_path \;
-	std::string copyNetlists0 = "find ";
-	std::string copyNetlists1 = " -maxdepth 1 -type f -exec cp {} ";
-	std::string copyNetlists2 = " \\;";
-	std::string copyNetlists;
-	copyNetlists = copyNetlists0 + folder + copyNetlists1 + currentFolder + copyNetlists2;
-	if( std::system( copyNetlists.c_str() ) > 0){
-		 log_io->ReportError2AllLogs( k2Tab + "-> Error while copying netlist to '" + currentFolder + "'." );
+	// stage only files to folder, the netlists are shared (hardlinks)
+	ScenarioStager scenarioStager;
+	if( !scenarioStager.StageFolder( folder, currentFolder ) ){
+		 log_io->ReportError2AllLogs( k2Tab + "-> Error while staging netlist in '" + currentFolder + "'." );
 		 log_io->ReportError2AllLogs( "Error running sweep" );
 		 return nullptr;
 	}
@@ -190,6 +243,8 @@ MontecarloCriticalParameterValueSimulation* MontecarloCriticalParameterNDParamet
 	// pMCPVS->set_parameter_index( paramIndex );
 	// pMCPVS->set_sweep_index( sweepIndex );
 	pMCPVS->set_log_io( log_io );
+	pMCPVS->set_thread_pool( thread_pool );
+	pMCPVS->set_resource_broker( resource_broker );
 	pMCPVS->set_altered_scenario_index( altered_scenario_index );
 	pMCPVS->set_golden_metrics_structure( golden_metrics_structure );
 	// Spectre command and args
@@ -217,7 +272,12 @@ MontecarloCriticalParameterValueSimulation* MontecarloCriticalParameterNDParamet
 	// fgarcia: false?, so we analyze later s_xxx_001.tran, s_xxx_002..tran... instead s_xxx.tran
 	pMCPVS->set_process_metrics( true );
 	pMCPVS->set_export_processed_metrics( export_processed_metrics );
+	pMCPVS->set_binary_processed_transients( binary_processed_transients );
 	pMCPVS->set_export_metric_errors( export_metric_errors );
+	pMCPVS->set_streaming_analysis( streaming_analysis );
+	pMCPVS->set_critical_parameter_parallel_probes( critical_parameter_parallel_probes );
+	pMCPVS->set_critical_parameter_root_finding( critical_parameter_root_finding );
+	pMCPVS->set_critical_parameter_batch_probes( critical_parameter_batch_probes );
 	// copy of simulation_parameters
 	pMCPVS->CopySimulationParameters( *simulation_parameters );
 	/// Update golden parameter
@@ -464,12 +524,11 @@ bool MontecarloCriticalParameterNDParametersSweepSimulation::GenerateAndPlotItem
 			<< golden_critical_parameter->get_name() << "(max, min and mean)"
 			<<" MAG_i_name MAG_i_maxErrorMetric MAG_i_minErrorMetric "
 			<< "MAG_i_meanMaxErrorMetric MAG_i_medianMaxErrorMetric q12 q34 MAG_i_maxMaxErrorGlobal MAG_i_minMaxErrorGlobal MAG_i_meanMaxErrorGlobal\n";
-		unsigned int profileCount = 0;
 		unsigned int p1SweepCount = 0;
 		unsigned int p2SweepCount = 0;
-		for( auto& simulation : *(montecarlo_critical_parameter_value_simulations_vector.get_spectre_simulations()) ){
-			if( vectorContains(profileIndexesInPlane, profileCount) ){
-				MontecarloCriticalParameterValueSimulation* mcSSim = dynamic_cast<MontecarloCriticalParameterValueSimulation*>(simulation);
+		for( unsigned int ndProfileIndex=0; ndProfileIndex<profile_simulation_positions.size(); ++ndProfileIndex ){
+			if( vectorContains(profileIndexesInPlane, ndProfileIndex) ){
+				MontecarloCriticalParameterValueSimulation* mcSSim = GetProfileSimulation( ndProfileIndex );
 				if( p2SweepCount==p2->get_sweep_steps_number() ){
 					p2SweepCount = 0;
 					++p1SweepCount;
@@ -488,7 +547,6 @@ bool MontecarloCriticalParameterNDParametersSweepSimulation::GenerateAndPlotItem
 				}
 				gnuplotMapFile << "\n";
 			}// update counters
-			++profileCount;
 			UpdateParameterSweepIndexes( auxiliarIndexes, parameters2sweep );
 		}
 	}catch (std::exception const& ex) {
@@ -541,8 +599,9 @@ bool MontecarloCriticalParameterNDParametersSweepSimulation::GenerateAndPlotGene
 		auto sweepParameter = parameters2sweep.at(0);
 		std::string auxIndexes;
 		std::string auxSpectreError;
-		for( auto const &simulation : *(montecarlo_critical_parameter_value_simulations_vector.get_spectre_simulations()) ){
-			MontecarloCriticalParameterValueSimulation* mcSSim = dynamic_cast<MontecarloCriticalParameterValueSimulation*>(simulation);
+		for( unsigned int ndProfileIndex=0; ndProfileIndex<profile_simulation_positions.size(); ++ndProfileIndex ){
+			// adaptive sweeps: not simulated profiles get the results of the nearest simulated one
+			MontecarloCriticalParameterValueSimulation* mcSSim = GetProfileSimulation( ndProfileIndex );
 			auxIndexes = getIndexCode( auxiliarIndexes );
 			auxSpectreError = mcSSim->get_correctly_simulated() ? "0" : "1";
 			auto auxMCResults = mcSSim->get_montecarlo_simulation_results();
@@ -19,6 +19,7 @@
 // #include "spectre_simulation.hpp"
 #include "spectre_simulations_vector.hpp"
 #include "montecarlo_critical_parameter_value_simulation.hpp"
+#include "../adaptive_nd_sweep_sampler.hpp"
 // netlist modeling
 #include "../../netlist_modeling/simulation_parameter.hpp"
 #include "../../netlist_modeling/statements/control_statement.hpp"
@@ -63,6 +64,16 @@ public:
 
 	void set_montecarlo_iterations( unsigned int montecarlo_iterations) { this->montecarlo_iterations = montecarlo_iterations; }
 
+	/**
+	 * @brief Sets adaptive_sweep_threshold
+	 * @details Max relative change of the mean critical values in a not refined sweep cell.
+	 * 0 simulates the full cartesian sweep.
+	 *
+	 * @param adaptive_sweep_threshold
+	 */
+	void set_adaptive_sweep_threshold( const double adaptive_sweep_threshold ){
+		this->adaptive_sweep_threshold = adaptive_sweep_threshold; }
+
 	// for use outside [profile files]
 	std::vector<unsigned int>* get_out_profile_c_i_max(){ return &out_profile_c_i_max; }
 	std::vector<unsigned int>* get_out_profile_c_i_min(){ return &out_profile_c_i_min; }
@@ -91,6 +102,11 @@ private:
 	/// plot last transient
 	bool plot_last_transients;
 	bool plot_critical_parameter_value_evolution;
+	/// adaptive sampling of the sweep (0: full sweep)
+	double adaptive_sweep_threshold;
+	AdaptiveNDSweepSampler adaptive_sampler;
+	/// nd profile index -> position in montecarlo_critical_parameter_value_simulations_vector
+	std::vector<unsigned int> profile_simulation_positions;
 
 	/// offset to crit max value
 	const unsigned int out_gnuplot_crit_param_offset = 3;
@@ -128,6 +144,24 @@ private:
 	 */
 	virtual bool TestSetUp() override;
 
+	/**
+	 * @brief Simulates the coarse grid profiles and refines the cells with sharp mean critical value changes
+	 *
+	 * @param mainTG
+	 * @param parameters2sweep
+	 * @return false if a profile can not be created
+	 */
+	bool RunAdaptiveSweep( SimulationsTaskGroup& mainTG, std::vector<SimulationParameter*>& parameters2sweep );
+
+	/**
+	 * @brief Simulation providing the results of a profile
+	 * @details The profile one or, in adaptive sweeps, the nearest simulated profile one
+	 *
+	 * @param ndProfileIndex
+	 * @return montecarlo critical parameter value simulation
+	 */
+	MontecarloCriticalParameterValueSimulation* GetProfileSimulation( const unsigned int ndProfileIndex );
+
 	/**
 	 * @brief Creates a new critical_parameter_value_simulation instance
 	 *
@@ -14,6 +14,7 @@
 #include <cmath>
 // Radiation simulator
 #include "montecarlo_critical_parameter_value_simulation.hpp"
+#include "../scenario_stager.hpp"
 #include "../../io_handling/raw_format_processor.hpp"
 // constants
 #include "../../global_functions_and_constants/global_constants.hpp"
@@ -65,12 +66,10 @@ void MontecarloCriticalParameterValueSimulation::RunSimulation( ){
 		log_io->ReportError2AllLogs( "simulation_parameters is nullptr. ");
 		return;
 	}
-	boost::thread_group mainTG;
+	SimulationsTaskGroup mainTG( thread_pool, max_parallel_montecarlo_instances );
 	// Register Parameters
 	montecarlo_simulation_results.set_full_id( simulation_id );
 	montecarlo_simulation_results.RegisterSimulationParameters(simulation_parameters);
-	// parallel threads control
-	unsigned int runningThreads = 0;
 	unsigned int threadsCount = 0;
 	critical_parameter_value_simulations_vector.set_group_name("critical_parameter_value_simulations_vector");
 	critical_parameter_value_simulations_vector.ReserveSimulationsInMemory( montecarlo_iterations );
@@ -78,8 +77,6 @@ void MontecarloCriticalParameterValueSimulation::RunSimulation( ){
 		log_io->ReportThread( "Total montecarlo to be simulated: " + number2String(montecarlo_iterations) + ". Max number of montecarlo threads: " + number2String(max_parallel_montecarlo_instances), 1 );
 	#endif
 	while( threadsCount<montecarlo_iterations ){
-		// wait for resources
-		WaitForResources( runningThreads, max_parallel_montecarlo_instances, mainTG, threadsCount );
 		// CreateProfile sets all parameter values, and after the simulation object
 		// is created it can be updated.
 		// Thus, it avoids race conditions when updating parameterCountIndexes and parameters2sweep
@@ -91,12 +88,11 @@ void MontecarloCriticalParameterValueSimulation::RunSimulation( ){
 			return;
 		}
 		critical_parameter_value_simulations_vector.AddSpectreSimulation( pCPVS );
-		mainTG.add_thread( new boost::thread(boost::bind(&CriticalParameterValueSimulation::RunSimulation, pCPVS)) );
+		mainTG.Run( boost::bind(&CriticalParameterValueSimulation::RunSimulation, pCPVS) );
 		// update variables
 		++threadsCount;
-		++runningThreads;
 	}
-	mainTG.join_all();
+	mainTG.Wait();
 	// process data
 	#ifdef RESULTS_ANALYSIS_VERBOSE
 		log_io->ReportPlainStandard( k2Tab + "[montecarlo_critical_parameter_simulation] Generating Map files.");
@@ -128,15 +124,10 @@ CriticalParameterValueSimulation* MontecarloCriticalParameterValueSimulation::Cr
 		 log_io->ReportError2AllLogs( "Error running profile" );
 		 return nullptr;
 	}
-	// copy only files to folder
-	// find . -maxdepth 1 -type f -exec cp {} destination_path \;
-	std::string copyNetlists0 = "find ";
-	std::string copyNetlists1 = " -maxdepth 1 -type f -exec cp {} ";
-	std::string copyNetlists2 = " \\;";
-	std::string copyNetlists;
-	copyNetlists = copyNetlists0 + folder + copyNetlists1 + currentFolder + copyNetlists2;
-	if( std::system( copyNetlists.c_str() ) > 0){
-		 log_io->ReportError2AllLogs( k2Tab + "-> Error while copying netlist to '" + currentFolder + "'." );
+	// stage only files to folder, the netlists are shared (hardlinks)
+	ScenarioStager scenarioStager;
+	if( !scenarioStager.StageFolder( folder, currentFolder ) ){
+		 log_io->ReportError2AllLogs( k2Tab + "-> Error while staging netlist in '" + currentFolder + "'." );
 		 log_io->ReportError2AllLogs( "Error running sweep" );
 		 return nullptr;
 	}
@@ -162,6 +153,8 @@ CriticalParameterValueSimulation* MontecarloCriticalParameterValueSimulation::Cr
 	// pCPVS->set_parameter_index( paramIndex );
 	// pCPVS->set_sweep_index( sweepIndex );
 	pCPVS->set_log_io( log_io );
+	pCPVS->set_thread_pool( thread_pool );
+	pCPVS->set_resource_broker( resource_broker );
 	pCPVS->set_altered_scenario_index( altered_scenario_index );
 	pCPVS->set_golden_metrics_structure( golden_metrics_structure );
 	// Spectre command and args
@@ -187,7 +180,11 @@ CriticalParameterValueSimulation* MontecarloCriticalParameterValueSimulation::Cr
 	pCPVS->set_main_transient_analysis( main_transient_analysis );
 	pCPVS->set_process_metrics( true );
 	pCPVS->set_export_processed_metrics( export_processed_metrics );
+	pCPVS->set_binary_processed_transients( binary_processed_transients );
 	pCPVS->set_export_metric_errors( export_metric_errors );
+	pCPVS->set_streaming_analysis( streaming_analysis );
+	pCPVS->set_critical_parameter_parallel_probes( critical_parameter_parallel_probes );
+	pCPVS->set_critical_parameter_root_finding( critical_parameter_root_finding );
 	// copy of simulation_parameters
 	pCPVS->CopySimulationParameters( *simulation_parameters );
 	/// Update numruns parameter
@@ -551,14 +548,33 @@ bool MontecarloCriticalParameterValueSimulation::PlotMetricScatters(
 			gnuplotScriptFile << "set style fill solid" << "\n";
 			// legend
 			gnuplotScriptFile << "set key bottom right" << "\n";
+			// binary processed transients, time arrays loaded before the plot command
+			std::vector<std::string> binarySources;
+			if( binary_processed_transients ){
+				for( const auto& gS : *(critical_parameter_value_simulations_vector.get_spectre_simulations()) ){
+					CriticalParameterValueSimulation* pCPVS = dynamic_cast<CriticalParameterValueSimulation*>(gS);
+					auto ir = pCPVS->get_last_valid_transient_simulation_results();
+					binarySources.push_back( ExportGnuplotBinarySource( gnuplotScriptFile, ir->get_processed_file_path(),
+						magResultIndex-1, "time_" + number2String(binarySources.size()) ) );
+				}
+			}
 			// Plot
 			gnuplotScriptFile << "plot '" << goldenFilePath << "' u 1:" << number2String(magResultIndex) << " w l ls 1 title 'Golden', \\" << "\n";
 			unsigned int irCount = 2;
 			for( const auto& gS : *(critical_parameter_value_simulations_vector.get_spectre_simulations()) ){
 				CriticalParameterValueSimulation* pCPVS = dynamic_cast<CriticalParameterValueSimulation*>(gS);
 				auto ir = pCPVS->get_last_valid_transient_simulation_results();
-				gnuplotScriptFile << " '" << ir->get_processed_file_path() << "' u 1:" << number2String(magResultIndex)
-					<< " w p ls " << number2String(irCount++) << " notitle, \\" << "\n";
+				if( binary_processed_transients ){
+					// not read
+					if( binarySources.at(irCount-2).empty() ){
+						++irCount;
+						continue;
+					}
+					gnuplotScriptFile << " " << binarySources.at(irCount-2);
+				}else{
+					gnuplotScriptFile << " '" << ir->get_processed_file_path() << "' u 1:" << number2String(magResultIndex);
+				}
+				gnuplotScriptFile << " w p ls " << number2String(irCount++) << " notitle, \\" << "\n";
 			}
 			gnuplotScriptFile << "\n";
 			gnuplotScriptFile << "ntics = 15" << "\n";
@@ -18,6 +18,7 @@
 // #include "boost/filesystem.hpp" // includes all needed Boost.Filesystem declarations
 // Radiation simulator
 #include "montecarlo_nd_parameters_sweep_simulation.hpp"
+#include "../scenario_stager.hpp"
 #include "../../io_handling/results_processor.hpp"
 // constants
 #include "../../global_functions_and_constants/gnuplot_constants.hpp"
@@ -55,7 +56,7 @@ void MontecarloNDParametersSweepSimulation::RunSimulation( ){
 	AddAdditionalSimulationParameter( numRunParameter );
 	log_io->ReportPurpleStandard( "MC numruns set to:" + numRunParameter->get_value() );
 
-	boost::thread_group mainTG;
+	SimulationsTaskGroup mainTG( thread_pool, max_parallel_profile_instances );
 	// params to be sweeped
 	std::vector<SimulationParameter*> parameters2sweep;
 	// Threads Creation
@@ -77,20 +78,16 @@ void MontecarloNDParametersSweepSimulation::RunSimulation( ){
 		correctly_processed = false;
 		return;
 	}
-	// Environment: maybe ConfigureEnvironmentVariables is required. see critical_parameter_ND_....
+	// Environment: each spectre process gets its own ahdl environment (GetSpectreEnvironmentVariables)
 	log_io->ReportThread( "Total threads to be simulated: " + number2String(totalThreads)
 		+ ". Max number of concurrent profile threads: " + number2String(max_parallel_profile_instances)
 		+ ". Max number of concurrent montecarlo threads: " + number2String(max_parallel_montecarlo_instances), 1 );
-	// parallel threads control
-	unsigned int runningThreads = 0;
 	unsigned int threadsCount = 0;
 	// current parameter sweep indexes
 	std::vector<unsigned int> parameterCountIndexes(parameters2sweep.size(), 0);
 	montecarlo_standard_simulations_vector.set_group_name("montecarlo_simulations_vector");
 	montecarlo_standard_simulations_vector.ReserveSimulationsInMemory( totalThreads );
 	while( threadsCount<totalThreads ){
-		// wait for resources
-		WaitForResources( runningThreads, max_parallel_profile_instances, mainTG, threadsCount );
 		// CreateProfile sets all parameter values, and after the simulation object
 		// is created it can be updated.
 		// Thus, it avoids race conditions when updating parameterCountIndexes and parameters2sweep
@@ -102,13 +99,12 @@ void MontecarloNDParametersSweepSimulation::RunSimulation( ){
 			return;
 		}
 		montecarlo_standard_simulations_vector.AddSpectreSimulation( pMSS );
-		mainTG.add_thread( new boost::thread(boost::bind(&MontecarloSimulation::RunSimulation, pMSS)) );
+		mainTG.Run( boost::bind(&MontecarloSimulation::RunSimulation, pMSS) );
 		// update variables
 		UpdateParameterSweepIndexes( parameterCountIndexes, parameters2sweep);
 		++threadsCount;
-		++runningThreads;
 	}
-	mainTG.join_all();
+	mainTG.Wait();
 	// check if every simulation ended correctly
 	correctly_simulated = montecarlo_standard_simulations_vector.CheckCorrectlySimulated();
 	correctly_processed = montecarlo_standard_simulations_vector.CheckCorrectlyProcessed();
@@ -145,15 +141,10 @@ MontecarloSimulation* MontecarloNDParametersSweepSimulation::CreateProfile(
 		 log_io->ReportError2AllLogs( "Error running profile" );
 		 return nullptr;
 	}
-	// copy only files to folder
-	// find . -maxdepth 1 -type f -exec cp {} destination_path \;
-	std::string copyNetlists0 = "find ";
-	std::string copyNetlists1 = " -maxdepth 1 -type f -exec cp {} ";
-	std::string copyNetlists2 = " \\;";
-	std::string copyNetlists;
-	copyNetlists = copyNetlists0 + folder + copyNetlists1 + currentFolder + copyNetlists2;
-	if( std::system( copyNetlists.c_str() ) > 0){
-		 log_io->ReportError2AllLogs( k2Tab + "-> Error while copying netlist to '" + currentFolder + "'." );
+	// stage only files to folder, the netlists are shared (hardlinks)
+	ScenarioStager scenarioStager;
+	if( !scenarioStager.StageFolder( folder, currentFolder ) ){
+		 log_io->ReportError2AllLogs( k2Tab + "-> Error while staging netlist in '" + currentFolder + "'." );
 		 log_io->ReportError2AllLogs( "Error running sweep" );
 		 return nullptr;
 	}
@@ -182,6 +173,8 @@ MontecarloSimulation* MontecarloNDParametersSweepSimulation::CreateMontecarloSim
 	// pMSS->set_parameter_index( paramIndex );
 	// pMSS->set_sweep_index( sweepIndex );
 	pMSS->set_log_io( log_io );
+	pMSS->set_thread_pool( thread_pool );
+	pMSS->set_resource_broker( resource_broker );
 	pMSS->set_altered_scenario_index( altered_scenario_index );
 	pMSS->set_golden_metrics_structure( golden_metrics_structure );
 	// Spectre command and args
@@ -208,6 +201,7 @@ MontecarloSimulation* MontecarloNDParametersSweepSimulation::CreateMontecarloSim
 	// fgarcia: false?, so we analyze later s_xxx_001.tran, s_xxx_002..tran... instead s_xxx.tran
 	pMSS->set_process_metrics( false );
 	pMSS->set_export_processed_metrics( export_processed_metrics );
+	pMSS->set_binary_processed_transients( binary_processed_transients );
 	pMSS->set_export_metric_errors( export_metric_errors );
 	// copy of simulation_parameters
 	pMSS->CopySimulationParameters( *simulation_parameters );
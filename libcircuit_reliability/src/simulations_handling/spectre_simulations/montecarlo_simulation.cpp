@@ -85,11 +85,14 @@ void MontecarloSimulation::RunSimulation( ){
 	// RunSpectreMC
 	int auxSpectreResult = RunSpectre( simulation_id );
 	montecarlo_simulation_results.set_spectre_result( auxSpectreResult );
-	// Transients processing
+	// Transients processing, each iteration parses and analyzes its own transient file.
+	// AnalyzeMontecarloResults reduces them in iteration order
+	SimulationsTaskGroup tgIterations( thread_pool, max_parallel_montecarlo_instances );
 	for( auto const &ps : *(montecarlo_simulations_vector.get_spectre_simulations()) ){
 		StandardSimulation* pSS = dynamic_cast<StandardSimulation*>( ps );
-		pSS->ProcessMetricsFromExt( auxSpectreResult );
+		tgIterations.Run( boost::bind(&StandardSimulation::ProcessMetricsFromExt, pSS, auxSpectreResult) );
 	}
+	tgIterations.Wait();
 	// process data
 	#ifdef RESULTS_ANALYSIS_VERBOSE
 		log_io->ReportPlainStandard( k2Tab + "[montecarlo_simulation] Generating Map files " + simulation_id);
@@ -139,18 +142,12 @@ int MontecarloSimulation::RunSpectre( const std::string& scenarioId ){
 		return kNotDefinedInt;
 	}
 	// Environment variables
-	ConfigureEnvironmentVariables();
 	ShowEnvironmentVariables();
 	// standard runspectre
-	std::string execCommand = spectre_command + " "
-		+ spectre_command_log_arg + " " + folder + kFolderSeparator + kSpectreLogFile + " "
-		+ spectre_command_folder_arg + " " + folder + kFolderSeparator + kSpectreResultsFolder + " "
-		+ folder + kFolderSeparator + kMainNetlistFile
-		+ " " + post_spectre_command + " " + folder + kFolderSeparator + kSpectreStandardLogsFile ;
 	#ifdef SPECTRE_SIMULATIONS_VERBOSE
 		log_io->ReportPlainStandard( k2Tab + "#" + scenarioId + " scenario: Simulating scenario." );
 	#endif
-	int spectre_result = std::system( execCommand.c_str() ) ;
+	int spectre_result = ExecuteSpectre( folder, &montecarlo_simulation_results );
 	if(spectre_result>0){
 		correctly_simulated = false;
 		log_io->ReportError2AllLogs( "Unexpected Spectre spectre_result for scenario #"
@@ -214,6 +211,7 @@ StandardSimulation* MontecarloSimulation::CreateMonteCarloIteration( unsigned in
 	pSS->set_main_transient_analysis( main_transient_analysis );
 	pSS->set_process_metrics( true );
 	pSS->set_export_processed_metrics( export_processed_metrics );
+	pSS->set_binary_processed_transients( binary_processed_transients );
 	pSS->set_export_metric_errors( export_metric_errors );
 	// copy of simulation_parameters
 	pSS->CopySimulationParameters( *simulation_parameters );
@@ -470,14 +468,33 @@ bool MontecarloSimulation::PlotMetricScatters(
 			gnuplotScriptFile << "set style fill solid" << "\n";
 			// legend
 			gnuplotScriptFile << "set key bottom right" << "\n";
+			// binary processed transients, time arrays loaded before the plot command
+			std::vector<std::string> binarySources;
+			if( binary_processed_transients ){
+				for( const auto& gS : *(montecarlo_simulations_vector.get_spectre_simulations()) ){
+					StandardSimulation* pSS = dynamic_cast<StandardSimulation*>(gS);
+					auto ir = pSS->get_basic_simulation_results();
+					binarySources.push_back( ExportGnuplotBinarySource( gnuplotScriptFile, ir->get_processed_file_path(),
+						magResultIndex-1, "time_" + number2String(binarySources.size()) ) );
+				}
+			}
 			// Plot
 			gnuplotScriptFile << "plot '" << goldenFilePath << "' u 1:" << number2String(magResultIndex) << " w l ls 1 title 'Golden', \\" << "\n";
 			unsigned int irCount = 2;
 			for( const auto& gS : *(montecarlo_simulations_vector.get_spectre_simulations()) ){
 				StandardSimulation* pSS = dynamic_cast<StandardSimulation*>(gS);
 				auto ir = pSS->get_basic_simulation_results();
-				gnuplotScriptFile << " '" << ir->get_processed_file_path() << "' u 1:" << number2String(magResultIndex)
-					<< " w p ls " << number2String(irCount++) << " notitle, \\" << "\n";
+				if( binary_processed_transients ){
+					// not read
+					if( binarySources.at(irCount-2).empty() ){
+						++irCount;
+						continue;
+					}
+					gnuplotScriptFile << " " << binarySources.at(irCount-2);
+				}else{
+					gnuplotScriptFile << " '" << ir->get_processed_file_path() << "' u 1:" << number2String(magResultIndex);
+				}
+				gnuplotScriptFile << " w p ls " << number2String(irCount++) << " notitle, \\" << "\n";
 			}
 			gnuplotScriptFile << "\n";
 			gnuplotScriptFile << "ntics = 15" << "\n";
@@ -8,11 +8,14 @@
 #include <algorithm>
 
 #include "boost/filesystem.hpp" // includes all needed Boost.Filesystem declarations
+#include <boost/algorithm/string.hpp>
 
 // Reliability simulator
 #include "spectre_simulation.hpp"
+#include "../spectre_process_launcher.hpp"
 #include "../../metric_modeling/metric_errors.hpp"
 #include "../../io_handling/raw_format_processor.hpp"
+#include "../../io_handling/processed_results_file.hpp"
 // constants
 #include "../../global_functions_and_constants/gnuplot_constants.hpp"
 #include "../../global_functions_and_constants/global_constants.hpp"
@@ -22,6 +25,7 @@
 
 SpectreSimulation::SpectreSimulation() {
 	this->altered_scenario_index = kNotDefinedInt;
+	this->equivalent_simulation = nullptr;
 	this->folder = kNotDefinedString;
 	this->top_folder = kNotDefinedString;
 	this->delete_spectre_transients = true;
@@ -31,7 +35,15 @@ SpectreSimulation::SpectreSimulation() {
 	this->ahdl_shipdb_env = kNotDefinedString;
 	this->process_metrics = true;
 	this->export_processed_metrics = false;
+	this->binary_processed_transients = false;
 	this->export_metric_errors = false;
+	this->streaming_analysis = false;
+	this->critical_parameter_parallel_probes = 1;
+	this->critical_parameter_root_finding = false;
+	this->critical_parameter_batch_probes = false;
+	this->thread_pool = nullptr;
+	this->resource_broker = nullptr;
+	this->warm_start_store = nullptr;
 	this->correctly_simulated = false;
 	this->correctly_processed = false;
 	this->is_nested_simulation = false;
@@ -69,19 +81,79 @@ void SpectreSimulation::AddAdditionalSimulationParameter(
 	simulation_parameters->push_back( simulationParameter );
 }
 
-void SpectreSimulation::WaitForResources( unsigned int& threadsCount,
-	const unsigned int maxThreads, boost::thread_group& tg, const unsigned int thread2BeWaited ){
-	if( threadsCount == maxThreads ){
-		// Wait for threads
-		#ifdef SPECTRE_SIMULATIONS_VERBOSE
-		log_io->ReportPlainStandard( "Scenario # " + simulation_id + " Waiting for resources until thread #" + number2String(thread2BeWaited) );
-		#endif
-		tg.join_all();
-		#ifdef SPECTRE_SIMULATIONS_VERBOSE
-		log_io->ReportPlainStandard( "Scenario # " + simulation_id + ". OK, next thread " + number2String(thread2BeWaited) );
-		#endif
-		threadsCount = 0;
+int SpectreSimulation::ExecuteSpectre( const std::string& currentFolder,
+	TransientSimulationResults* transientSimulationResults ){
+	SpectreProcessLauncher::ProcessUsage usage;
+	int spectre_result = LaunchSpectre( currentFolder, usage );
+	if( transientSimulationResults!=nullptr ){
+		transientSimulationResults->set_spectre_wall_time( usage.wall_time );
+		transientSimulationResults->set_spectre_cpu_time( usage.cpu_time );
+		transientSimulationResults->set_spectre_max_rss( usage.max_rss );
+	}
+	return spectre_result;
+}
+
+int SpectreSimulation::ExecuteSpectre( const std::string& currentFolder,
+	MontecarloSimulationResults* montecarloSimulationResults ){
+	SpectreProcessLauncher::ProcessUsage usage;
+	int spectre_result = LaunchSpectre( currentFolder, usage );
+	montecarloSimulationResults->set_spectre_wall_time( usage.wall_time );
+	montecarloSimulationResults->set_spectre_cpu_time( usage.cpu_time );
+	montecarloSimulationResults->set_spectre_max_rss( usage.max_rss );
+	return spectre_result;
+}
+
+int SpectreSimulation::LaunchSpectre( const std::string& currentFolder,
+	SpectreProcessLauncher::ProcessUsage& usage ){
+	SpectreProcessLauncher launcher;
+	std::vector<std::string> arguments;
+	std::string trimmedPostCommand = post_spectre_command;
+	boost::algorithm::trim( trimmedPostCommand );
+	// the spectre command is launched directly unless it requires a shell
+	bool directLaunch = launcher.SplitCommand( spectre_command, arguments )
+		&& trimmedPostCommand.compare( ">" )==0;
+	double weight = 0;
+	if( resource_broker!=nullptr ){
+		weight = resource_broker->EstimateNetlistWeight( currentFolder );
+		resource_broker->Acquire( weight );
+	}
+	int spectre_result;
+	if( directLaunch ){
+		arguments.push_back( spectre_command_log_arg );
+		arguments.push_back( currentFolder + kFolderSeparator + kSpectreLogFile );
+		arguments.push_back( spectre_command_folder_arg );
+		arguments.push_back( currentFolder + kFolderSeparator + kSpectreResultsFolder );
+		arguments.push_back( currentFolder + kFolderSeparator + kMainNetlistFile );
+		spectre_result = launcher.Launch( arguments, GetSpectreEnvironmentVariables(),
+			currentFolder + kFolderSeparator + kSpectreStandardLogsFile, usage );
+	}else{
+		std::string execCommand = spectre_command + " "
+			+ spectre_command_log_arg + " " + currentFolder + kFolderSeparator + kSpectreLogFile + " "
+			+ spectre_command_folder_arg + " " + currentFolder + kFolderSeparator + kSpectreResultsFolder + " "
+			+ currentFolder + kFolderSeparator + kMainNetlistFile
+			+ " " + post_spectre_command + " " + currentFolder + kFolderSeparator + kSpectreStandardLogsFile;
+		spectre_result = launcher.LaunchShell( execCommand, GetSpectreEnvironmentVariables(), usage );
 	}
+	if( resource_broker!=nullptr ){
+		resource_broker->Release( weight );
+	}
+	#ifdef SPECTRE_SIMULATIONS_VERBOSE
+	log_io->ReportPlain2Log( k2Tab + "#" + simulation_id + " spectre usage: wall time "
+		+ number2String(usage.wall_time) + "s, cpu time " + number2String(usage.cpu_time)
+		+ "s, max rss " + number2String(usage.max_rss) + "kB" );
+	#endif
+	return spectre_result;
+}
+
+std::vector<std::string> SpectreSimulation::GetSpectreEnvironmentVariables() const{
+	// AHDL compiled components environment configuration
+	std::vector<std::string> environmentVariables;
+	for( auto const &ev : { kEnableAHDL, ahdl_simdb_env, kEnable_AHDLCMI_SHIPDB_COPY, ahdl_shipdb_env } ){
+		if( ev.find('=')!=std::string::npos ){
+			environmentVariables.push_back( ev );
+		}
+	}
+	return environmentVariables;
 }
 
 bool SpectreSimulation::UpdateParameterValue( SimulationParameter& updatedParameter,
@@ -161,7 +233,8 @@ bool SpectreSimulation::ExportParametersCircuit( std::string currentFolder,
 // but while called from 'parent' simulations, they are different parameters
 bool SpectreSimulation::InterpolateAndAnalyzeMetrics(
 	TransientSimulationResults& transientSimulationResults,
-	std::vector<Metric*>& simulatedMetrics, const unsigned int index, const std::string partialId  ){
+	std::vector<Metric*>& simulatedMetrics, const unsigned int index, const std::string partialId,
+	std::vector<MagnitudeComparator*>* magnitudeComparators ){
 	bool reliabilityError = false;
 	// obtain std::vector<Metric*>* metrics depending on its profile index
 	auto golden_metrics = golden_metrics_structure->GetMetricsVector( index );
@@ -177,6 +250,12 @@ bool SpectreSimulation::InterpolateAndAnalyzeMetrics(
 	}
 	auto pTimeGolden = static_cast<Magnitude*>(*(golden_metrics->begin()));
 	auto pTimeSim = static_cast<Magnitude*>(*(simulatedMetrics.begin()));
+	// time axes merged once for every magnitude, the per sample reports require the scalar path
+	MergedTimebase mergedTimebase;
+	MergedTimebase* pMergedTimebase = export_metric_errors ? nullptr : &mergedTimebase;
+	#ifdef RESULTS_ANALYSIS_VERBOSE
+		pMergedTimebase = nullptr;
+	#endif
 	std::vector<Metric*>::iterator it_m = ++(simulatedMetrics.begin());
 	// for each metric
 	for(std::vector<Metric*>::iterator it_mg = ++(golden_metrics->begin()); it_mg != golden_metrics->end(); ++it_mg){
@@ -186,8 +265,18 @@ bool SpectreSimulation::InterpolateAndAnalyzeMetrics(
 			#ifdef SPECTRE_SIMULATIONS_VERBOSE
 				log_io->ReportPlain2Log( kTab + (*it_mg)->get_name() + " metric of scenario #" + simulation_id + " partial_id=" + partialId + " will be analyzed.");
 			#endif
-			if( !InterpolateAndAnalyzeMagnitude( transientSimulationResults, reliabilityError,
-					*pMagGolden, *pMagSim, *pTimeGolden, *pTimeSim, partialId )) {
+			bool analyzed;
+			if( magnitudeComparators!=nullptr ){
+				auto pComparator = magnitudeComparators->at( std::distance( simulatedMetrics.begin(), it_m ) );
+				analyzed = AnalyzeStreamedMagnitude( transientSimulationResults, reliabilityError,
+					*pComparator, *pTimeGolden, *pMagSim, partialId );
+			}else{
+				auto goldenEnvelope = golden_metrics_structure->GetMarginEnvelope( index,
+					std::distance( golden_metrics->begin(), it_mg ) );
+				analyzed = InterpolateAndAnalyzeMagnitude( transientSimulationResults, reliabilityError,
+					*pMagGolden, *pMagSim, *pTimeGolden, *pTimeSim, partialId, pMergedTimebase, goldenEnvelope );
+			}
+			if( !analyzed ) {
 				log_io->ReportError2AllLogs( "Error interpolating magnitude " + (*it_mg)->get_name() + " at the scenario #" + partialId);
 				transientSimulationResults.set_reliability_result( kScenarioSensitive );
 				return false;
@@ -222,6 +311,80 @@ bool SpectreSimulation::InterpolateAndAnalyzeMetrics(
 	return true;
 }
 
+std::vector<MagnitudeComparator*>* SpectreSimulation::CreateMagnitudeComparators(
+	const unsigned int index, std::vector<Metric*>& simulatedMetrics ){
+	auto golden_metrics = golden_metrics_structure->GetMetricsVector( index );
+	// InterpolateAndAnalyzeMetrics reports invalid metrics
+	if( simulatedMetrics.size()<2 || golden_metrics->size()!=simulatedMetrics.size() ){
+		return nullptr;
+	}
+	auto pTimeGolden = static_cast<Magnitude*>( golden_metrics->front() );
+	auto magnitudeComparators = new std::vector<MagnitudeComparator*>( simulatedMetrics.size(), nullptr );
+	for( unsigned int i=1; i<golden_metrics->size(); ++i ){
+		if( golden_metrics->at(i)->get_analyzable() && golden_metrics->at(i)->is_transient_magnitude() ){
+			magnitudeComparators->at(i) = new MagnitudeComparator( *static_cast<Magnitude*>( golden_metrics->at(i) ),
+				*pTimeGolden, *static_cast<Magnitude*>( simulatedMetrics.at(i) ),
+				golden_metrics_structure->GetMarginEnvelope( index, i ) );
+		}
+	}
+	return magnitudeComparators;
+}
+
+bool SpectreSimulation::AnalyzeStreamedMagnitude( TransientSimulationResults& transientSimulationResults,
+	bool& reliabilityError, MagnitudeComparator& magnitudeComparator, Magnitude& goldenTime,
+	Magnitude& simulatedMagnitude, const std::string& partialId ){
+	#ifdef RESULTS_ANALYSIS_VERBOSE
+		log_io->ReportPlain2Log( kTab + "#" + simulation_id + " " + partialId + " -> Streamed metric " + simulatedMagnitude.get_name()
+			+ ", " + number2String(magnitudeComparator.get_samples_count()) + " samples read" );
+	#endif
+	if( magnitudeComparator.get_samples_count()==0 ){
+		log_io->ReportError2AllLogs( "No samples of metric " + simulatedMagnitude.get_name() + " in scenario # " + partialId );
+		return false;
+	}
+	// check simulation lengths, final time is only known if the whole transient has been read
+	if( magnitudeComparator.get_end_of_stream()
+		&& std::abs(magnitudeComparator.get_last_simulated_time() - goldenTime.get_last_value()) > goldenTime.get_last_value()*kSpectreMaxAllowedSimDiffCoeff ){
+		log_io->ReportError2AllLogs("Altered scenario final time:" + number2String(magnitudeComparator.get_last_simulated_time())
+			+ " golden final time:" + number2String(goldenTime.get_last_value()) );
+		log_io->ReportError2AllLogs("Simulation initial-final times, in scenario # "
+			+ partialId + " do not coincide with golden scenario timing.");
+		return false;
+	}
+	// MetricError
+	MetricErrors* metricErrors = new MetricErrors();
+	metricErrors->set_transient_magnitude( true );
+	metricErrors->set_metric_name( simulatedMagnitude.get_name() );
+	// add it
+	transientSimulationResults.AddMetricErrors( metricErrors );
+	if( !magnitudeComparator.get_valid_golden_window() || !magnitudeComparator.get_started() ){
+		log_io->ReportError2AllLogs( "Invalid t0 window for simulation #" + partialId );
+		return false;
+	}
+	if( magnitudeComparator.get_interpolation_error() ){
+		log_io->ReportError2AllLogs( "Scenario #" + simulation_id + " " + magnitudeComparator.get_interpolation_error_message() );
+		log_io->ReportError2AllLogs( "-> #" + partialId + " Interpolation error at metric " + simulatedMagnitude.get_name());
+		metricErrors->set_has_errors( true );
+		transientSimulationResults.set_has_metrics_errors( true );
+		return false;
+	}
+	if( magnitudeComparator.get_metric_error() ){
+		// only the first error is recorded, as in InterpolateAndAnalyzeMagnitude
+		if( !reliabilityError ){
+			metricErrors->AddErrorTiming( number2String(magnitudeComparator.get_first_error_time()), "");
+		}
+		reliabilityError = true;
+		transientSimulationResults.set_has_metrics_errors( true );
+	}
+	// report results, lower bounds if the transient was partially read
+	metricErrors->set_max_abs_error( magnitudeComparator.get_max_abs_error() );
+	metricErrors->set_max_abs_error_global( magnitudeComparator.get_max_abs_error_global() );
+	metricErrors->set_has_errors( magnitudeComparator.get_metric_error() );
+	if( magnitudeComparator.get_finished() || magnitudeComparator.get_end_of_stream() ){
+		metricErrors->set_max_error_margin_ratio( magnitudeComparator.get_max_error_margin_ratio() );
+	}
+	return true;
+}
+
 bool SpectreSimulation::AnalyzeOceanEvalMetric(TransientSimulationResults& transientSimulationResults,
 	bool& reliabilityError, OceanEvalMetric& goldenMetric, OceanEvalMetric& simulatedMetric, const std::string & partialId ){
 	#ifdef SPECTRE_SIMULATIONS_VERBOSE
@@ -259,9 +422,9 @@ bool SpectreSimulation::AnalyzeOceanEvalMetric(TransientSimulationResults& trans
 }
 
 bool SpectreSimulation::Get2AnalyzableTimeWindow(
-	std::vector<double>::iterator& itGoldenTime, std::vector<double>::iterator& itGoldenTimeEnd,
-	std::vector<double>::iterator& itSimulatedTime, std::vector<double>::iterator& itSimulatedTimeEnd,
-	std::vector<double>::iterator& itGoldenMetric, std::vector<double>::iterator& itSimulatedMetric,
+	const double*& itGoldenTime, const double*& itGoldenTimeEnd,
+	const double*& itSimulatedTime, const double*& itSimulatedTimeEnd,
+	const double*& itGoldenMetric, const double*& itSimulatedMetric,
 	double analyzableTimeWindowT0 ){
 	// starting time is the window t0
 	while( itGoldenTime < itGoldenTimeEnd && *itGoldenTime < analyzableTimeWindowT0 ){
@@ -285,7 +448,7 @@ bool SpectreSimulation::Get2AnalyzableTimeWindow(
 
 bool SpectreSimulation::CheckEndOfWindow(
 	const bool metricAnalizableInTWindow, const double& analyzableTimeWindowTF,
-	std::vector<double>::iterator& itGoldenTime, std::vector<double>::iterator& itSimulatedTime ){
+	const double*& itGoldenTime, const double*& itSimulatedTime ){
 	// fgarcia note:
 	//best performance I think
 	if( metricAnalizableInTWindow
@@ -307,17 +470,17 @@ void SpectreSimulation::ReportSimulationsLengthError( Magnitude& goldenTime,
 	log_io->ReportError2AllLogs("Maybe there was an Spectre error previous to this step.");
 	log_io->ReportError2AllLogs("Golden size:" + number2String( goldenTime.get_values_size() ));
 	log_io->ReportError2AllLogs("Altered size:" + number2String( simulatedTime.get_values_size()));
-	if( goldenTime.get_values()->front() != simulatedTime.get_values()->front() ){
-		log_io->ReportError2AllLogs("Golden initial time:" + number2String(goldenTime.get_values()->front()));
-		log_io->ReportError2AllLogs("Altered scenario initial time:" + number2String(simulatedTime.get_values()->front()));
+	if( goldenTime.get_first_value() != simulatedTime.get_first_value() ){
+		log_io->ReportError2AllLogs("Golden initial time:" + number2String(goldenTime.get_first_value()));
+		log_io->ReportError2AllLogs("Altered scenario initial time:" + number2String(simulatedTime.get_first_value()));
 		log_io->ReportError2AllLogs("Diff:"
-			+ number2String(simulatedTime.get_values()->front() - goldenTime.get_values()->front() ));
+			+ number2String(simulatedTime.get_first_value() - goldenTime.get_first_value() ));
 	}
-	if( goldenTime.get_values()->back() != simulatedTime.get_values()->back() ){
-		log_io->ReportError2AllLogs("Golden final time:" + number2String(goldenTime.get_values()->back()));
-		log_io->ReportError2AllLogs("Altered scenario final time:" + number2String(simulatedTime.get_values()->back()));
+	if( goldenTime.get_last_value() != simulatedTime.get_last_value() ){
+		log_io->ReportError2AllLogs("Golden final time:" + number2String(goldenTime.get_last_value()));
+		log_io->ReportError2AllLogs("Altered scenario final time:" + number2String(simulatedTime.get_last_value()));
 		log_io->ReportError2AllLogs("Diff:"
-			+ number2String(simulatedTime.get_values()->back() - goldenTime.get_values()->back() ));
+			+ number2String(simulatedTime.get_last_value() - goldenTime.get_last_value() ));
 	}
 	#endif
 	log_io->ReportError2AllLogs("Simulation initial-final times, in scenario # "
@@ -325,8 +488,8 @@ void SpectreSimulation::ReportSimulationsLengthError( Magnitude& goldenTime,
 }
 
 void SpectreSimulation::VerboseStartMagnitudeAnalysis(
-	std::vector<double>::iterator& itGoldenTime, std::vector<double>::iterator& itSimulatedTime,
-	std::vector<double>::iterator& itGoldenMetric, std::vector<double>::iterator& itSimulatedMetric,
+	const double*& itGoldenTime, const double*& itSimulatedTime,
+	const double*& itGoldenMetric, const double*& itSimulatedMetric,
 	const Magnitude& simulatedMetric ){
 	#ifdef RESULTS_ANALYSIS_VERBOSE
 		log_io->ReportPlain2Log("****************************" );
@@ -354,7 +517,7 @@ void SpectreSimulation::VerboseReliabilityError( const std::string& errorType,
 	TransientSimulationResults& transientSimulationResults, const std::string& partialId,
 	const std::string& magName, const double& currentTime, const double& currentMetricError,
 	const double& currentSimulatedValue, const double& currentGoldenValue, const double& backSimulatedValue, const double& backGoldenValue,
-	std::vector<double>::iterator& itSimulatedMetric, std::vector<double>::iterator& itGoldenMetric ){
+	const double*& itSimulatedMetric, const double*& itGoldenMetric ){
 	#ifdef RESULTS_ANALYSIS_VERBOSE
 		log_io->ReportPlain2Log( k2Tab + "[RELIABILITY ERROR] #" + partialId
 			+ " Scenario, #" + transientSimulationResults.get_full_id()
@@ -372,18 +535,49 @@ void SpectreSimulation::VerboseReliabilityError( const std::string& errorType,
 	#endif
 }
 
+bool SpectreSimulation::AnalyzeMagnitudeOverTimebase( TransientSimulationResults& transientSimulationResults,
+	bool& reliabilityError, MetricErrors& metricErrors, MergedTimebase& mergedTimebase,
+	Magnitude& goldenMagnitude, Magnitude& simulatedMagnitude, const MarginEnvelope* goldenEnvelope,
+	const std::string& partialId ){
+	MergedTimebase::comparison_t comparison;
+	mergedTimebase.Compare( goldenMagnitude, simulatedMagnitude, goldenEnvelope, comparison );
+	if( comparison.metric_error ){
+		// only the first error is recorded
+		if( !reliabilityError ){
+			metricErrors.AddErrorTiming( number2String(comparison.first_error_time), "");
+		}
+		reliabilityError = true;
+		transientSimulationResults.set_has_metrics_errors( true );
+	}
+	#ifdef SPECTRE_SIMULATIONS_VERBOSE
+		log_io->ReportPlain2Log( "-> #" + partialId + " Scenario, #" + transientSimulationResults.get_full_id()
+					+ " variation, metric " + simulatedMagnitude.get_name() + " Analyzed.");
+	#endif
+	// report results
+	metricErrors.set_max_abs_error( comparison.max_abs_error );
+	metricErrors.set_max_abs_error_global( comparison.max_abs_error_global );
+	metricErrors.set_max_error_margin_ratio( comparison.max_error_margin_ratio );
+	metricErrors.set_has_errors( comparison.metric_error );
+	return true;
+}
+
 bool SpectreSimulation::InterpolateAndAnalyzeMagnitude( TransientSimulationResults& transientSimulationResults,
 	bool& reliabilityError, Magnitude& goldenMagnitude, Magnitude& simulatedMagnitude,
-	Magnitude& goldenTime, Magnitude& simulatedTime, const std::string& partialId ){
+	Magnitude& goldenTime, Magnitude& simulatedTime, const std::string& partialId,
+	MergedTimebase* mergedTimebase, const MarginEnvelope* goldenEnvelope ){
 
 	#ifdef RESULTS_ANALYSIS_VERBOSE
 		log_io->ReportPlain2Log( kTab + "#" + simulation_id + " " + partialId + " -> Interpolating/Analyzing metric " + simulatedMagnitude.get_name() );
 	#endif
+	if( goldenTime.get_values_size()<2 || simulatedTime.get_values_size()<2 ){
+		log_io->ReportError2AllLogs( "Not enough samples of metric " + simulatedMagnitude.get_name() + " in scenario # " + partialId );
+		return false;
+	}
 	// check simulation lengths
-	if( goldenTime.get_values()->front() != simulatedTime.get_values()->front()
-		|| goldenTime.get_values()->back() != simulatedTime.get_values()->back() ){
+	if( goldenTime.get_first_value() != simulatedTime.get_first_value()
+		|| goldenTime.get_last_value() != simulatedTime.get_last_value() ){
 		log_io->ReportPlain2Log("Simulation initial-final times, in scenario # " + partialId + " do not coincide with golden scenario timing.");
-		if( std::abs(simulatedTime.get_values()->back() - goldenTime.get_values()->back()) > goldenTime.get_values()->back()*kSpectreMaxAllowedSimDiffCoeff ){
+		if( std::abs(simulatedTime.get_last_value() - goldenTime.get_last_value()) > goldenTime.get_last_value()*kSpectreMaxAllowedSimDiffCoeff ){
 			ReportSimulationsLengthError( goldenTime, simulatedTime, partialId );
 			return false;
 		}
@@ -394,16 +588,21 @@ bool SpectreSimulation::InterpolateAndAnalyzeMagnitude( TransientSimulationResul
 	metricErrors->set_metric_name( simulatedMagnitude.get_name() );
 	// add it
 	transientSimulationResults.AddMetricErrors( metricErrors );
+	// invalid windows and interpolation errors are reported by the scalar path
+	if( mergedTimebase!=nullptr && mergedTimebase->Build( goldenTime, simulatedTime, goldenMagnitude ) ){
+		return AnalyzeMagnitudeOverTimebase( transientSimulationResults, reliabilityError, *metricErrors,
+			*mergedTimebase, goldenMagnitude, simulatedMagnitude, goldenEnvelope, partialId );
+	}
 
 	// Values Pointers: goldenTime, simulatedTime, goldenMagnitude, simulatedMagnitude
-	// all are std::vector<double>::iterator
-	auto itGoldenTime = goldenTime.get_values()->begin();
-	auto itSimulatedTime = simulatedTime.get_values()->begin();
-	auto itGoldenMetric = goldenMagnitude.get_values()->begin();
-	auto itSimulatedMetric = simulatedMagnitude.get_values()->begin();
+	// all are trace set columns
+	const double* itGoldenTime = goldenTime.get_values();
+	const double* itSimulatedTime = simulatedTime.get_values();
+	const double* itGoldenMetric = goldenMagnitude.get_values();
+	const double* itSimulatedMetric = simulatedMagnitude.get_values();
 	// End pointers
-	auto itGoldenTimeEnd = goldenTime.get_values()->end();
-	auto itSimulatedTimeEnd = simulatedTime.get_values()->end();
+	const double* itGoldenTimeEnd = itGoldenTime + goldenTime.get_values_size();
+	const double* itSimulatedTimeEnd = itSimulatedTime + simulatedTime.get_values_size();
 
 	// metrics errors
 	bool metricError = false;
@@ -412,6 +611,7 @@ bool SpectreSimulation::InterpolateAndAnalyzeMagnitude( TransientSimulationResul
 	// statistics
 	double maxAbsErrorGlobal = 0;
 	double maxAbsError = 0;
+	double maxErrorMarginRatio = 0;
 	// partial result
 	bool partialResult = true;
 	std::string computedErrorFilePath = top_folder + kFolderSeparator
@@ -535,6 +735,11 @@ bool SpectreSimulation::InterpolateAndAnalyzeMagnitude( TransientSimulationResul
 				absErrorMargin = simulatedMagnitude.get_abs_error_margin_zeros();
 				absErrorTimeSpan = simulatedMagnitude.get_error_time_span_zeros();
 			}
+			// distance to the band margin, ommited values do not count
+			if( CheckError( simulatedMagnitude, currentSimulatedValue, currentGoldenValue, currentMetricError, 0 )
+				&& maxErrorMarginRatio<currentMetricError/absErrorMargin ){
+				maxErrorMarginRatio = currentMetricError/absErrorMargin;
+			}
 			// for abs error stats
 			bool updateMaxAbsError = false;
 			// Punctual errors
@@ -611,6 +816,7 @@ bool SpectreSimulation::InterpolateAndAnalyzeMagnitude( TransientSimulationResul
 		// report results
 		metricErrors->set_max_abs_error( maxAbsError );
 		metricErrors->set_max_abs_error_global( maxAbsErrorGlobal );
+		metricErrors->set_max_error_margin_ratio( maxErrorMarginRatio );
 		metricErrors->set_has_errors( metricError );
 		if( metricError ){
 			transientSimulationResults.set_has_metrics_errors( true );
@@ -630,11 +836,7 @@ bool SpectreSimulation::InterpolateAndAnalyzeMagnitude( TransientSimulationResul
 
 bool SpectreSimulation::CheckError( const Magnitude& magnitude, const double& currentSimulatedValue,
 	const double& currentGoldenValue, const double& currentMetricError, const double& absErrorMargin ){
-// fgarcia needs a revision, we require from a default '1' and '0' level
-	return  ( currentMetricError > absErrorMargin ) &&
-				!( (magnitude.get_ommit_upper_threshold() && currentGoldenValue > magnitude.get_error_threshold_ones() )
-					|| (magnitude.get_ommit_lower_threshold() && currentGoldenValue < magnitude.get_error_threshold_zeros()) );
-	// return  currentMetricError > absErrorMargin;
+	return MagnitudeComparator::CheckError( magnitude, currentGoldenValue, currentMetricError, absErrorMargin );
 }
 
 double SpectreSimulation::InterpolateValue( bool& interpolationError,
@@ -653,46 +855,12 @@ double SpectreSimulation::InterpolateValue( bool& interpolationError,
 	return (a - x1)*(y2 - y1)/(x2 - x1) + y1;
 }
 
-void SpectreSimulation::ConfigureEnvironmentVariables(){
-	// AHDL compiled components environment configuration
-	#ifdef SPECTRE_SIMULATIONS_VERBOSE
-	log_io->ReportPlain2Log( " #" + simulation_id + " AHDL compiled components environment configuration." );
-	#endif
-	int env_result = putenv( (char*)kEnableAHDL.c_str() );
-	// SIMDB
-	env_result += putenv( (char*)ahdl_simdb_env.c_str() );
-	// SHIDB
-	env_result += putenv( (char*)kEnable_AHDLCMI_SHIPDB_COPY.c_str() );
-	env_result += putenv( (char*)ahdl_shipdb_env.c_str() );
-	if( env_result>0 ){
-		log_io->ReportRedStandard("[Warning] ConfigureEnvironmentVariables may have failed.");
-	}
-}
-
 void SpectreSimulation::ShowEnvironmentVariables(){
 	#ifdef SPECTRE_SIMULATIONS_VERBOSE
-	std::string message;
-	const char* env_variable;
-	message = " #" + simulation_id + " $CDS_AHDLCMI_ENABLE: ";
-	if( (env_variable=std::getenv("CDS_AHDLCMI_ENABLE")) != nullptr){
-		message += env_variable ;
-	}
-	log_io->ReportPlain2Log( message );
-	message = " #" + simulation_id + " $CDS_AHDLCMI_SIMDB_DIR: ";
-	if( (env_variable=std::getenv("CDS_AHDLCMI_SIMDB_DIR")) != nullptr){
-		message += env_variable;
-	}
-	log_io->ReportPlain2Log( message );
-	message = " #" + simulation_id + " $CDS_AHDLCMI_SHIPDB_COPY: ";
-	if( (env_variable=std::getenv("CDS_AHDLCMI_SHIPDB_COPY")) != nullptr){
-		message += env_variable ;
-	}
-	log_io->ReportPlain2Log( message );
-	message = " #" + simulation_id + " $CDS_AHDLCMI_SHIPDB_DIR: ";
-	if( (env_variable=std::getenv("CDS_AHDLCMI_SHIPDB_DIR")) != nullptr){
-		message += env_variable;
-	}
-	log_io->ReportPlain2Log( message );
+	// environment of the spectre child processes, the parent environment is not modified
+	for( auto const &ev : GetSpectreEnvironmentVariables() ){
+		log_io->ReportPlain2Log( " #" + simulation_id + " $" + ev );
+	}
 	#endif
 }
 
@@ -724,12 +892,41 @@ std::string SpectreSimulation::GetProcessedResultsFilePath(const std::string& cu
 	}
 	return top_folder + kFolderSeparator + kResultsFolder + kFolderSeparator + kResultsDataFolder
 		+ kFolderSeparator + kTransientResultsFolder + kFolderSeparator
-		+ localSimulationId + "_" + kProcessedTransientFile;
+		+ localSimulationId + "_" + GetProcessedTransientFile();
+}
+
+const std::string& SpectreSimulation::GetProcessedTransientFile() const{
+	return binary_processed_transients ? kProcessedBinaryTransientFile : kProcessedTransientFile;
+}
+
+const std::string& SpectreSimulation::GetProcessedDataSufix() const{
+	return binary_processed_transients ? kBinaryDataSufix : kDataSufix;
+}
+
+std::string SpectreSimulation::ExportGnuplotBinarySource( std::ostream& gnuplotScriptFile,
+	const std::string& processedResultsFilePath, const unsigned int column, const std::string& timeArray ){
+	ProcessedResultsFile processedResultsFile;
+	std::string timeKeywords;
+	std::string columnKeywords;
+	if( processedResultsFile.Open( processedResultsFilePath ) ){
+		timeKeywords = processedResultsFile.GetGnuplotBinaryKeywords( 0 );
+		columnKeywords = processedResultsFile.GetGnuplotBinaryKeywords( column );
+	}
+	if( timeKeywords.empty() || columnKeywords.empty() || processedResultsFile.get_points_count()==0 ){
+		log_io->ReportError2AllLogs( "Error reading the binary processed transient " + processedResultsFilePath );
+		return kEmptyWord;
+	}
+	// the columns are not interleaved, the metric is plotted against the time array
+	gnuplotScriptFile << "array " << timeArray << "[" << processedResultsFile.get_points_count() << "]\n";
+	gnuplotScriptFile << "stats '" << processedResultsFilePath << "' " << timeKeywords
+		<< " u (" << timeArray << "[int($0)+1]=$1) nooutput\n";
+	return "'" + processedResultsFilePath + "' " + columnKeywords + " u (" + timeArray + "[int($0)+1]):1";
 }
 
 bool SpectreSimulation::ProcessSpectreResults( const std::string& currentFolder, const std::string& localSimulationId,
 	TransientSimulationResults& transientSimulationResults, const bool& processMainTransient,
-	std::vector<Metric*>& myParameterMetrics, const bool& isGolden, const bool& isMontecarloNested ){
+	std::vector<Metric*>& myParameterMetrics, const bool& isGolden, const bool& isMontecarloNested,
+	std::vector<MagnitudeComparator*>* magnitudeComparators ){
 	// obtain paths
 	std::string spectreResultsFilePath = GetSpectreResultsFilePath( currentFolder, processMainTransient);
 	std::string processedResultsFilePath = GetProcessedResultsFilePath( currentFolder,
@@ -740,7 +937,7 @@ bool SpectreSimulation::ProcessSpectreResults( const std::string& currentFolder,
 	RAWFormatProcessor* rfp = new RAWFormatProcessor();
 	//
 	rfp->set_additional_save( has_additional_injection );
-	rfp->set_format( kGnuPlot );
+	rfp->set_format( binary_processed_transients ? kBinary : kGnuPlot );
 	rfp->set_metrics( &myParameterMetrics );
 	rfp->set_transient_file_path( spectreResultsFilePath );
 	rfp->set_log_file_path( GetSpectreLogFilePath( currentFolder ) );
@@ -751,6 +948,7 @@ bool SpectreSimulation::ProcessSpectreResults( const std::string& currentFolder,
 	rfp->set_export_processed_metrics( export_processed_metrics );
 	rfp->set_is_golden( isGolden );
 	rfp->set_is_montecarlo_nested_simulation( isMontecarloNested );
+	rfp->set_magnitude_comparators( magnitudeComparators );
 	#ifdef SPECTRE_SIMULATIONS_VERBOSE
 		if(!is_nested_simulation){
 			log_io->ReportPlainStandard( k3Tab + "#" + localSimulationId + " scenario: processing spectre output data." + " path: '" + spectreResultsFilePath + "'");
@@ -904,7 +1102,17 @@ int SpectreSimulation::CreateGnuplotTransientImages( const std::string& localSim
 				gnuplotScriptFile <<  "set title \"" << mgName << " \"\n";
 				gnuplotScriptFile <<  "set key bottom right\n";
 				// Plot
-				gnuplotScriptFile <<  "plot '" << transientSimulationResults.get_processed_file_path() << "' u 1:" + number2String(indexCount) << " w lp ls 1 title 'altered', \\\n";
+				if( binary_processed_transients ){
+					std::string alteredSource = ExportGnuplotBinarySource( gnuplotScriptFile,
+						transientSimulationResults.get_processed_file_path(), indexCount-1, "altered_time" );
+					gnuplotScriptFile <<  "plot ";
+					if( !alteredSource.empty() ){
+						gnuplotScriptFile << alteredSource << " w lp ls 1 title 'altered', ";
+					}
+					gnuplotScriptFile << "\\\n";
+				}else{
+					gnuplotScriptFile <<  "plot '" << transientSimulationResults.get_processed_file_path() << "' u 1:" + number2String(indexCount) << " w lp ls 1 title 'altered', \\\n";
+				}
 				gnuplotScriptFile <<  " '" + goldenFilePath + "' u 1:" + number2String(indexCount) << " w lp ls 2 title 'golden'\n";
 				gnuplotScriptFile << "unset output\n";
 				// Add images path
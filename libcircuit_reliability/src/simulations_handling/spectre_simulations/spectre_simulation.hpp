@@ -11,14 +11,22 @@
 // c++ std libraries
 #include <string>
 #include <vector>
+#include <ostream>
 // boost threads
 #include <boost/thread.hpp>
 // Radiation simulator
 #include "../simulation_results/transient_simulation_results.hpp"
 #include "../simulation_results/nd_simulation_results.hpp"
+#include "../simulation_results/montecarlo_simulation_results.hpp"
 #include "../../metric_modeling/ocean_eval_metric.hpp"
+#include "../../metric_modeling/magnitude_comparator.hpp"
+#include "../../metric_modeling/merged_timebase.hpp"
 // radiation io simulator includes
 #include "../../io_handling/log_io.hpp"
+#include "../simulations_thread_pool.hpp"
+#include "../spectre_resource_broker.hpp"
+#include "../spectre_process_launcher.hpp"
+#include "../critical_parameter_warm_start_store.hpp"
 // netlist modeling
 #include "../../metric_modeling/n_d_metrics_structure.hpp"
 #include "../../netlist_modeling/simulation_parameter.hpp"
@@ -94,6 +102,35 @@ public:
 		this->export_metric_errors = export_metric_errors; }
 	void set_export_processed_metrics( const bool export_processed_metrics ){
 		this->export_processed_metrics = export_processed_metrics; }
+	/// processed transients exported as float64 columns (ProcessedResultsFile)
+	void set_binary_processed_transients( const bool binary_processed_transients ){
+		this->binary_processed_transients = binary_processed_transients; }
+	bool get_binary_processed_transients() const{ return binary_processed_transients; }
+	/// verdict only analysis, golden and simulated metrics compared while reading the raw file
+	void set_streaming_analysis( const bool streaming_analysis ){
+		this->streaming_analysis = streaming_analysis; }
+	bool get_streaming_analysis() const{ return streaming_analysis; }
+	/// critical parameter search, values simulated concurrently per round (1: bisection)
+	void set_critical_parameter_parallel_probes( const unsigned int critical_parameter_parallel_probes ){
+		this->critical_parameter_parallel_probes = critical_parameter_parallel_probes>0 ? critical_parameter_parallel_probes : 1; }
+	unsigned int get_critical_parameter_parallel_probes() const{ return critical_parameter_parallel_probes; }
+	/// critical parameter search, regula falsi on the metric errors instead of bisection
+	void set_critical_parameter_root_finding( const bool critical_parameter_root_finding ){
+		this->critical_parameter_root_finding = critical_parameter_root_finding; }
+	bool get_critical_parameter_root_finding() const{ return critical_parameter_root_finding; }
+	/// critical parameter search, the probes of a round are simulated in a single spectre run
+	void set_critical_parameter_batch_probes( const bool critical_parameter_batch_probes ){
+		this->critical_parameter_batch_probes = critical_parameter_batch_probes; }
+	bool get_critical_parameter_batch_probes() const{ return critical_parameter_batch_probes; }
+	/// shared pool running the child simulations
+	void set_thread_pool( SimulationsThreadPool* thread_pool ){
+		this->thread_pool = thread_pool; }
+	/// Spectre runs acquire their tokens from it
+	void set_resource_broker( SpectreResourceBroker* resource_broker ){
+		this->resource_broker = resource_broker; }
+	/// critical values of the finished profiles, nullptr: no warm start
+	void set_warm_start_store( CriticalParameterWarmStartStore* warm_start_store ){
+		this->warm_start_store = warm_start_store; }
 
 	void set_main_analysis( AnalysisStatement* main_analysis){ this->main_analysis = main_analysis;}
 
@@ -152,6 +189,24 @@ public:
 	 */
 	std::string get_simulation_id() const{ return simulation_id; }
 
+	/**
+	 * @brief Sets the electrically equivalent simulation run instead of this one
+	 *
+	 * @param equivalent_simulation
+	 */
+	void set_equivalent_simulation( SpectreSimulation* equivalent_simulation ){
+		this->equivalent_simulation = equivalent_simulation;
+	}
+	SpectreSimulation* get_equivalent_simulation() const{ return equivalent_simulation; }
+
+	/**
+	 * @brief gets the simulation holding the results of this one
+	 *
+	 * @return the equivalent simulation if any, this one otherwise
+	 */
+	SpectreSimulation* get_results_simulation(){
+		return equivalent_simulation==nullptr ? this : equivalent_simulation; }
+
 
  bool get_export_processed_metrics() const{ return export_processed_metrics; }
 
@@ -236,6 +291,8 @@ protected:
 	std::string simulation_id;
 	/// Scenario Index
 	int altered_scenario_index;
+	/// Equivalent simulation, run instead of this one
+	SpectreSimulation* equivalent_simulation;
 	/// For N-Dimensional sweep Simulations
 	bool n_dimensional;
 	/// n_d_profile_index profile_index
@@ -298,6 +355,22 @@ protected:
 	bool export_metric_errors;
 	/// Export processed metrics
 	bool export_processed_metrics;
+	/// Processed transients in the binary format, golden ones are text files
+	bool binary_processed_transients;
+	/// Streaming analysis (simulated transients are not stored)
+	bool streaming_analysis;
+	/// Critical parameter values simulated concurrently in each search round
+	unsigned int critical_parameter_parallel_probes;
+	/// Critical parameter values interpolated from the metric errors
+	bool critical_parameter_root_finding;
+	/// Critical parameter values of a round simulated in a single spectre run (alter statements)
+	bool critical_parameter_batch_probes;
+	/// Shared pool of workers, child simulations are run in it
+	SimulationsThreadPool* thread_pool;
+	/// Shared licenses/memory tokens of the Spectre runs
+	SpectreResourceBroker* resource_broker;
+	/// Shared critical values of the finished profiles (warm start)
+	CriticalParameterWarmStartStore* warm_start_store;
 	/// Golden metrics
 	NDMetricsStructure* golden_metrics_structure;
 
@@ -329,19 +402,43 @@ protected:
 	void ShowEnvironmentVariables();
 
 	/**
-	 * @brief Configures the ahdl environment variables
+	 * @brief ahdl environment variables of the spectre processes
+	 * @details They are passed to each child, instead of configuring
+	 * the environment of the (multithreaded) parent process.
+	 *
+	 * @return 'NAME=VALUE' variables
+	 */
+	std::vector<std::string> GetSpectreEnvironmentVariables() const;
+
+	/**
+	 * @brief Runs Spectre in a folder once a resource token is granted
+	 * @details Spectre is spawned without a shell when the commands allow it.
+	 *
+	 * @param currentFolder folder of the simulated netlist, also used to weight the token
+	 * @param transientSimulationResults stores the resources used by spectre, can be null
+	 * @return spectre result
+	 */
+	int ExecuteSpectre( const std::string& currentFolder,
+		TransientSimulationResults* transientSimulationResults );
+
+	/**
+	 * @brief Runs the Spectre montecarlo analysis in a folder
+	 *
+	 * @param currentFolder folder of the simulated netlist
+	 * @param montecarloSimulationResults stores the resources used by spectre
+	 * @return spectre result
 	 */
-	void ConfigureEnvironmentVariables();
+	int ExecuteSpectre( const std::string& currentFolder,
+		MontecarloSimulationResults* montecarloSimulationResults );
 
 	/**
-	 * @brief waits till resources are free
+	 * @brief Runs Spectre in a folder, see ExecuteSpectre
 	 *
-	 * @param threadsCount
-	 * @param maxThreads
-	 * @param thread_group
+	 * @param currentFolder
+	 * @param usage resources used by spectre
+	 * @return spectre result
 	 */
-	void WaitForResources( unsigned int & threadsCount,
-		const unsigned int maxThreads, boost::thread_group & tg, const unsigned int thread2BeWaited );
+	int LaunchSpectre( const std::string& currentFolder, SpectreProcessLauncher::ProcessUsage& usage );
 
 	/**
 	 * @brief [brief description]
@@ -359,7 +456,33 @@ protected:
 	 */
 	bool InterpolateAndAnalyzeMetrics(
 		TransientSimulationResults& transientSimulationResults,
-		std::vector<Metric*>& simulatedMetrics, const unsigned int index, const std::string partialId );
+		std::vector<Metric*>& simulatedMetrics, const unsigned int index, const std::string partialId,
+		std::vector<MagnitudeComparator*>* magnitudeComparators = nullptr );
+
+	/**
+	 * @brief Creates the streaming comparators of the analyzable transient magnitudes
+	 * (nullptr for time and non analyzed metrics)
+	 *
+	 * @param index golden metrics profile index
+	 * @param simulatedMetrics
+	 * @return comparators, one per metric. nullptr if the metrics are not valid
+	 */
+	std::vector<MagnitudeComparator*>* CreateMagnitudeComparators( const unsigned int index,
+		std::vector<Metric*>& simulatedMetrics );
+
+	/**
+	 * @brief Reports the result of a streaming comparison, as InterpolateAndAnalyzeMagnitude does
+	 *
+	 * @param TransientSimulationResults
+	 * @param reliabilityError
+	 * @param magnitudeComparator
+	 * @param goldenTime
+	 * @param simulatedMagnitude
+	 * @return true if the method correctly ends.
+	 */
+	bool AnalyzeStreamedMagnitude( TransientSimulationResults& transientSimulationResults,
+		bool& reliabilityError, MagnitudeComparator& magnitudeComparator, Magnitude& goldenTime,
+		Magnitude& simulatedMagnitude, const std::string& partialId );
 
 	/**
 	 * @brief Interpolates and analyzes the selected metric
@@ -370,11 +493,32 @@ protected:
 	  * @param simulatedMetric
 	  * @param goldenTime
 	  * @param simulatedTime
+	  * @param mergedTimebase merged time axes shared by the magnitudes, nullptr for the scalar path
+	  * @param goldenEnvelope classified golden samples, used along the merged timebase
 	 * @return true if the method correctly ends.
 	  */
 	bool InterpolateAndAnalyzeMagnitude( TransientSimulationResults& transientSimulationResults,
 		bool& reliabilityError, Magnitude& goldenMagnitude, Magnitude& simulatedMagnitude,
-		Magnitude& goldenTime, Magnitude& simulatedTime, const std::string& partialId );
+		Magnitude& goldenTime, Magnitude& simulatedTime, const std::string& partialId,
+		MergedTimebase* mergedTimebase = nullptr, const MarginEnvelope* goldenEnvelope = nullptr );
+
+	/**
+	 * @brief Reports the comparison of a magnitude along a merged timebase,
+	 * as InterpolateAndAnalyzeMagnitude does
+	 *
+	 * @param TransientSimulationResults
+	 * @param reliabilityError
+	 * @param metricErrors
+	 * @param mergedTimebase
+	 * @param goldenMagnitude
+	 * @param simulatedMagnitude
+	 * @param goldenEnvelope classified golden samples, can be nullptr
+	 * @return true if the method correctly ends.
+	 */
+	bool AnalyzeMagnitudeOverTimebase( TransientSimulationResults& transientSimulationResults,
+		bool& reliabilityError, MetricErrors& metricErrors, MergedTimebase& mergedTimebase,
+		Magnitude& goldenMagnitude, Magnitude& simulatedMagnitude, const MarginEnvelope* goldenEnvelope,
+		const std::string& partialId );
 
 	bool AnalyzeOceanEvalMetric(TransientSimulationResults& transientSimulationResults,
 			bool& reliabilityError, OceanEvalMetric& goldenMetric, OceanEvalMetric& simulatedMetric, const std::string & partialId );
@@ -404,7 +548,8 @@ protected:
 	 */
 	bool ProcessSpectreResults( const std::string& currentFolder, const std::string& localSimulationId,
 		TransientSimulationResults& transientSimulationResults, const bool& processMainTransient,
-		std::vector<Metric*>& myParameterMetrics, const bool& isGolden, const bool& isMontecarloNested );
+		std::vector<Metric*>& myParameterMetrics, const bool& isGolden, const bool& isMontecarloNested,
+		std::vector<MagnitudeComparator*>* magnitudeComparators = nullptr );
 
 	/**
 	 * @brief Plot the transient results
@@ -468,6 +613,24 @@ protected:
 	virtual std::string GetProcessedResultsFilePath(const std::string& currentFolder,
 		const std::string& localSimulationId, const bool& processMainTransient);
 
+	/// processed transient file name/sufix, text or binary
+	const std::string& GetProcessedTransientFile() const;
+	const std::string& GetProcessedDataSufix() const;
+
+	/**
+	 * @brief gnuplot plot source of a binary processed transient column,
+	 * gnuplot reads the columns in place. The time column is loaded in
+	 * a gnuplot array first (gnuplot 5.2 or newer)
+	 *
+	 * @param gnuplotScriptFile the time array is loaded here, before the plot command
+	 * @param processedResultsFilePath
+	 * @param column metric index, time is column 0
+	 * @param timeArray gnuplot array name
+	 * @return plot source, empty if the file can not be read
+	 */
+	std::string ExportGnuplotBinarySource( std::ostream& gnuplotScriptFile,
+		const std::string& processedResultsFilePath, const unsigned int column, const std::string& timeArray );
+
 	/**
 	 * @brief Creates a gnuplot of the transient
 	 *
@@ -495,28 +658,28 @@ protected:
 		const double& currentGoldenValue, const double& currentMetricError, const double& absErrorMargin  );
 
 	bool Get2AnalyzableTimeWindow(
-		std::vector<double>::iterator& itGoldenTime, std::vector<double>::iterator& itGoldenTimeEnd,
-		std::vector<double>::iterator& itSimulatedTime, std::vector<double>::iterator& itSimulatedTimeEnd,
-		std::vector<double>::iterator& itGoldenMetric, std::vector<double>::iterator& itSimulatedMetric,
+		const double*& itGoldenTime, const double*& itGoldenTimeEnd,
+		const double*& itSimulatedTime, const double*& itSimulatedTimeEnd,
+		const double*& itGoldenMetric, const double*& itSimulatedMetric,
 		double analyzableTimeWindowT0 );
 
 	bool CheckEndOfWindow(
 		const bool metricAnalizableInTWindow, const double& analyzableTimeWindowTF,
-		std::vector<double>::iterator& itGoldenTime, std::vector<double>::iterator& itSimulatedTime );
+		const double*& itGoldenTime, const double*& itSimulatedTime );
 
 	void ReportSimulationsLengthError( Magnitude& goldenTime,
 		Magnitude& simulatedTime, const std::string& partialId );
 
 	void VerboseStartMagnitudeAnalysis(
-		std::vector<double>::iterator& itGoldenTime, std::vector<double>::iterator& itSimulatedTime,
-		std::vector<double>::iterator& itGoldenMetric, std::vector<double>::iterator& itSimulatedMetric,
+		const double*& itGoldenTime, const double*& itSimulatedTime,
+		const double*& itGoldenMetric, const double*& itSimulatedMetric,
 		const Magnitude& simulatedMetric );
 
 	void VerboseReliabilityError( const std::string& errorType,
 		TransientSimulationResults& transientSimulationResults, const std::string& partialId,
 		const std::string& magName, const double& currentTime, const double& currentMetricError,
 		const double& currentSimulatedValue, const double& currentGoldenValue, const double& backSimulatedValue, const double& backGoldenValue,
-		std::vector<double>::iterator& itSimulatedMetric, std::vector<double>::iterator& itGoldenMetric );
+		const double*& itSimulatedMetric, const double*& itGoldenMetric );
 };
 
 #endif /* SPECTRE_SIMULATION_H */
@@ -51,7 +51,6 @@ void StandardSimulation::RunSimulation( ){
 		return;
 	}
 	// Environment variables
-	ConfigureEnvironmentVariables();
 	ShowEnvironmentVariables();
 	basic_simulation_results.set_spectre_result( RunSpectre( simulation_id ) );
 	if( correctly_simulated && process_metrics ){
@@ -143,7 +142,7 @@ std::string StandardSimulation::GetProcessedResultsFilePath(const std::string& c
 	if( is_montecarlo_nested_simulation ){
 		return top_folder + kFolderSeparator + kResultsFolder + kFolderSeparator
 		+ kResultsDataFolder + kFolderSeparator + kTransientResultsFolder + kFolderSeparator
-		+ kProcessedPrefix + simulation_id + "_m_" + montecarlo_transient_sufix + kDataSufix;
+		+ kProcessedPrefix + simulation_id + "_m_" + montecarlo_transient_sufix + GetProcessedDataSufix();
 	}else{
 		std::string analysisFinalName = main_analysis->get_name();
 		if( processMainTransient ){
@@ -151,22 +150,16 @@ std::string StandardSimulation::GetProcessedResultsFilePath(const std::string& c
 		}
 		return top_folder + kFolderSeparator + kResultsFolder + kFolderSeparator + kResultsDataFolder
 			+ kFolderSeparator + kTransientResultsFolder + kFolderSeparator
-			+ localSimulationId + "_" + kProcessedTransientFile;
+			+ localSimulationId + "_" + GetProcessedTransientFile();
 	}
 }
 
 int StandardSimulation::RunSpectre( const std::string& scenarioId ){
-	std::string execCommand = spectre_command + " "
-		+ spectre_command_log_arg + " " + folder + kFolderSeparator + kSpectreLogFile + " "
-		+ spectre_command_folder_arg + " " + folder + kFolderSeparator + kSpectreResultsFolder + " "
-		+ folder + kFolderSeparator + kMainNetlistFile
-		+ " " + post_spectre_command + " " + folder + kFolderSeparator + kSpectreStandardLogsFile ;
-
 	#ifdef SPECTRE_SIMULATIONS_VERBOSE
 		log_io->ReportPlainStandard( k2Tab + "#" + scenarioId + " scenario: Simulating scenario." );
 	#endif
 
-	int spectre_result = std::system( execCommand.c_str() ) ;
+	int spectre_result = ExecuteSpectre( folder, &basic_simulation_results );
 	if(spectre_result>0){
 		correctly_simulated = false;
 		log_io->ReportError2AllLogs( "Unexpected Spectre spectre_result for scenario #"
@@ -11,6 +11,8 @@
  *
  */
 
+// Boost includes
+#include <boost/bind.hpp>
 // Radiation simulator includes
 #include "circuit_radiator.hpp"
 
@@ -25,12 +27,18 @@
 CircuitRadiator::CircuitRadiator() {
 	radiationSubcircuitsCircuit.set_name( kAlterationSourcesCircuitStringId );
 	radiationSubcircuitsCircuitAHDL.set_name( "radiationSubcircuitsCircuitAHDL" );
+	this->scenarios_exported = true;
 }
 
 CircuitRadiator::~CircuitRadiator() {
 	#ifdef DESTRUCTORS_VERBOSE
 		log_io->ReportPlain2Log( "CircuitRadiator Destructor. Direction: " + number2String(this) );
 	#endif
+	// Scenarios not exported
+	for( auto const& alteredScenario : altered_scenarios ){
+		delete alteredScenario->altered_statements_circuit;
+		delete alteredScenario;
+	}
 }
 
 bool CircuitRadiator::SetUpSingularScenarios( std::string goldenFolder,
@@ -106,7 +114,18 @@ bool CircuitRadiator::RadiateMainCircuit( ){
 	bool success = true;
 	// Radiate main_circuit
 	int modificationCounter = 0;
+	// Radiation and non-altered netlists, staged in every altered scenario
+	std::string sharedNetlistsFolder = top_folder + kFolderSeparator + kSharedScenarioNetlistsFolder;
+	if( !CreateFolder( sharedNetlistsFolder, false ) ){
+		log_io->ReportError2AllLogs( k2Tab + "-> Error creating folder '" + sharedNetlistsFolder + "'." );
+		return false;
+	}
+	success = success && circuit_io_handler->ExportSharedScenarioNetlists(
+		radiationSubcircuitsCircuit, *main_circuit, sharedNetlistsFolder );
+	// Enumerate the altered scenarios
 	success = success && RadiateCircuit( *main_circuit, modificationCounter );
+	// and export them
+	success = success && ExportAlteredScenarios();
 	return success;
 }
 
@@ -187,42 +206,28 @@ bool CircuitRadiator::AnalyzeStatementForReplacement( Statement& statement, int&
 
 bool CircuitRadiator::SubstituteSimpleStatement( Statement& statement,
 	int& modificationCounter ){
-	bool success = true;
-	std::string alteredFolder = GetRadiatedFolderName( modificationCounter );
-	if( !CreateFolder( alteredFolder, false ) ){
-		log_io->ReportError2AllLogs( k2Tab + "-> Error creating folder '" + alteredFolder + "'." );
-		return false;
-	}
-	// Copy of the circuit to be altered
-	CircuitStatement* localAlteredCircuit = new CircuitStatement(
-		*(CircuitStatement*) statement.get_belonging_circuit() ) ;
-	// Altered statement
-	Statement* alteredStatement;
-	if( !localAlteredCircuit->GetChildById( statement.get_id(), alteredStatement ) ){
-		log_io->ReportError2AllLogs( k3Tab + "Error altering. Error finding statement with id '"
-			+ number2String( statement.get_id() ) + "'");
-			return false;
-	}
-	alteredStatement->set_master_name( alteredStatement->get_substitute_master_name() );
+	AlteredScenario* alteredScenario = new AlteredScenario();
+	alteredScenario->type = kSimpleStatementSubstitution;
+	alteredScenario->id = modificationCounter;
+	alteredScenario->folder = GetRadiatedFolderName( modificationCounter );
+	alteredScenario->node = nullptr;
+	alteredScenario->statement = &statement;
+	alteredScenario->altered_statements_circuit = nullptr;
+	alteredScenario->path_inject = statement.get_name();
+	altered_scenarios.push_back( alteredScenario );
 	// Report substitution
 	#ifdef RADIATION_VERBOSE
-		log_io->ReportSubstitution( false, alteredStatement->get_substitute_master_name(), statement.get_name(),
+		log_io->ReportSubstitution( false, statement.get_substitute_master_name(), statement.get_name(),
 			statement.get_belonging_scope()->get_name(), statement.get_parent()->get_name(),
 			number2String(statement.get_parent()->get_id()), number2String( modificationCounter ));
 	#endif
-
-	// Export netlists
-	log_io->ExportReadmeStandardSubstitution( statement.get_name(),
-		statement.get_master_name(), statement.get_name(), alteredStatement->get_master_name(), alteredFolder );
-	circuit_io_handler->ExportSimpleAlteredScenario( radiationSubcircuitsCircuit,
-		*localAlteredCircuit, *main_circuit, alteredFolder );
-	radiation_spectre_handler->AddScenarioFolderPath( modificationCounter, alteredFolder, statement.get_name() );
-
-	// deletes both alteredStatementsCircuit and alteredSubcircuitParent,
-	delete localAlteredCircuit;
+	std::string signature = GetStructuralSignature( statement );
+	radiation_spectre_handler->AddScenarioFolderPath( modificationCounter,
+		alteredScenario->folder, alteredScenario->path_inject,
+		signature.empty() ? "" : "substitution:" + signature + "->" + statement.get_substitute_master_name() );
 	statement.set_altered( true );
 	modificationCounter++;
-	return success;
+	return true;
 }
 
 bool CircuitRadiator::SubstituteSubcircuitChild( Statement& childOfSubcircuitStatement,
@@ -256,12 +261,15 @@ bool CircuitRadiator::SubstituteSubcircuitChild( Statement& childOfSubcircuitSta
 	#endif
 	std::string deepLevel = "Substituted " + childOfSubcircuitStatement.get_name();
 	std::string path2BelongingCircuit = childOfSubcircuitStatement.get_name();
+	std::string signature = GetStructuralSignature( childOfSubcircuitStatement );
 	success = success && ReplaceAlteredSubcircuitInstances( deepLevel,
 		alteredStatement->get_substitute_master_name(), *alteredStatementsCircuit,
 		*( SubcircuitStatement*) childOfSubcircuitStatement.get_global_scope_parent(),
 		*alteredSubcircuitParent, modificationCounter,  childOfSubcircuitStatement.get_name(),
 		childOfSubcircuitStatement.get_master_name(), path2BelongingCircuit,
-		childOfSubcircuitStatement.get_belonging_scope()->get_name());
+		childOfSubcircuitStatement.get_belonging_scope()->get_name(),
+		signature.empty() ? "" : "substitution:" + childOfSubcircuitStatement.get_global_scope_parent()->get_name()
+			+ ":" + signature + "->" + alteredStatement->get_substitute_master_name() );
 	// deletes both alteredStatementsCircuit and alteredSubcircuitParent,
 	delete alteredStatementsCircuit;
 	childOfSubcircuitStatement.set_altered( true );
@@ -393,11 +401,14 @@ bool CircuitRadiator::InjectNodeOfSubcircuitChild( Node& node,
 			number2String(childOfSubcircuitStatement.get_parent()->get_id()), number2String( modificationCounter ));
 	#endif
 	std::string deepLevel = "injecting " + childOfSubcircuitStatement.get_name()  + " Node: " + node.get_name() ;
+	// the injected net is the same whatever the statement it is reached from
+	std::string structuralKey = radiation_spectre_handler->get_deduplicate_equivalent_scenarios()
+		? "injection:" + childOfSubcircuitStatement.get_global_scope_parent()->get_name() + ":" + node.get_name() : "";
 	success = success && ReplaceAlteredSubcircuitInstances( deepLevel, node.get_name(),
 		*alteredStatementsCircuit, *( SubcircuitStatement*) childOfSubcircuitStatement.get_global_scope_parent(),
 		*alteredSubcircuitParent, modificationCounter,  childOfSubcircuitStatement.get_name(),
 		childOfSubcircuitStatement.get_master_name(), path2BelongingCircuit,
-		childOfSubcircuitStatement.get_belonging_scope()->get_name());
+		childOfSubcircuitStatement.get_belonging_scope()->get_name(), structuralKey );
 	// deletes both alteredStatementsCircuit and alteredSubcircuitParent,
 	// therefore also injectorSource
 	delete alteredStatementsCircuit;
@@ -407,37 +418,23 @@ bool CircuitRadiator::InjectNodeOfSubcircuitChild( Node& node,
 
 // Standard injection, for nodes outside subcircuits
 bool CircuitRadiator::InjectSimpleNode( Node& node, InstanceStatement& statement, int& modificationCounter ){
-	bool success = true;
-	std::string alteredFolder = GetRadiatedFolderName( modificationCounter );
-	if( !CreateFolder( alteredFolder, false ) ){
-		log_io->ReportError2AllLogs( k2Tab + "-> Error creating folder '" + alteredFolder + "'." );
-		return false;
+	AlteredScenario* alteredScenario = new AlteredScenario();
+	alteredScenario->type = kSimpleNodeInjection;
+	alteredScenario->id = modificationCounter;
+	alteredScenario->folder = GetRadiatedFolderName( modificationCounter );
+	alteredScenario->node = &node;
+	alteredScenario->statement = &statement;
+	alteredScenario->altered_statements_circuit = nullptr;
+	alteredScenario->path_inject = statement.get_name() + ":" + node.get_name();
+	altered_scenarios.push_back( alteredScenario );
+	// the injected net is the same whatever the statement it is reached from
+	std::string structuralKey;
+	if( radiation_spectre_handler->get_deduplicate_equivalent_scenarios() ){
+		structuralKey = "injection:" + number2String( ((CircuitStatement*) statement.get_belonging_circuit())->get_circuit_id() )
+			+ ":" + number2String( statement.get_parent()->get_id() ) + ":" + node.get_name();
 	}
-	// Copy of the circuit to be altered
-	CircuitStatement* localAlteredCircuit = new CircuitStatement( *(CircuitStatement*) statement.get_belonging_circuit() ) ;
-	if( localAlteredCircuit==nullptr ){
-		log_io->ReportError2AllLogs( "null localAlteredCircuit in InjectSimpleNode, for statement " + statement.get_name() );
-	}
-	// Include statement reference
-	localAlteredCircuit->AddIncludeStatementAndRegister( GetNewIncludeStatementOfRadiationCircuit() );
-	// Injector instance
-	InstanceStatement* injectorSource = GetNewInjectorInstance( node, kAlterationInjectorName );
-	// Add radiation source to parent (if not a subcircuit)
-	success = success && AddRadiationSourceInstance2Parent( statement, *localAlteredCircuit, *injectorSource);
-	// now update path 2 belonging circuit
-	post_parsing_statement_handler->FindPath2BelongingCircuit( injectorSource );
-	// Injector monitoring
-	if( radiation_spectre_handler->get_save_injection_sources() && simulation_mode->get_alteration_mode()->get_injection_mode() ){
-		localAlteredCircuit->AddStatement( GetNewSaveInjectionStatement( "" ) );
-	}
-	// Export netlists
-	log_io->ExportReadmeStandardInjection( statement.get_name() + ":" + node.get_name(),
-		statement.get_master_name(), statement.get_name(),
-		statement.get_belonging_scope()->get_name(), node.get_name(), alteredFolder );
-	circuit_io_handler->ExportSimpleAlteredScenario( radiationSubcircuitsCircuit,
-		*localAlteredCircuit, *main_circuit, alteredFolder );
-	radiation_spectre_handler->AddScenarioFolderPath( modificationCounter, alteredFolder, statement.get_name() + ":" + node.get_name() );
-	// Delete modified and radiantion source subcircuit circuits
+	radiation_spectre_handler->AddScenarioFolderPath( modificationCounter,
+		alteredScenario->folder, alteredScenario->path_inject, structuralKey );
 	#ifdef RADIATION_VERBOSE
 		log_io->ReportNodeInjection( false, node.get_name(), statement.get_name(),
 			statement.get_belonging_scope()->get_name(), statement.get_parent()->get_name(),
@@ -446,22 +443,166 @@ bool CircuitRadiator::InjectSimpleNode( Node& node, InstanceStatement& statement
 	// Mark node and update modification counter
 	node.set_injected( true );
 	++modificationCounter;
-	delete localAlteredCircuit;
 	return true;
 }
 
+////////////////////////
+// Scenarios Exporting //
+////////////////////////
+
+bool CircuitRadiator::ExportAlteredScenarios(){
+	log_io->ReportPlainStandard( k2Tab + "Exporting " + number2String( altered_scenarios.size() ) + " altered scenarios" );
+	scenarios_exported = true;
+	scenarios_thread_pool.set_log_io( log_io );
+	SimulationsTaskGroup tg( &scenarios_thread_pool, scenarios_thread_pool.get_max_parallel_instances() );
+	for( auto const& alteredScenario : altered_scenarios ){
+		tg.Run( boost::bind( &CircuitRadiator::ExportAlteredScenarioTask, this, alteredScenario ) );
+	}
+	tg.Wait();
+	// Delete the circuit copies and the scenarios
+	for( auto const& circuitCopies : free_circuit_copies ){
+		for( auto const& circuitCopy : *circuitCopies ){
+			delete circuitCopy.second;
+		}
+		delete circuitCopies;
+	}
+	free_circuit_copies.clear();
+	for( auto const& alteredScenario : altered_scenarios ){
+		delete alteredScenario;
+	}
+	altered_scenarios.clear();
+	return scenarios_exported;
+}
+
+void CircuitRadiator::ExportAlteredScenarioTask( AlteredScenario* alteredScenario ){
+	CircuitCopies* circuitCopies;
+	{
+		boost::mutex::scoped_lock lock( scenarios_mutex );
+		if( free_circuit_copies.empty() ){
+			circuitCopies = new CircuitCopies();
+		}else{
+			circuitCopies = free_circuit_copies.back();
+			free_circuit_copies.pop_back();
+		}
+	}
+	bool success = ExportAlteredScenario( *alteredScenario, *circuitCopies );
+	delete alteredScenario->altered_statements_circuit;
+	alteredScenario->altered_statements_circuit = nullptr;
+	// the copies are reused by the following tasks
+	boost::mutex::scoped_lock lock( scenarios_mutex );
+	free_circuit_copies.push_back( circuitCopies );
+	scenarios_exported = scenarios_exported && success;
+}
+
+CircuitStatement& CircuitRadiator::GetCircuitCopy( CircuitCopies& circuitCopies, CircuitStatement& circuit ){
+	auto it_c = circuitCopies.find( &circuit );
+	if( it_c == circuitCopies.end() ){
+		it_c = circuitCopies.emplace( &circuit, new CircuitStatement( circuit ) ).first;
+	}
+	return *it_c->second;
+}
+
+bool CircuitRadiator::ExportAlteredScenario( AlteredScenario& alteredScenario, CircuitCopies& circuitCopies ){
+	if( !CreateFolder( alteredScenario.folder, false ) ){
+		log_io->ReportError2AllLogs( k2Tab + "-> Error creating folder '" + alteredScenario.folder + "'." );
+		return false;
+	}
+	Statement& statement = *alteredScenario.statement;
+	// Alteration of the circuit copy, reverted once exported
+	CircuitOverlay circuitOverlay( GetCircuitCopy( circuitCopies,
+		*(CircuitStatement*) statement.get_belonging_circuit() ) );
+	CircuitStatement& alteredCircuit = circuitOverlay.get_circuit();
+	bool success = true;
+	switch( alteredScenario.type ){
+		case kSimpleNodeInjection: {
+			Node& node = *alteredScenario.node;
+			// Include statement reference
+			circuitOverlay.AddIncludeStatement( GetNewIncludeStatementOfRadiationCircuit() );
+			// Injector instance
+			InstanceStatement* injectorSource = GetNewInjectorInstance( node, kAlterationInjectorName );
+			// Add radiation source to parent (if not a subcircuit)
+			if( !AddRadiationSourceInstance2Parent( statement, circuitOverlay, *injectorSource) ){
+				delete injectorSource;
+				return false;
+			}
+			// now update path 2 belonging circuit
+			post_parsing_statement_handler->FindPath2BelongingCircuit( injectorSource );
+			// Injector monitoring
+			if( radiation_spectre_handler->get_save_injection_sources() && simulation_mode->get_alteration_mode()->get_injection_mode() ){
+				circuitOverlay.AddStatement( alteredCircuit, GetNewSaveInjectionStatement( "" ) );
+			}
+			// Export netlists
+			log_io->ExportReadmeStandardInjection( alteredScenario.path_inject,
+				statement.get_master_name(), statement.get_name(),
+				statement.get_belonging_scope()->get_name(), node.get_name(), alteredScenario.folder );
+			success = circuit_io_handler->ExportSimpleAlteredScenario( radiationSubcircuitsCircuit,
+				alteredCircuit, *main_circuit, alteredScenario.folder );
+			break;
+		}
+		case kSimpleStatementSubstitution: {
+			// Altered statement
+			Statement* alteredStatement;
+			if( !alteredCircuit.GetChildById( statement.get_id(), alteredStatement ) ){
+				log_io->ReportError2AllLogs( k3Tab + "Error altering. Error finding statement with id '"
+					+ number2String( statement.get_id() ) + "'");
+				return false;
+			}
+			circuitOverlay.SetMasterName( *alteredStatement, alteredStatement->get_substitute_master_name() );
+			// Export netlists
+			log_io->ExportReadmeStandardSubstitution( statement.get_name(),
+				statement.get_master_name(), statement.get_name(), alteredStatement->get_master_name(),
+				alteredScenario.folder );
+			success = circuit_io_handler->ExportSimpleAlteredScenario( radiationSubcircuitsCircuit,
+				alteredCircuit, *main_circuit, alteredScenario.folder );
+			break;
+		}
+		case kSubcircuitInstanceReplacement: {
+			Statement* alteredInstance;
+			if( !alteredCircuit.GetChildById( statement.get_id(), alteredInstance ) ){
+				log_io->ReportError2AllLogs( k3Tab + "Error altering. Error finding statement with id '"
+					+ number2String( statement.get_id() ) + "'");
+				return false;
+			}
+			circuitOverlay.SetMasterName( *alteredInstance, alteredInstance->get_master_name() + kRadiatedSufix );
+			// Include the reference of the radiation circuit
+			// In the altered one.
+			circuitOverlay.AddIncludeStatement( GetNewIncludeStatementOfRadiationCircuit( ) );
+			circuitOverlay.AddIncludeStatement( GetNewIncludeStatementOfAlteredStatementsCircuit( ) );
+			// monitor
+			if( radiation_spectre_handler->get_save_injection_sources() && simulation_mode->get_alteration_mode()->get_injection_mode() ){
+				circuitOverlay.AddStatement( alteredCircuit,
+					GetNewSaveInjectionStatement( statement.get_name() + "." ) );
+			}
+			// Export readme
+			log_io->ExportReadmeInstanceOfSubcircuitReplacement(
+				alteredScenario.path_inject, simulation_mode->get_alteration_mode()->get_injection_mode(),
+				alteredScenario.deep_level, alteredScenario.altered_parameter_name, statement.get_name(),
+				number2String(alteredScenario.id), alteredScenario.original_subcircuit_name,
+				alteredScenario.altered_subcircuit_name, alteredCircuit.get_name(), alteredScenario.folder,
+				alteredScenario.altered_statement_name, alteredScenario.altered_statement_master_name,
+				alteredScenario.altered_scope_name );
+			// Export netlists
+			success = circuit_io_handler->ExportAlteredScenario( radiationSubcircuitsCircuit, alteredCircuit,
+				*alteredScenario.altered_statements_circuit, *main_circuit, alteredScenario.folder );
+			break;
+		}
+	}
+	circuitOverlay.Revert();
+	return success;
+}
+
 bool CircuitRadiator::AddRadiationSourceInstance2Parent(Statement& statement,
-	CircuitStatement& modifiedCircuit, InstanceStatement& injectorSource){
+	CircuitOverlay& circuitOverlay, InstanceStatement& injectorSource){
 	if( statement.get_statement_type() == kCircuitStatement ){
-		modifiedCircuit.AddStatement( &injectorSource );
+		circuitOverlay.AddStatement( circuitOverlay.get_circuit(), &injectorSource );
 	}else{
 		Statement* parent = NULL;
-		if(!modifiedCircuit.GetChildById(statement.get_parent()->get_id(), parent) ){
+		if(!circuitOverlay.get_circuit().GetChildById(statement.get_parent()->get_id(), parent) ){
 			log_io->ReportError2AllLogs( k3Tab + "Error altering. Error finding parent of '"
 				+ number2String( statement.get_id() ) + "in order to inject " + injectorSource.get_master_name() +"'");
 			return false;
 		}else{
-			parent->AddStatement( &injectorSource );
+			circuitOverlay.AddStatement( *parent, &injectorSource );
 		}
 	}
 	return true;
@@ -475,7 +616,8 @@ bool CircuitRadiator::ReplaceAlteredSubcircuitInstances( std::string& deepLevel,
 	CircuitStatement& alteredStatementsCircuit,
 	SubcircuitStatement& originalSubcircuit, SubcircuitStatement& alteredSubcircuit, int& modificationCounter,
 	std::string alteredStatementName, std::string alteredStatementMasterName,
-	std::string& alteredStatementPathToBelongingCircuit, std::string alteredScopeName ){
+	std::string& alteredStatementPathToBelongingCircuit, std::string alteredScopeName,
+	std::string structuralKey ){
 	bool success = true;
 	deepLevel += " || Changing '" + originalSubcircuit.get_name() + "'' -> '"
 		+ alteredSubcircuit.get_name() + "'";
@@ -484,7 +626,8 @@ bool CircuitRadiator::ReplaceAlteredSubcircuitInstances( std::string& deepLevel,
 			success = success && ReplaceAlteredSubcircuitInstance(deepLevel,
 				alteredParameterName, alteredStatementsCircuit,
 				*instanceStatement, originalSubcircuit, alteredSubcircuit, modificationCounter, alteredStatementName,
-				alteredStatementMasterName, alteredStatementPathToBelongingCircuit, alteredScopeName );
+				alteredStatementMasterName, alteredStatementPathToBelongingCircuit, alteredScopeName,
+				structuralKey );
 		}
 	}
 	return success;
@@ -494,8 +637,14 @@ bool CircuitRadiator::ReplaceAlteredSubcircuitInstance(std::string& deepLevel, s
 	CircuitStatement& alteredStatementsCircuit, InstanceStatement& instanceOfSubcircuit,
 	SubcircuitStatement& originalSubcircuit, SubcircuitStatement& alteredSubcircuit,
 	int& modificationCounter, std::string alteredStatementName, std::string alteredStatementMasterName,
-	std::string alteredStatementPathToBelongingCircuit, std::string alteredScopeName ){
+	std::string alteredStatementPathToBelongingCircuit, std::string alteredScopeName,
+	std::string structuralKey ){
 	bool success = true;
+	// Replaced instance, prepended to the key of the alteration inside its subcircuit
+	if( !structuralKey.empty() ){
+		std::string signature = GetStructuralSignature( instanceOfSubcircuit );
+		structuralKey = signature.empty() ? "" : signature + "/" + structuralKey;
+	}
 	// Alterations made to a 'local' altered circuit,
 	// in order to preserve the original alteredStatementsCircuit for recursive calls
 	CircuitStatement* localAlteredStatementsCircuit = new CircuitStatement( alteredStatementsCircuit );
@@ -554,65 +703,41 @@ bool CircuitRadiator::ReplaceAlteredSubcircuitInstance(std::string& deepLevel, s
 		success = success && ReplaceAlteredSubcircuitInstances(localDeepLevel, alteredParameterName,
 			*localAlteredStatementsCircuit, *originalSubcircuitParent, *alteredSubcircuitParent,
 			modificationCounter, alteredStatementName, alteredStatementMasterName,
-			localAlteredStatementPathToBelongingCircuit, alteredScopeName );
+			localAlteredStatementPathToBelongingCircuit, alteredScopeName, structuralKey );
 	} else {
-		// Alterations made to a 'local' altered instance,
-		CircuitStatement* localInstanceOfSubcircuitAlteredCircuit = new CircuitStatement(
-			*(CircuitStatement*) instanceOfSubcircuit.get_belonging_circuit() );
-
-		Statement* alteredInstance;
-		if( !localInstanceOfSubcircuitAlteredCircuit->GetChildById( instanceOfSubcircuit.get_id(), alteredInstance ) ){
-			log_io->ReportError2AllLogs( k3Tab + "Error altering. Error finding statement with id '"
-				+ number2String( instanceOfSubcircuit.get_id() ) + "'");
-				return false;
-		}
-		alteredInstance->set_master_name( alteredInstance->get_master_name() + kRadiatedSufix );
-		// Include the reference of the radiation circuit
-		// In the altered one.
-		localInstanceOfSubcircuitAlteredCircuit->AddIncludeStatementAndRegister( GetNewIncludeStatementOfRadiationCircuit( ) );
-		localInstanceOfSubcircuitAlteredCircuit->AddIncludeStatementAndRegister( GetNewIncludeStatementOfAlteredStatementsCircuit( ) );
-		// monitor
-		if( radiation_spectre_handler->get_save_injection_sources() && simulation_mode->get_alteration_mode()->get_injection_mode() ){
-			localInstanceOfSubcircuitAlteredCircuit->AddStatement( GetNewSaveInjectionStatement( instanceOfSubcircuit.get_name() + "." ) );
-		}
-		// Export netlists
-		std::string alteredFolder = GetRadiatedFolderName( modificationCounter );
-		if( !CreateFolder( alteredFolder, false ) ){
-			log_io->ReportError2AllLogs( k2Tab + "-> Error creating folder '" + alteredFolder + "'." );
-			return false;
-		}
-		std::string pathInject = alteredInstance->get_name() + "." + alteredStatementPathToBelongingCircuit;
+		std::string pathInject = instanceOfSubcircuit.get_name() + "." + alteredStatementPathToBelongingCircuit;
 		if ( simulation_mode->get_alteration_mode()->get_injection_mode() ){
 			pathInject += ":" + alteredParameterName;
 		}
-    // Export readme
-		log_io->ExportReadmeInstanceOfSubcircuitReplacement(
-			pathInject, simulation_mode->get_alteration_mode()->get_injection_mode(), localDeepLevel,
-			alteredParameterName, instanceOfSubcircuit.get_name(), number2String(modificationCounter),
-			originalSubcircuit.get_name(), alteredSubcircuit.get_name(),
-			localInstanceOfSubcircuitAlteredCircuit->get_name(), alteredFolder,
-			alteredStatementName, alteredStatementMasterName, alteredScopeName );
-    // log
+		AlteredScenario* alteredScenario = new AlteredScenario();
+		alteredScenario->type = kSubcircuitInstanceReplacement;
+		alteredScenario->id = modificationCounter;
+		alteredScenario->folder = GetRadiatedFolderName( modificationCounter );
+		alteredScenario->node = nullptr;
+		alteredScenario->statement = &instanceOfSubcircuit;
+		// The scenario owns the altered statements
+		alteredScenario->altered_statements_circuit = localAlteredStatementsCircuit;
+		localAlteredStatementsCircuit = nullptr;
+		alteredScenario->path_inject = pathInject;
+		alteredScenario->deep_level = localDeepLevel;
+		alteredScenario->altered_parameter_name = alteredParameterName;
+		alteredScenario->original_subcircuit_name = originalSubcircuit.get_name();
+		alteredScenario->altered_subcircuit_name = alteredSubcircuit.get_name();
+		alteredScenario->altered_statement_name = alteredStatementName;
+		alteredScenario->altered_statement_master_name = alteredStatementMasterName;
+		alteredScenario->altered_scope_name = alteredScopeName;
+		altered_scenarios.push_back( alteredScenario );
+		// log
 		#ifdef RADIATION_VERBOSE
 			log_io->ReportInstanceOfSubcircuitReplacement(
 				simulation_mode->get_alteration_mode()->get_injection_mode(), localDeepLevel,
 				instanceOfSubcircuit.get_name(), alteredParameterName, number2String(modificationCounter),
 				originalSubcircuit.get_name(), alteredSubcircuit.get_name(),
-				localInstanceOfSubcircuitAlteredCircuit->get_name(), alteredFolder,
+				instanceOfSubcircuit.get_belonging_circuit()->get_name(), alteredScenario->folder,
 				alteredStatementName, alteredStatementMasterName, alteredScopeName );
 		#endif
-		// fgarcia: everything is alright till here
-// log_io->ReportGreenStandard("[debug] localInstanceOfSubcircuitAlteredCircuit " + localInstanceOfSubcircuitAlteredCircuit->get_name() );
-// log_io->ReportGreenStandard("[debug] instanceOfSubcircuit " + instanceOfSubcircuit.get_name() );
-// log_io->ReportGreenStandard("[debug] instanceOfSubcircuit.get_belonging_circuit() " + instanceOfSubcircuit.get_belonging_circuit()->get_name() );
-// log_io->ReportGreenStandard("[debug] alteredInstance " + alteredInstance->get_name() + " mastername:" + alteredInstance->get_master_name() );
-// log_io->ReportGreenStandard("[debug] export " + localInstanceOfSubcircuitAlteredCircuit->ExportCircuitStatement(""));
-		circuit_io_handler->ExportAlteredScenario( radiationSubcircuitsCircuit, *localInstanceOfSubcircuitAlteredCircuit,
-			*localAlteredStatementsCircuit, *main_circuit, alteredFolder );
-		radiation_spectre_handler->AddScenarioFolderPath( modificationCounter, alteredFolder, pathInject );
-		// Remove the alteredSubcircuit, allowing the localAlteredCircuit destruction
-		localInstanceOfSubcircuitAlteredCircuit->RemoveStatement( &alteredSubcircuit );
-		delete localInstanceOfSubcircuitAlteredCircuit;
+		radiation_spectre_handler->AddScenarioFolderPath( modificationCounter, alteredScenario->folder, pathInject,
+			structuralKey.empty() ? "" : "replacement:" + structuralKey );
 		modificationCounter++;
 	}
 	// Delete localAlteredStatementsCircuit
@@ -621,6 +746,26 @@ bool CircuitRadiator::ReplaceAlteredSubcircuitInstance(std::string& deepLevel, s
 	return success;
 }
 
+std::string CircuitRadiator::GetStructuralSignature( Statement& statement ){
+	if( !radiation_spectre_handler->get_deduplicate_equivalent_scenarios()
+		|| radiation_spectre_handler->IsReferencedByMetrics( statement.get_name() ) ){
+		return "";
+	}
+	std::string signature = number2String( statement.get_statement_type() ) + ":" + statement.get_master_name() + "(";
+	for( auto const & n : *statement.get_nodes() ){
+		signature += n->get_name() + " ";
+	}
+	signature += ")";
+	for( auto const & p : *statement.get_parameters() ){
+		signature += p->get_name() + "=" + p->get_value() + " ";
+	}
+	signature += "@" + number2String( statement.get_parent()->get_id() );
+	if( statement.get_belonging_circuit()!=nullptr ){
+		signature += "@" + number2String( ((CircuitStatement*) statement.get_belonging_circuit())->get_circuit_id() );
+	}
+	return signature;
+}
+
 void CircuitRadiator::CreateRadiationAndAHDLCircuits(){
 	// Circuit including the radiation source subcircuit
 	// And the altered subcircuit
@@ -3,6 +3,12 @@
  *
  *  Created on: Jan 23, 2014
  *  Author: fernando
+ *
+ * The circuit is radiated in two phases:
+ * 		+ The circuit tree is walked sequentially, enumerating the altered
+ * 		scenarios, whose ids (folders) are assigned in the walk order.
+ * 		+ The scenarios are materialized and exported concurrently, each task
+ * 		altering private copies of the circuits (the parsed tree is not modified).
  */
 
 
@@ -12,6 +18,10 @@
 ///CircuitRadiator Class
 // c++ std libraries
 #include <string> 
+#include <map>
+#include <vector>
+// Boost
+#include <boost/thread/mutex.hpp>
 
 // Spectre Handler Library
 #include "experiment_environment.hpp"
@@ -22,9 +32,11 @@
 // Simulations handler
 #include "simulations_handling/simulation_mode.hpp" 
 #include "simulations_handling/spectre_handlers/radiation_spectre_handler.hpp"
+#include "simulations_handling/simulations_thread_pool.hpp"
 // Netlist modeling
 #include "netlist_modeling/statements/statement.hpp"
 #include "netlist_modeling/statements/circuit_statement.hpp"
+#include "netlist_modeling/circuit_overlay.hpp"
  
 class CircuitRadiator {
 
@@ -101,6 +113,47 @@ private:
 	/// ahdl radiation subcircuits circuit
 	CircuitStatement radiationSubcircuitsCircuitAHDL;
 
+	/// Alteration of an altered scenario
+	enum AlteredScenarioType { kSimpleNodeInjection, kSimpleStatementSubstitution,
+		kSubcircuitInstanceReplacement };
+
+	/// Altered scenario enumerated while analyzing the circuit, exported afterwards
+	struct AlteredScenario {
+		AlteredScenarioType type;
+		/// Scenario id (modification counter)
+		int id;
+		std::string folder;
+		/// Injected node (injection)
+		Node* node;
+		/// Altered statement, or replaced instance of the altered subcircuit
+		Statement* statement;
+		/// Altered subcircuits and (analog) models of the replacement, owned by the scenario
+		CircuitStatement* altered_statements_circuit;
+		// Report
+		std::string path_inject;
+		std::string deep_level;
+		std::string altered_parameter_name;
+		std::string original_subcircuit_name;
+		std::string altered_subcircuit_name;
+		std::string altered_statement_name;
+		std::string altered_statement_master_name;
+		std::string altered_scope_name;
+	};
+
+	/// Private copies of the parsed circuits (original -> copy) altered by an export task
+	typedef std::map<CircuitStatement*, CircuitStatement*> CircuitCopies;
+
+	/// Altered scenarios, in id order
+	std::vector<AlteredScenario*> altered_scenarios;
+	/// Pool exporting the altered scenarios
+	SimulationsThreadPool scenarios_thread_pool;
+	/// Protects free_circuit_copies and scenarios_exported
+	boost::mutex scenarios_mutex;
+	/// Circuit copies not in use by any export task
+	std::vector<CircuitCopies*> free_circuit_copies;
+	/// All the altered scenarios have been correctly exported
+	bool scenarios_exported;
+
 	/**
  	* @details Radiates a circuit
  	* @param circuit <CircuitStatement&> Golden netlist folder
@@ -135,7 +188,7 @@ private:
 	
 	/**
  	* @details Injects a particular node of a statement which is NOT
-	* a child of an (inline) subcircuit 
+	* a child of an (inline) subcircuit (the scenario is enumerated, exported afterwards)
  	* @param node <Node&> Injected node
  	* @param statement <InstanceStatement&> Golden netlist folder
  	* @param modificationCounter <int> Modification(injections/substitutions) counter. 
@@ -169,7 +222,7 @@ private:
 
 	/**
  	* @details Replaces a statement which is not a subcircuit child.
- 	* 
+ 	* (the scenario is enumerated, exported afterwards)
  	* @param statement <Statement&> Replaced statement.
  	* @param modificationCounter <int> Modification(injections/substitutions) counter. 
  	* @return true if the method correctly ends.
@@ -192,16 +245,19 @@ private:
  	* @param alteredStatementMasterName <std::string> Altered statement Master Name name  [Needed for report]
  	* @param alteredStatementPathToBelongingCircuit <std::string> Altered path to circuit [Needed for report]
  	* @param alteredScopeName <std::string> Altered scope Master Name name  [Needed for report]
+ 	* @param structuralKey <std::string> Structural key of the alteration inside the subcircuit (empty: not comparable)
  	* @return true if the method correctly ends.
  	*/
 	bool ReplaceAlteredSubcircuitInstances( std::string& deepLevel, std::string alteredParameterName,
 		CircuitStatement& alteredStatementsCircuit,
 		SubcircuitStatement& originalSubcircuit, SubcircuitStatement& alteredSubcircuit, int& modificationCounter,
 		std::string alteredStatementName, std::string alteredStatementMasterName,
-		std::string& alteredStatementPathToBelongingCircuit, std::string alteredScopeName );
+		std::string& alteredStatementPathToBelongingCircuit, std::string alteredScopeName,
+		std::string structuralKey );
 
 	/**
  	* @details Replaces an instance of an altered subcircuit.
+ 	* Instances outside subcircuits are enumerated as scenarios, exported afterwards.
  	* @param deepLevel <std::string&> Register of the deep of the replacement.
  	* @param alteredParameterName <std::string> Parameter referring the substitute master name (in substitution mode)
  	*        or the injected node name (injection mode). [Needed for report]
@@ -214,6 +270,7 @@ private:
  	* @param alteredStatementMasterName <std::string> Altered statement Master Name name [Needed for report]
  	* @param alteredStatementPathToBelongingCircuit <std::string> Altered path to circuit [Needed for report]
  	* @param alteredScopeName <std::string> Altered scope Master Name name [Needed for report]
+ 	* @param structuralKey <std::string> Structural key of the alteration inside the subcircuit (empty: not comparable)
  	* @return true if the method correctly ends.
  	*/
 	bool ReplaceAlteredSubcircuitInstance(std::string& deepLevel,
@@ -221,18 +278,57 @@ private:
 		CircuitStatement& alteredStatementsCircuit, InstanceStatement& instanceOfSubcircuit,
 		SubcircuitStatement& originalSubcircuit, SubcircuitStatement& alteredSubcircuit,
 		int& modificationCounter, std::string alteredStatementName, std::string alteredStatementMasterName,
-		std::string alteredStatementPathToBelongingCircuit, std::string alteredScopeName );
+		std::string alteredStatementPathToBelongingCircuit, std::string alteredScopeName,
+		std::string structuralKey );
+
+	/**
+ 	* @details Structural signature of a statement: everything but its name
+	* (type, master, ordered nodes, parameters, parent and circuit).
+	* Parallel identical statements share the signature, and so do their alterations.
+ 	* @param statement <Statement&> Statement.
+ 	* @return std::string signature, empty if the statement is referenced by the metrics
+	* or the equivalent scenarios deduplication is disabled.
+ 	*/
+	std::string GetStructuralSignature( Statement& statement );
+
+	/**
+ 	* @details Exports concurrently the enumerated altered scenarios
+ 	* @return true if every scenario has been exported.
+ 	*/
+	bool ExportAlteredScenarios();
+
+	/**
+ 	* @details Export task of an altered scenario, run in scenarios_thread_pool
+ 	* @param alteredScenario <AlteredScenario*> Exported scenario.
+ 	*/
+	void ExportAlteredScenarioTask( AlteredScenario* alteredScenario );
+
+	/**
+ 	* @details Alters the private copy of the altered circuit and exports the scenario
+ 	* @param alteredScenario <AlteredScenario&> Exported scenario.
+ 	* @param circuitCopies <CircuitCopies&> Circuit copies of the task.
+ 	* @return true if the method correctly ends.
+ 	*/
+	bool ExportAlteredScenario( AlteredScenario& alteredScenario, CircuitCopies& circuitCopies );
+
+	/**
+ 	* @details Returns the private copy of a circuit, created the first time it is requested
+ 	* @param circuitCopies <CircuitCopies&> Circuit copies of the task.
+ 	* @param circuit <CircuitStatement&> Original circuit.
+ 	* @return CircuitStatement& circuit copy.
+ 	*/
+	CircuitStatement& GetCircuitCopy( CircuitCopies& circuitCopies, CircuitStatement& circuit );
 
 	/**
  	* @details Searchs the parent of an statement and proceed to inject it.
  	* If the statement is a circuit, it itself gets injected.
  	* @param statement <Statement&> Statement whose parent is going to be injected.
- 	* @param modifiedCircuit <CircuitStatement&> Altered circuit.
+ 	* @param circuitOverlay <CircuitOverlay&> Alteration of the circuit.
  	* @param injectorSource <InstanceStatement&> Instance of the injector radiation source.
  	* @return true if the method correctly ends.
  	*/
 	bool AddRadiationSourceInstance2Parent(Statement& statement,
-		CircuitStatement& modifiedCircuit, InstanceStatement& injectorSource);
+		CircuitOverlay& circuitOverlay, InstanceStatement& injectorSource);
 
 	/**
  	* @details Creates a new Circuit Statement which will includes the altered subcircuit and 
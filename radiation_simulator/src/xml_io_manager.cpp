@@ -118,6 +118,23 @@ bool XMLIOManager::ReadCadenceXML( const std::string &xmlCadence, int& statement
 		radiationSpectreHandler.set_max_parallel_scenario_instances( maxScenarioParallelInstances );
 		radiationSpectreHandler.set_max_parallel_montecarlo_instances( maxMontecarloParallelInstances );
 		radiationSpectreHandler.set_max_parallel_profile_instances( maxParallelProfileInstances );
+		// Global limit of concurrent instances (all levels), hardware concurrency by default
+		int maxParallelInstances = ptCadence.get<int>("root.max_parallel_instances", 0);
+		if( maxParallelInstances>0 ){
+			log_io->ReportCyanStandard( kTab + "max_parallel_instances: " + number2String(maxParallelInstances));
+			radiationSpectreHandler.set_max_parallel_instances( maxParallelInstances );
+		}
+		// Spectre runs limits (licenses and memory), no limit by default
+		int maxSpectreInstances = ptCadence.get<int>("root.max_spectre_instances", 0);
+		double spectreMemoryBudget = ptCadence.get<double>("root.spectre_memory_budget_mb", 0);
+		if( maxSpectreInstances>0 ){
+			log_io->ReportCyanStandard( kTab + "max_spectre_instances: " + number2String(maxSpectreInstances));
+			radiationSpectreHandler.set_max_spectre_instances( maxSpectreInstances );
+		}
+		if( spectreMemoryBudget>0 ){
+			log_io->ReportCyanStandard( kTab + "spectre_memory_budget_mb: " + number2String(spectreMemoryBudget));
+			radiationSpectreHandler.set_spectre_memory_budget( spectreMemoryBudget );
+		}
 		log_io->ReportPlainStandard( kTab + "Parsing: " );
 		// Primitive names
 		log_io->ReportPlainStandard( k2Tab + "Primitive names. " );
@@ -314,6 +331,59 @@ bool XMLIOManager::ReadExperimentXML( const std::string &xmlExperiment, int& sta
 		}else{
 			log_io->ReportPlainStandard( kTab + "Experiment will NOT export metric errors.");
 		}
+		// optional, critical parameter simulations only need the error verdict
+		radiationSpectreHandler.set_streaming_analysis( ptExperiment.get<bool>("root.streaming_analysis", false) );
+		if(radiationSpectreHandler.get_streaming_analysis()){
+			log_io->ReportPlainStandard( kTab + "Experiment will analyze critical parameter transients while reading them.");
+		}
+		// optional, altered processed transients as float64 columns
+		radiationSpectreHandler.set_binary_processed_transients( ptExperiment.get<bool>("root.binary_processed_transients", false) );
+		if(radiationSpectreHandler.get_binary_processed_transients()){
+			log_io->ReportPlainStandard( kTab + "Experiment will export the processed transients in binary format.");
+		}
+		// optional, critical parameter values simulated concurrently per search round
+		int criticalParameterParallelProbes = ptExperiment.get<int>("root.critical_parameter_parallel_probes", 1);
+		radiationSpectreHandler.set_critical_parameter_parallel_probes( criticalParameterParallelProbes>1 ? criticalParameterParallelProbes : 1 );
+		if(radiationSpectreHandler.get_critical_parameter_parallel_probes()>1){
+			log_io->ReportPlainStandard( kTab + "Experiment will search critical parameter values with "
+				+ number2String(criticalParameterParallelProbes) + " concurrent probes per round.");
+		}
+		// optional, critical value search started from the neighbour profiles
+		radiationSpectreHandler.set_critical_parameter_warm_start( ptExperiment.get<bool>("root.critical_parameter_warm_start", false) );
+		if(radiationSpectreHandler.get_critical_parameter_warm_start()){
+			std::string warmStartFile = ptExperiment.get<std::string>("root.critical_parameter_warm_start_file", "");
+			radiationSpectreHandler.set_critical_parameter_warm_start_file( warmStartFile );
+			log_io->ReportPlainStandard( kTab + "Experiment will warm start the critical parameter searches."
+				+ ( warmStartFile.empty() ? "" : " Critical values file: '" + warmStartFile + "'" ) );
+		}
+		// optional, critical value search by regula falsi on the metric errors
+		radiationSpectreHandler.set_critical_parameter_root_finding( ptExperiment.get<bool>("root.critical_parameter_root_finding", false) );
+		if(radiationSpectreHandler.get_critical_parameter_root_finding()){
+			log_io->ReportPlainStandard( kTab + "Experiment will search critical parameter values by root finding on the metric errors.");
+		}
+		// optional, the critical value probes of each round are simulated in a single spectre run
+		radiationSpectreHandler.set_critical_parameter_batch_probes( ptExperiment.get<bool>("root.critical_parameter_batch_probes", false) );
+		if(radiationSpectreHandler.get_critical_parameter_batch_probes()){
+			log_io->ReportPlainStandard( kTab + "Experiment will batch the critical parameter probes of each round in one spectre run.");
+		}
+		// optional, electrically equivalent altered scenarios are simulated once
+		radiationSpectreHandler.set_deduplicate_equivalent_scenarios( ptExperiment.get<bool>("root.deduplicate_equivalent_scenarios", false) );
+		if(radiationSpectreHandler.get_deduplicate_equivalent_scenarios()){
+			log_io->ReportPlainStandard( kTab + "Experiment will simulate once each set of structurally equivalent scenarios.");
+		}
+		// optional, the parsed included netlists are cached in this folder
+		circuitIOHandler.set_parsed_netlist_cache_folder( ptExperiment.get<std::string>("root.parsed_netlist_cache_folder", "") );
+		if(!circuitIOHandler.get_parsed_netlist_cache_folder().empty()){
+			log_io->ReportPlainStandard( kTab + "Parsed included netlists cached in '"
+				+ circuitIOHandler.get_parsed_netlist_cache_folder() + "'.");
+		}
+		// optional, ND sweeps refine only the cells where the critical values change sharply
+		double adaptiveSweepThreshold = ptExperiment.get<double>("root.adaptive_sweep_threshold", 0);
+		radiationSpectreHandler.set_adaptive_sweep_threshold( adaptiveSweepThreshold>0 ? adaptiveSweepThreshold : 0 );
+		if(radiationSpectreHandler.get_adaptive_sweep_threshold()>0){
+			log_io->ReportPlainStandard( kTab + "Experiment will adaptively sample the ND sweeps. Refinement threshold: "
+				+ number2String(adaptiveSweepThreshold) );
+		}
 		radiationSpectreHandler.set_export_processed_metrics( ptExperiment.get<bool>("root.export_processed_metrics") );
 		if(radiationSpectreHandler.get_export_processed_metrics()){
 			log_io->ReportPlainStandard( kTab + "Experiment will export_processed_metrics.");
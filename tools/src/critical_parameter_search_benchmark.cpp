@@ -0,0 +1,416 @@
+/**
+ * @file critical_parameter_search_benchmark.cpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * Probe count benchmark of the bracketed critical parameter value search:
+ * Illinois regula falsi (critical_parameter_root_finding) versus bisection.
+ * The error-versus-parameter curves are replayed from a recorded transient:
+ * the probe of a parameter value pulls the recorded magnitude towards its
+ * opposite rail (recorded range) by the recorded pulse shape scaled by the
+ * value, clamped to the rails. Every probe is analyzed by
+ * SpectreSimulation::InterpolateAndAnalyzeMagnitude and its failure distance is computed
+ * as CriticalParameterValueSimulation::GetFailureDistance does.
+ * Searches sweep the error margin, the upper bracket side and the value change mode,
+ * errors are punctual. The margin of the zeros band (lower quarter of the range)
+ * is half the swept one.
+ * The probe placement mirrors CriticalParameterValueSimulation::SearchCriticalValueInBracket.
+ * Example: aux_resources/doc/raw_format_examples/nutbin.tran ip ip _vip:p _vvdd:p _vvss:p ip vdd vss
+ *
+ * @arg First argument needed: transient file.
+ * @arg Second argument needed: pulse magnitude, its shape is scaled by the parameter value.
+ * @arg Third argument needed: analyzed magnitude.
+ * @arg Next arguments needed: saved magnitudes in file order (PSF ASCII values are read
+ * by position), time is read first.
+ *
+ */
+
+// c++ std libraries
+#include <string>
+#include <vector>
+#include <memory>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+// Constants includes
+#include "global_functions_and_constants/global_constants.hpp"
+#include "global_functions_and_constants/global_template_functions.hpp"
+// Radiation simulator io includes
+#include "io_handling/log_io.hpp"
+#include "io_handling/raw_format_processor.hpp"
+// Metrics
+#include "metric_modeling/magnitude.hpp"
+#include "metric_modeling/metric_errors.hpp"
+#include "metric_modeling/trace_set.hpp"
+// Simulations
+#include "simulations_handling/spectre_simulations/spectre_simulation.hpp"
+#include "simulations_handling/simulation_results/transient_simulation_results.hpp"
+
+/// stop percentage of the searches
+static const double kValueStopPercentage = 1.0;
+/// error margins, fractions of the analyzed magnitude range
+static const std::vector<double> kMarginFractions = { 0.05, 0.1, 0.25, 0.5, 0.75, 0.9 };
+/// bracket sides, multiples of the analyzed magnitude range
+static const double kMinValueFraction = 1e-3;
+static const std::vector<double> kMaxValueFractions = { 10.0, 1e3 };
+
+/// replayed error-versus-parameter curve
+struct search_curve_t {
+	double abs_error_margin;
+	unsigned int value_change_mode;
+	double min_value;
+	double max_value;
+};
+
+/// probe of the replayed search
+struct probe_t {
+	double value;
+	bool sensitive;
+	double failure_distance;
+};
+
+/// analysis entry points of SpectreSimulation
+class AnalysisSimulation : public SpectreSimulation {
+public:
+	using SpectreSimulation::InterpolateAndAnalyzeMagnitude;
+	void RunSimulation() override {}
+private:
+	bool TestSetUp() override { return true; }
+};
+
+/*
+ * @details Copies the values of a read magnitude
+ *
+ * @param magnitude
+ */
+std::vector<double> GetValues( Magnitude& magnitude ){
+	return std::vector<double>( magnitude.get_values(), magnitude.get_values() + magnitude.get_values_size() );
+}
+
+/*
+ * @details Sets the values of a probe magnitude
+ *
+ * @param magnitude probe magnitude, without values
+ * @param time time values of the probe trace
+ * @param values
+ */
+void SetValues( Magnitude& magnitude, const std::vector<double>& time, const std::vector<double>& values ){
+	auto traceSet = std::make_shared<TraceSet>( 2, values.size() );
+	double row[2];
+	for( unsigned int i=0; i<values.size(); ++i ){
+		row[0] = time[i];
+		row[1] = values[i];
+		traceSet->AddRow( row );
+	}
+	magnitude.set_trace( traceSet, 1 );
+}
+
+/// replays probes over a recorded transient
+class ProbeReplay {
+public:
+	ProbeReplay( AnalysisSimulation& simulation, Magnitude& time, Magnitude& pulse, Magnitude& magnitude ) :
+		simulation( simulation ), time( time ), magnitude( magnitude ){
+		this->time_values = GetValues( time );
+		this->values = GetValues( magnitude );
+		auto range = std::minmax_element( values.begin(), values.end() );
+		this->low = *range.first;
+		this->high = *range.second;
+		// pulse shape normalized to a unit peak, towards the opposite rail
+		std::vector<double> pulseValues = GetValues( pulse );
+		double peak = 0;
+		for( auto const v : pulseValues ){
+			peak = std::max( peak, std::abs( v ) );
+		}
+		this->normalized_pulse.resize( pulseValues.size() );
+		for( unsigned int i=0; i<pulseValues.size(); ++i ){
+			double shape = peak>0 ? std::abs( pulseValues[i] )/peak : 0;
+			normalized_pulse[i] = values[i] > ( low + high )/2 ? -shape : shape;
+		}
+		this->probes = 0;
+	}
+
+	double get_range() const { return high - low; }
+	unsigned int get_probes() const { return probes; }
+	void reset_probes(){ probes = 0; }
+
+	/*
+	 * @details Simulates a probe of a curve
+	 *
+	 * @param curve
+	 * @param probe probe, value already set
+	 * @return false if the probe can not be analyzed
+	 */
+	bool Simulate( const search_curve_t& curve, probe_t& probe ){
+		++probes;
+		Magnitude simulatedMagnitude( magnitude.get_name() );
+		for( auto pMagnitude : { &magnitude, &simulatedMagnitude } ){
+			pMagnitude->set_analyze_error_in_time( false );
+			pMagnitude->set_error_threshold_ones( high - ( high - low )/4 );
+			pMagnitude->set_error_threshold_zeros( low + ( high - low )/4 );
+			pMagnitude->set_abs_error_margin_ones( curve.abs_error_margin );
+			pMagnitude->set_abs_error_margin_zeros( curve.abs_error_margin/2 );
+			pMagnitude->set_abs_error_margin_default( curve.abs_error_margin );
+		}
+		std::vector<double> simulatedValues( values.size() );
+		for( unsigned int i=0; i<values.size(); ++i ){
+			simulatedValues[i] = std::min( std::max( values[i] + probe.value*normalized_pulse[i], low ), high );
+		}
+		SetValues( simulatedMagnitude, time_values, simulatedValues );
+		// recorded time axis for every probe
+		TransientSimulationResults transientSimulationResults;
+		bool reliabilityError = false;
+		if( !simulation.InterpolateAndAnalyzeMagnitude( transientSimulationResults, reliabilityError,
+			magnitude, simulatedMagnitude, time, time, "probe" )
+			|| transientSimulationResults.get_metrics_errors()->empty() ){
+			return false;
+		}
+		// as CriticalParameterValueSimulation::GetFailureDistance
+		auto pMetricErrors = transientSimulationResults.get_metrics_errors()->back();
+		probe.sensitive = reliabilityError;
+		probe.failure_distance = pMetricErrors->get_max_error_margin_ratio() - 1;
+		if( !std::isfinite( probe.failure_distance ) || ( probe.failure_distance>0 )!=probe.sensitive ){
+			probe.failure_distance = 0;
+		}else if( probe.sensitive ){
+			probe.failure_distance = std::max( probe.failure_distance, kCriticalParameterMinFailureDistance );
+		}else{
+			probe.failure_distance = std::min( probe.failure_distance, -kCriticalParameterMinFailureDistance );
+		}
+		return true;
+	}
+
+private:
+	AnalysisSimulation& simulation;
+	Magnitude& time;
+	Magnitude& magnitude;
+	std::vector<double> time_values;
+	std::vector<double> values;
+	std::vector<double> normalized_pulse;
+	double low;
+	double high;
+	unsigned int probes;
+};
+
+double GetBracketValue( const search_curve_t& curve, const double maxParameterValueWorking,
+	const double minParameterValueNotWorking, const double ratio ){
+	if( curve.value_change_mode==kSPLogSmaller ){
+		return maxParameterValueWorking*std::pow(minParameterValueNotWorking/maxParameterValueWorking, ratio);
+	}
+	return maxParameterValueWorking + (minParameterValueNotWorking-maxParameterValueWorking)*ratio;
+}
+
+double GetBracketWidth( const search_curve_t& curve, const double maxParameterValueWorking,
+	const double minParameterValueNotWorking ){
+	if( curve.value_change_mode==kSPLogSmaller ){
+		return std::log( minParameterValueNotWorking/maxParameterValueWorking );
+	}
+	return minParameterValueNotWorking - maxParameterValueWorking;
+}
+
+double GetRegulaFalsiValue( const search_curve_t& curve, const double maxParameterValueWorking,
+	const double minParameterValueNotWorking, const double workingFailureDistance,
+	const double notWorkingFailureDistance ){
+	double ratio = 0.5;
+	if( notWorkingFailureDistance - workingFailureDistance > 0 ){
+		ratio = -workingFailureDistance/(notWorkingFailureDistance - workingFailureDistance);
+	}
+	ratio = std::min( std::max( ratio, kCriticalParameterMinRegulaFalsiRatio ), 1 - kCriticalParameterMinRegulaFalsiRatio );
+	return GetBracketValue( curve, maxParameterValueWorking, minParameterValueNotWorking, ratio );
+}
+
+/*
+ * @details Searches the critical value inside the bracket of a curve,
+ * as CriticalParameterValueSimulation::SearchCriticalValueInBracket does with one probe per round
+ *
+ * @param replay probe simulator
+ * @param curve
+ * @param rootFinding Illinois regula falsi, bisection otherwise
+ * @param workingProbe bracket side not sensitive
+ * @param notWorkingProbe bracket side sensitive
+ * @return false if a probe could not be simulated
+ */
+bool SearchCriticalValueInBracket( ProbeReplay& replay, const search_curve_t& curve, const bool rootFinding,
+	probe_t workingProbe, probe_t& notWorkingProbe ){
+	double stopMargin = 1 + kValueStopPercentage/100;
+	double workingFailureDistance = workingProbe.failure_distance;
+	double notWorkingFailureDistance = notWorkingProbe.failure_distance;
+	int lastUpdatedSide = kNotDefinedInt;
+	double previousBracketWidth = std::numeric_limits<double>::max();
+	double lastBracketWidth = previousBracketWidth;
+	while( notWorkingProbe.value/workingProbe.value >= stopMargin ){
+		probe_t probe;
+		if( rootFinding ){
+			double bracketWidth = GetBracketWidth( curve, workingProbe.value, notWorkingProbe.value );
+			if( bracketWidth>0.5*previousBracketWidth
+				|| workingFailureDistance==0 || notWorkingFailureDistance==0 ){
+				probe.value = GetBracketValue( curve, workingProbe.value, notWorkingProbe.value, 0.5 );
+			}else{
+				probe.value = GetRegulaFalsiValue( curve, workingProbe.value, notWorkingProbe.value,
+					workingFailureDistance, notWorkingFailureDistance );
+			}
+			previousBracketWidth = lastBracketWidth;
+			lastBracketWidth = bracketWidth;
+		}else{
+			probe.value = GetBracketValue( curve, workingProbe.value, notWorkingProbe.value, 0.5 );
+		}
+		if( !replay.Simulate( curve, probe ) ){
+			return false;
+		}
+		if( probe.sensitive ){
+			notWorkingProbe = probe;
+			notWorkingFailureDistance = probe.failure_distance;
+			if( lastUpdatedSide==kScenarioSensitive ){
+				workingFailureDistance /= 2;
+			}
+			lastUpdatedSide = kScenarioSensitive;
+		}else{
+			workingProbe = probe;
+			workingFailureDistance = probe.failure_distance;
+			if( lastUpdatedSide==kScenarioNotSensitive ){
+				notWorkingFailureDistance /= 2;
+			}
+			lastUpdatedSide = kScenarioNotSensitive;
+		}
+	}
+	return true;
+}
+
+/*
+ * @details Reads a transient file
+ *
+ * @param log_io log manager
+ * @param transientFile transient file path
+ * @param metrics magnitudes, time first
+ */
+bool ReadTransient( LogIO& log_io, const std::string& transientFile, std::vector<Metric*>& metrics ){
+	RAWFormatProcessor rfp;
+	rfp.set_log_io( &log_io );
+	rfp.set_metrics( &metrics );
+	rfp.set_transient_file_path( transientFile );
+	// only transient magnitudes, the spectre log is not read
+	rfp.set_log_file_path( transientFile );
+	return rfp.ProcessSpectreOutputs() && static_cast<Magnitude*>( metrics.front() )->get_values_size()>=2;
+}
+
+/*
+ * @details main function of the critical parameter search benchmark
+ *
+ * @param argc Number of arguments <int>
+ * @param argv Program arguments <char**>
+ */
+int main(int argc, char** argv) {
+	LogIO log_io;
+	//argument processing
+	if (argc < 5) {
+		log_io.ReportPlain2AllLogs( "First argument needed: transient file." );
+		log_io.ReportPlain2AllLogs( "Second argument needed: pulse magnitude, its shape is scaled by the parameter value." );
+		log_io.ReportPlain2AllLogs( "Third argument needed: analyzed magnitude." );
+		log_io.ReportPlain2AllLogs( "Next arguments needed: saved magnitudes in file order." );
+		log_io.ReportError2AllLogs( "End of program." );
+		log_io.CloseStreams();
+		return 4;
+	}
+	std::string pulseName = argv[2];
+	std::string magnitudeName = argv[3];
+	std::vector<Metric*> metrics = { new Magnitude( "time" ) };
+	Magnitude* pPulse = nullptr;
+	Magnitude* pMagnitude = nullptr;
+	for( int a=4; a<argc; ++a ){
+		metrics.push_back( new Magnitude( argv[a] ) );
+		if( pulseName.compare( argv[a] )==0 ){
+			pPulse = static_cast<Magnitude*>( metrics.back() );
+		}
+		if( magnitudeName.compare( argv[a] )==0 ){
+			pMagnitude = static_cast<Magnitude*>( metrics.back() );
+		}
+	}
+	if( pPulse==nullptr || pMagnitude==nullptr ){
+		log_io.ReportError2AllLogs( "Pulse and analyzed magnitudes have to be saved magnitudes." );
+		deleteContentsOfVectorOfPointers( metrics );
+		log_io.CloseStreams();
+		return 4;
+	}
+	if( !ReadTransient( log_io, argv[1], metrics ) ){
+		log_io.ReportError2AllLogs( "Error reading the transient " + std::string( argv[1] ) );
+		deleteContentsOfVectorOfPointers( metrics );
+		log_io.CloseStreams();
+		return 1;
+	}
+	auto pTime = static_cast<Magnitude*>( metrics.front() );
+	AnalysisSimulation simulation;
+	simulation.set_log_io( &log_io );
+	ProbeReplay replay( simulation, *pTime, *pPulse, *pMagnitude );
+	const double range = replay.get_range();
+	unsigned int curves = 0;
+	unsigned int bisectionProbes = 0;
+	unsigned int rootFindingProbes = 0;
+	unsigned int disagreements = 0;
+	int result = 0;
+	for( unsigned int mode : { kSPLineal, kSPLogSmaller } ){
+		for( auto marginFraction : kMarginFractions ){
+			for( auto maxValueFraction : kMaxValueFractions ){
+				search_curve_t curve;
+				curve.abs_error_margin = marginFraction*range;
+				curve.value_change_mode = mode;
+				curve.min_value = kMinValueFraction*range;
+				curve.max_value = maxValueFraction*range;
+				// bracket sides of the replayed curve
+				probe_t minProbe, maxProbe;
+				minProbe.value = curve.min_value;
+				maxProbe.value = curve.max_value;
+				if( !replay.Simulate( curve, minProbe ) || !replay.Simulate( curve, maxProbe ) ){
+					log_io.ReportError2AllLogs( "The bracket sides can not be analyzed." );
+					result = 1;
+					break;
+				}
+				if( minProbe.sensitive || !maxProbe.sensitive ){
+					// the bracket does not hold the critical value
+					continue;
+				}
+				probe_t bisectionCritical = maxProbe;
+				probe_t rootFindingCritical = maxProbe;
+				replay.reset_probes();
+				SearchCriticalValueInBracket( replay, curve, false, minProbe, bisectionCritical );
+				unsigned int curveBisectionProbes = replay.get_probes();
+				replay.reset_probes();
+				SearchCriticalValueInBracket( replay, curve, true, minProbe, rootFindingCritical );
+				unsigned int curveRootFindingProbes = replay.get_probes();
+				++curves;
+				bisectionProbes += curveBisectionProbes;
+				rootFindingProbes += curveRootFindingProbes;
+				// both critical values are within the stop margin of the threshold
+				double stopMargin = 1 + kValueStopPercentage/100;
+				double criticalRatio = rootFindingCritical.value/bisectionCritical.value;
+				if( criticalRatio>=stopMargin || criticalRatio<=1/stopMargin ){
+					++disagreements;
+				}
+				log_io.ReportPlainStandard( std::string( mode==kSPLogSmaller ? "log" : "linear" )
+					+ " margin " + number2String( marginFraction ) + " max " + number2String( maxValueFraction )
+					+ " ranges, critical " + number2String( rootFindingCritical.value )
+					+ ": bisection " + number2String( curveBisectionProbes )
+					+ " probes, regula falsi " + number2String( curveRootFindingProbes ) + " probes" );
+			}
+		}
+	}
+	if( result==0 ){
+		if( curves==0 ){
+			log_io.ReportError2AllLogs( "No replayed curve brackets a critical value." );
+			result = 3;
+		}else{
+			log_io.ReportPlainStandard( number2String( curves ) + " curves, bisection "
+				+ number2String( bisectionProbes ) + " probes (" + number2String( static_cast<double>(bisectionProbes)/curves )
+				+ " per search), regula falsi " + number2String( rootFindingProbes ) + " probes ("
+				+ number2String( static_cast<double>(rootFindingProbes)/curves ) + " per search)" );
+			if( disagreements>0 ){
+				log_io.ReportError2AllLogs( number2String( disagreements ) + " searches found different critical values." );
+				result = 2;
+			}
+		}
+	}
+	deleteContentsOfVectorOfPointers( metrics );
+	log_io.CloseStreams();
+	return result;
+}
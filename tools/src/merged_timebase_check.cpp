@@ -0,0 +1,333 @@
+/**
+ * @file merged_timebase_check.cpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * Regression check of the merged timebase comparison: every magnitude of a
+ * recorded golden/simulated pair of transients is analyzed by
+ * SpectreSimulation::InterpolateAndAnalyzeMagnitude along the scalar path,
+ * along a MergedTimebase (threshold pass and span scan) and along a
+ * MergedTimebase with the golden MarginEnvelope. The three reports must be bit-identical.
+ * Besides the recorded simulated transient, three variations of it are analyzed:
+ * decimated and shifted time axes (interpolated merges) and a glitch (error spans).
+ * Error margins (fractions of the max error, up to the max error itself), error time
+ * spans (multiples of the golden step), ommited bands and analyzable windows are swept.
+ * Example: aux_resources/doc/raw_format_examples/nutbin.tran psfascii.tran _vip:p _vvdd:p _vvss:p ip vdd vss
+ *
+ * @arg First argument needed: golden transient file.
+ * @arg Second argument needed: simulated transient file.
+ * @arg Next arguments needed: saved magnitudes in file order (PSF ASCII values are read
+ * by position), time is read first.
+ *
+ */
+
+// c++ std libraries
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <cstring>
+#include <algorithm>
+// Constants includes
+#include "global_functions_and_constants/global_constants.hpp"
+#include "global_functions_and_constants/global_template_functions.hpp"
+// Radiation simulator io includes
+#include "io_handling/log_io.hpp"
+#include "io_handling/raw_format_processor.hpp"
+// Metrics
+#include "metric_modeling/magnitude.hpp"
+#include "metric_modeling/metric_errors.hpp"
+#include "metric_modeling/trace_set.hpp"
+#include "metric_modeling/merged_timebase.hpp"
+#include "metric_modeling/margin_envelope.hpp"
+// Simulations
+#include "simulations_handling/spectre_simulations/spectre_simulation.hpp"
+#include "simulations_handling/simulation_results/transient_simulation_results.hpp"
+
+/// gives access to the magnitude analysis of the spectre simulations
+class AnalysisSimulation : public SpectreSimulation {
+public:
+	using SpectreSimulation::InterpolateAndAnalyzeMagnitude;
+	void RunSimulation() override {}
+private:
+	bool TestSetUp() override { return true; }
+};
+
+/// analysis report of a magnitude
+struct report_t {
+	bool analyzed;
+	bool has_errors;
+	std::map<std::string,std::string> error_timing;
+	double max_abs_error;
+	double max_abs_error_global;
+	double max_error_margin_ratio;
+};
+
+/// transient read or derived from a recording, magnitudes owned
+struct transient_t {
+	std::string title;
+	std::shared_ptr<TraceSet> trace_set;
+	std::vector<Magnitude*> magnitudes;
+	~transient_t(){ deleteContentsOfVectorOfPointers( magnitudes ); }
+};
+
+/*
+ * @details Reads a transient file
+ *
+ * @param log_io log manager
+ * @param transientFile transient file path
+ * @param names magnitude names, time first
+ * @param transient read magnitudes
+ */
+bool ReadTransient( LogIO& log_io, const std::string& transientFile,
+	const std::vector<std::string>& names, transient_t& transient ){
+	std::vector<Metric*> metrics;
+	for( auto const& n : names ){
+		transient.magnitudes.push_back( new Magnitude( n ) );
+		metrics.push_back( transient.magnitudes.back() );
+	}
+	transient.title = transientFile;
+	RAWFormatProcessor rfp;
+	rfp.set_log_io( &log_io );
+	rfp.set_metrics( &metrics );
+	rfp.set_transient_file_path( transientFile );
+	// only transient magnitudes, the spectre log is not read
+	rfp.set_log_file_path( transientFile );
+	return rfp.ProcessSpectreOutputs() && transient.magnitudes.front()->get_values_size()>=2;
+}
+
+/*
+ * @details Derives a transient from a recorded one, first and last times are kept
+ *
+ * @param recorded recorded transient
+ * @param derivation 0: every other sample, 1: times moved to the middle of the next step,
+ * 2: values mirrored along the middle third of the time span
+ * @param derived
+ */
+void DeriveTransient( const transient_t& recorded, const unsigned int derivation, transient_t& derived ){
+	const unsigned int signals = recorded.magnitudes.size();
+	const unsigned int points = recorded.magnitudes.front()->get_values_size();
+	const double* time = recorded.magnitudes.front()->get_values();
+	const double t0 = time[0] + ( time[points-1] - time[0] )/3;
+	const double tf = time[0] + 2*( time[points-1] - time[0] )/3;
+	derived.title = recorded.title + ( derivation==0 ? " decimated" : ( derivation==1 ? " shifted" : " glitch" ) );
+	derived.trace_set = std::make_shared<TraceSet>( signals, points );
+	// mirror axis of each magnitude
+	std::vector<double> mirrors( signals );
+	for( unsigned int s=1; s<signals; ++s ){
+		const double* values = recorded.magnitudes.at(s)->get_values();
+		auto range = std::minmax_element( values, values + points );
+		mirrors[s] = *range.first + *range.second;
+	}
+	std::vector<double> row( signals );
+	for( unsigned int i=0; i<points; ++i ){
+		if( derivation==0 && i%2==1 && i!=points-1 ){
+			continue;
+		}
+		for( unsigned int s=0; s<signals; ++s ){
+			row[s] = recorded.magnitudes.at(s)->get_values()[i];
+		}
+		if( derivation==1 && i>0 && i<points-1 ){
+			row[0] = ( time[i] + time[i+1] )/2;
+		}
+		if( derivation==2 && time[i]>t0 && time[i]<tf ){
+			for( unsigned int s=1; s<signals; ++s ){
+				row[s] = mirrors[s] - row[s];
+			}
+		}
+		derived.trace_set->AddRow( row.data() );
+	}
+	for( unsigned int s=0; s<signals; ++s ){
+		derived.magnitudes.push_back( new Magnitude( recorded.magnitudes.at(s)->get_name() ) );
+		derived.magnitudes.back()->set_trace( derived.trace_set, s );
+	}
+}
+
+/*
+ * @details Sets the analysis attributes of a magnitude
+ *
+ * @param magnitude
+ * @param setting index in the swept settings
+ * @param low golden minimum
+ * @param high golden maximum
+ * @param timeSpan golden time span
+ * @param timeStep golden sample step, error time spans are multiples of it
+ * @param errorScale max abs error global, margins are fractions of it (up to the max error itself)
+ */
+void SetAnalysis( Magnitude& magnitude, const unsigned int setting, const double low, const double high,
+	const double timeSpan, const double timeStep, const double errorScale ){
+	static const double kTimeSpanSteps[3] = { 0.0, 1.0, 3.0 };
+	static const double kMarginFractions[6] = { 0.01, 0.25, 0.5, 0.75, 0.99, 1.0 };
+	const double range = high>low ? high - low : 1.0;
+	const double margin = kMarginFractions[ setting%6 ]*errorScale;
+	magnitude.set_analyze_error_in_time( (setting/6)%2==1 );
+	magnitude.set_ommit_upper_threshold( (setting/12)%3==1 );
+	magnitude.set_ommit_lower_threshold( (setting/12)%3==2 );
+	magnitude.set_analyze_error_in_time_window( (setting/36)%2==1 );
+	magnitude.set_analyzable_time_window_t0( timeSpan/4 );
+	magnitude.set_analyzable_time_window_tf( 3*timeSpan/4 );
+	magnitude.set_error_threshold_ones( low + 0.7*range );
+	magnitude.set_error_threshold_zeros( low + 0.3*range );
+	magnitude.set_abs_error_margin_ones( margin );
+	magnitude.set_abs_error_margin_zeros( 0.75*margin );
+	magnitude.set_abs_error_margin_default( 1.25*margin );
+	const double errorTimeSpan = kTimeSpanSteps[ (setting/72)%3 ]*timeStep;
+	magnitude.set_error_time_span_ones( errorTimeSpan );
+	magnitude.set_error_time_span_zeros( 2*errorTimeSpan );
+	magnitude.set_error_time_span_default( errorTimeSpan/2 );
+}
+
+/*
+ * @details Analyzes a magnitude as SpectreSimulation::InterpolateAndAnalyzeMetrics does
+ *
+ * @param simulation
+ * @param golden golden transient
+ * @param simulated simulated transient
+ * @param m magnitude index
+ * @param mergedTimebase nullptr for the scalar path
+ * @param goldenEnvelope
+ * @param report
+ */
+void AnalyzeMagnitude( AnalysisSimulation& simulation, transient_t& golden, transient_t& simulated,
+	const unsigned int m, MergedTimebase* mergedTimebase, const MarginEnvelope* goldenEnvelope, report_t& report ){
+	TransientSimulationResults transientSimulationResults;
+	bool reliabilityError = false;
+	report.analyzed = simulation.InterpolateAndAnalyzeMagnitude( transientSimulationResults, reliabilityError,
+		*golden.magnitudes.at(m), *simulated.magnitudes.at(m), *golden.magnitudes.front(),
+		*simulated.magnitudes.front(), simulated.title, mergedTimebase, goldenEnvelope );
+	report.has_errors = false;
+	report.error_timing.clear();
+	report.max_abs_error = 0;
+	report.max_abs_error_global = 0;
+	report.max_error_margin_ratio = 0;
+	if( !transientSimulationResults.get_metrics_errors()->empty() ){
+		auto pMetricErrors = transientSimulationResults.get_metrics_errors()->back();
+		report.has_errors = pMetricErrors->get_has_errors();
+		report.error_timing = *pMetricErrors->get_error_timing();
+		report.max_abs_error = pMetricErrors->get_max_abs_error();
+		report.max_abs_error_global = pMetricErrors->get_max_abs_error_global();
+		report.max_error_margin_ratio = pMetricErrors->get_max_error_margin_ratio();
+	}
+}
+
+bool SameReport( const report_t& a, const report_t& b ){
+	return a.analyzed==b.analyzed && a.has_errors==b.has_errors && a.error_timing==b.error_timing
+		&& std::memcmp( &a.max_abs_error, &b.max_abs_error, sizeof(double) )==0
+		&& std::memcmp( &a.max_abs_error_global, &b.max_abs_error_global, sizeof(double) )==0
+		&& std::memcmp( &a.max_error_margin_ratio, &b.max_error_margin_ratio, sizeof(double) )==0;
+}
+
+/*
+ * @details Analyzes every magnitude of a pair of transients along the three paths
+ *
+ * @param log_io log manager
+ * @param simulation
+ * @param golden golden transient
+ * @param simulated simulated transient
+ * @param cases analyzed magnitudes
+ * @param mergedCases analyzed magnitudes along the merged timebase
+ * @param errorCases analyzed magnitudes with errors
+ * @return mismatches
+ */
+unsigned int CheckTransient( LogIO& log_io, AnalysisSimulation& simulation, transient_t& golden,
+	transient_t& simulated, unsigned int& cases, unsigned int& mergedCases, unsigned int& errorCases ){
+	static const unsigned int kSettings = 216;
+	const double* goldenTime = golden.magnitudes.front()->get_values();
+	const double timeSpan = goldenTime[ golden.magnitudes.front()->get_values_size() - 1 ] - goldenTime[0];
+	const double timeStep = goldenTime[1] - goldenTime[0];
+	unsigned int mismatches = 0;
+	for( unsigned int setting=0; setting<kSettings; ++setting ){
+		// shared by the magnitudes, as in InterpolateAndAnalyzeMetrics
+		MergedTimebase mergedTimebase;
+		MergedTimebase envelopeMergedTimebase;
+		for( unsigned int m=1; m<golden.magnitudes.size(); ++m ){
+			auto pGolden = golden.magnitudes.at(m);
+			auto range = std::minmax_element( pGolden->get_values(), pGolden->get_values() + pGolden->get_values_size() );
+			report_t scalar, merged, enveloped;
+			// the global error does not depend on the margins, margins are then set around the errors
+			SetAnalysis( *pGolden, setting, *range.first, *range.second, timeSpan, timeStep, 1.0 );
+			SetAnalysis( *simulated.magnitudes.at(m), setting, *range.first, *range.second, timeSpan, timeStep, 1.0 );
+			AnalyzeMagnitude( simulation, golden, simulated, m, nullptr, nullptr, scalar );
+			const double errorScale = scalar.max_abs_error_global>0 ? scalar.max_abs_error_global : 1.0;
+			SetAnalysis( *pGolden, setting, *range.first, *range.second, timeSpan, timeStep, errorScale );
+			SetAnalysis( *simulated.magnitudes.at(m), setting, *range.first, *range.second, timeSpan, timeStep, errorScale );
+			MarginEnvelope goldenEnvelope( *pGolden );
+			goldenEnvelope.ClassifySamples( pGolden->get_values(), pGolden->get_values_size() );
+			AnalyzeMagnitude( simulation, golden, simulated, m, nullptr, nullptr, scalar );
+			AnalyzeMagnitude( simulation, golden, simulated, m, &mergedTimebase, nullptr, merged );
+			AnalyzeMagnitude( simulation, golden, simulated, m, &envelopeMergedTimebase, &goldenEnvelope, enveloped );
+			++cases;
+			MergedTimebase probe;
+			mergedCases += probe.Build( *golden.magnitudes.front(), *simulated.magnitudes.front(), *pGolden );
+			errorCases += scalar.has_errors;
+			if( !SameReport( scalar, merged ) || !SameReport( scalar, enveloped ) ){
+				log_io.ReportError2AllLogs( simulated.title + ": " + pGolden->get_name() + " setting "
+					+ number2String( setting ) + " differs from the scalar path, max abs error "
+					+ number2String( scalar.max_abs_error ) + "/" + number2String( merged.max_abs_error )
+					+ "/" + number2String( enveloped.max_abs_error ) );
+				++mismatches;
+			}
+		}
+	}
+	return mismatches;
+}
+
+/*
+ * @details main function of the merged timebase check
+ *
+ * @param argc Number of arguments <int>
+ * @param argv Program arguments <char**>
+ */
+int main(int argc, char** argv) {
+	LogIO log_io;
+	//argument processing
+	if (argc < 4) {
+		log_io.ReportPlain2AllLogs( "First argument needed: golden transient file." );
+		log_io.ReportPlain2AllLogs( "Second argument needed: simulated transient file." );
+		log_io.ReportPlain2AllLogs( "Next arguments needed: saved magnitudes in file order." );
+		log_io.ReportError2AllLogs( "End of program." );
+		log_io.CloseStreams();
+		return 4;
+	}
+	std::vector<std::string> names = { "time" };
+	names.insert( names.end(), argv + 3, argv + argc );
+	transient_t golden;
+	std::vector<std::unique_ptr<transient_t>> simulated;
+	simulated.emplace_back( new transient_t() );
+	if( !ReadTransient( log_io, argv[1], names, golden ) || !ReadTransient( log_io, argv[2], names, *simulated.front() ) ){
+		log_io.ReportError2AllLogs( "Error reading the transients." );
+		log_io.CloseStreams();
+		return 1;
+	}
+	for( unsigned int derivation=0; derivation<3; ++derivation ){
+		simulated.emplace_back( new transient_t() );
+		DeriveTransient( *simulated.front(), derivation, *simulated.back() );
+	}
+	AnalysisSimulation simulation;
+	simulation.set_log_io( &log_io );
+	unsigned int mismatches = 0;
+	unsigned int cases = 0;
+	unsigned int mergedCases = 0;
+	unsigned int errorCases = 0;
+	for( auto& pSimulated : simulated ){
+		mismatches += CheckTransient( log_io, simulation, golden, *pSimulated, cases, mergedCases, errorCases );
+	}
+	log_io.ReportPlainStandard( number2String( cases ) + " magnitude analyses, " + number2String( mergedCases )
+		+ " along the merged timebase, " + number2String( errorCases ) + " with errors." );
+	int result = 0;
+	if( mismatches>0 ){
+		log_io.ReportError2AllLogs( number2String( mismatches ) + " analyses differ from the scalar path." );
+		result = 2;
+	}else if( mergedCases==0 ){
+		log_io.ReportError2AllLogs( "The merged timebase was not built, nothing was compared." );
+		result = 3;
+	}else{
+		log_io.ReportPlainStandard( "Merged timebase and scalar analyses are bit-identical." );
+	}
+	log_io.CloseStreams();
+	return result;
+}
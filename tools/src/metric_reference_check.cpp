@@ -0,0 +1,93 @@
+/**
+ * @file metric_reference_check.cpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * Checks RadiationSpectreHandler::IsReferencedByMetrics: a statement is referenced
+ * by a metric only if its name is a whole token of the hierarchical metric name
+ * or of the ocean eval expression (I1 is not referenced by I10 or XI1).
+ *
+ */
+
+// c++ std libraries
+#include <string>
+#include <vector>
+// Constants includes
+#include "global_functions_and_constants/global_template_functions.hpp"
+// Radiation simulator io includes
+#include "io_handling/log_io.hpp"
+// Metrics
+#include "metric_modeling/magnitude.hpp"
+#include "metric_modeling/ocean_eval_metric.hpp"
+// Spectre handlers
+#include "simulations_handling/spectre_handlers/radiation_spectre_handler.hpp"
+
+/// statement name, metric text and expected result
+struct reference_case_t {
+	std::string name;
+	std::string text;
+	bool referenced;
+};
+
+static const std::vector<reference_case_t> kTokenCases = {
+	{ "I1", "I1", true },
+	{ "I1", "I1.M0:d", true },
+	{ "M0", "I1.M0:d", true },
+	{ "I1", "XI0.I1:p", true },
+	{ "I1", "value(VT(\"/I1/out\") 1n)", true },
+	{ "vdd!", "IT(\"/vdd!\")", true },
+	{ "I1", "I10.M0:d", false },
+	{ "I1", "XI1.M0:d", false },
+	{ "I1", "I1_b.M0:d", false },
+	{ "I1", "cross(VT(\"/XI1/out\") 0.6 1 \"rising\")", false },
+	{ "I1", "value(VT(\"/I10/out\") 1n) + value(VT(\"/I1b/out\") 1n)", false },
+	{ "", "I1.M0:d", false } };
+
+/*
+ * @details main function of the metric reference check
+ *
+ * @param argc Number of arguments <int>
+ * @param argv Program arguments <char**>
+ */
+int main(int argc, char** argv) {
+	LogIO log_io;
+	unsigned int mismatches = 0;
+	for( auto const & c : kTokenCases ){
+		if( RadiationSpectreHandler::ContainsNameToken( c.text, c.name )!=c.referenced ){
+			log_io.ReportError2AllLogs( "'" + c.name + "' in '" + c.text + "' should "
+				+ ( c.referenced ? "" : "not " ) + "be found." );
+			++mismatches;
+		}
+	}
+	// metrics of the handler, owned here (the handler only deletes the reordered ones)
+	Magnitude magnitude( "XI1.net3" );
+	OceanEvalMetric oceanEvalMetric( "delay" );
+	oceanEvalMetric.set_ocean_eval_expression( "cross(VT(\"/I10/out\") 0.6 1 \"rising\")" );
+	RadiationSpectreHandler radiationSpectreHandler;
+	radiationSpectreHandler.set_log_io( &log_io );
+	radiationSpectreHandler.AddMetric( &magnitude );
+	radiationSpectreHandler.AddMetric( &oceanEvalMetric );
+	const std::vector<reference_case_t> handlerCases = {
+		{ "XI1", "", true }, { "net3", "", true }, { "I10", "", true },
+		{ "I1", "", false }, { "net", "", false }, { "out1", "", false } };
+	for( auto const & c : handlerCases ){
+		if( radiationSpectreHandler.IsReferencedByMetrics( c.name )!=c.referenced ){
+			log_io.ReportError2AllLogs( "'" + c.name + "' should " + ( c.referenced ? "" : "not " )
+				+ "be referenced by the metrics." );
+			++mismatches;
+		}
+	}
+	int result = 0;
+	if( mismatches>0 ){
+		log_io.ReportError2AllLogs( number2String( mismatches ) + " metric references differ." );
+		result = 2;
+	}else{
+		log_io.ReportPlainStandard( "Metric references match whole name tokens." );
+	}
+	log_io.CloseStreams();
+	return result;
+}
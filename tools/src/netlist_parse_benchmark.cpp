@@ -0,0 +1,276 @@
+/**
+ * @file netlist_parse_benchmark.cpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * Netlist parsing benchmark: writes a large spectre netlist (subcircuits with
+ * parameters, transistors, primitives and comments, top level instances,
+ * sources, analyses and control statements) and times
+ * CircuitStatement::ParseNetlist over it.
+ * The parsing environment (primitives, analyses, control statements, keywords
+ * and transistors) is read from the cadence and technology xml files, as the simulators do.
+ * Example: aux_resources/example_conf_script_files/conf_files/xml/cadence_conf.xml
+ * technology_arizona_rram_65nm_bulk.xml large_netlist.scs
+ *
+ * @arg First argument needed: cadence xml conf file.
+ * @arg Second argument needed: technology xml conf file.
+ * @arg Third argument needed: generated netlist file.
+ * @arg Fourth argument (optional): generated subcircuits (>=1). Default: 2000
+ * @arg Fifth argument (optional): parsing repetitions (>=1). Default: 5
+ *
+ */
+
+// c++ std libraries
+#include <string>
+#include <vector>
+#include <fstream>
+#include <chrono>
+#include <algorithm>
+#include <cctype>
+#include <limits>
+#include <stdexcept>
+// Boost
+#include <boost/property_tree/ptree.hpp>
+#include <boost/property_tree/xml_parser.hpp>
+#include <boost/algorithm/string.hpp>
+// Constants includes
+#include "global_functions_and_constants/global_constants.hpp"
+#include "global_functions_and_constants/global_template_functions.hpp"
+// Radiation simulator io includes
+#include "io_handling/log_io.hpp"
+// Netlist modeling
+#include "experiment_environment.hpp"
+#include "post_parsing_statement_handler.hpp"
+#include "netlist_modeling/statements/circuit_statement.hpp"
+#include "netlist_modeling/statements/analysis_statement.hpp"
+#include "netlist_modeling/statements/control_statement.hpp"
+#include "netlist_modeling/statements/transistor_statement.hpp"
+// Simulation modes
+#include "simulations_handling/simulation_mode.hpp"
+#include "simulations_handling/alteration_mode.hpp"
+
+static const unsigned int kDefaultSubcircuits = 2000;
+static const unsigned int kDefaultRepetitions = 5;
+
+/*
+ * @details Reads the parsing environment, as XMLIOManager does
+ *
+ * @param log_io log manager
+ * @param xmlCadence cadence xml conf file
+ * @param xmlTechnology technology xml conf file
+ * @param experimentEnvironment
+ */
+bool ReadParsingEnvironment( LogIO& log_io, const std::string& xmlCadence,
+	const std::string& xmlTechnology, ExperimentEnvironment& experimentEnvironment ){
+	int statementCounter = 0;
+	try{
+		boost::property_tree::ptree ptCadence;
+		boost::property_tree::ptree ptTechnology;
+		read_xml( xmlCadence, ptCadence );
+		read_xml( xmlTechnology, ptTechnology );
+		for( auto const & v : ptCadence.get_child("root.primitives") ){
+			if ( boost::iequals( v.first, "primitive" ) ){
+				experimentEnvironment.AddPrimitiveName( v.second.get<std::string>("primitive_name") );
+			}
+		}
+		for( auto const & v : ptCadence.get_child("root.analyses") ){
+			if ( boost::iequals( v.first, "statement" ) ){
+				AnalysisStatement* analysisStatement = new AnalysisStatement();
+				analysisStatement->set_id( statementCounter++ );
+				analysisStatement->set_master_name( v.second.get<std::string>("master_name") );
+				analysisStatement->set_description( v.second.get<std::string>("description") );
+				analysisStatement->set_advanced_analysis( v.second.get<bool>("advanced_analysis") );
+				experimentEnvironment.AddAnalysisType( analysisStatement );
+			}
+		}
+		for( auto const & v : ptCadence.get_child("root.control_statements") ){
+			if ( boost::iequals( v.first, "statement" ) ){
+				ControlStatement* controlStatement = new ControlStatement();
+				controlStatement->set_id( statementCounter++ );
+				controlStatement->set_master_name( v.second.get<std::string>("master_name") );
+				controlStatement->set_description( v.second.get<std::string>("description") );
+				controlStatement->set_special_syntax_control_statement(
+					v.second.get<bool>("special_syntax_control_statement") );
+				controlStatement->set_advanced_control_statement(
+					v.second.get<bool>("advanced_control_statement") );
+				experimentEnvironment.AddControlStatementType( controlStatement );
+			}
+		}
+		for( auto const & v : ptCadence.get_child("root.keywords") ){
+			if ( boost::iequals( v.first, "keyword" ) ){
+				experimentEnvironment.AddReservedWord( v.second.get<std::string>("keyword_name") );
+			}
+		}
+		for( auto const & v : ptTechnology.get_child("root.transistors") ){
+			if ( boost::iequals( v.first, "statement" ) ){
+				TransistorStatement* transistorStatement = new TransistorStatement();
+				transistorStatement->set_id( statementCounter++ );
+				transistorStatement->set_name( kNotDefinedString );
+				transistorStatement->set_master_name( v.second.get<std::string>("master_name") );
+				transistorStatement->set_description( v.second.get<std::string>("description") );
+				experimentEnvironment.AddTransistorStatementType( transistorStatement );
+			}
+		}
+	}catch (std::exception const& ex) {
+		log_io.ReportError2AllLogs( "An exception occurred parsing the xml conf files: " + std::string( ex.what() ) );
+		return false;
+	}
+	experimentEnvironment.UpdatekAnalysisStatementRegEx();
+	experimentEnvironment.UpdatekTransistorStatementRegEx();
+	experimentEnvironment.UpdatekControlStatementRegEx();
+	return true;
+}
+
+/*
+ * @details Writes the benchmark netlist
+ *
+ * @param netlistFile
+ * @param subcircuits number of subcircuits (and top level instances)
+ */
+bool WriteNetlist( const std::string& netlistFile, const unsigned int subcircuits ){
+	std::ofstream netlist( netlistFile.c_str() );
+	if( !netlist ){
+		return false;
+	}
+	netlist << "// netlist parsing benchmark, " << subcircuits << " subcircuits\n";
+	netlist << "simulator lang=spectre\n";
+	netlist << "global 0 vdd!\n\n";
+	netlist << "parameters\n";
+	netlist << "+ my_vdd=1.2\n";
+	netlist << "+ tr=10p tf=10p\n";
+	netlist << "+ sim_time=20n\n\n";
+	for( unsigned int s=0; s<subcircuits; ++s ){
+		netlist << "// Cell name: cell_" << s << "\n";
+		netlist << "subckt cell_" << s << " ( in out vdd vss )\n";
+		netlist << "parameters wn=130n wp=260n l=65n rload=" << 1 + s%10 << "k\n";
+		netlist << "\tMp ( out in vdd vdd ) pmos w=wp l=l // pull up\n";
+		netlist << "\tMn ( out in vss vss ) nmos w=wn l=l // pull down\n";
+		netlist << "\tR0 ( out nload ) resistor r=rload\n";
+		netlist << "\tC0 ( nload vss ) capacitor c=" << 1 + s%7 << "f\n";
+		netlist << "ends cell_" << s << "\n";
+		netlist << "// End of subcircuit definition.\n\n";
+	}
+	netlist << "// Sources\n";
+	netlist << "vsupply ( vdd! 0 ) vsource type=dc dc=my_vdd\n";
+	netlist << "vin ( n0 0 ) vsource type=pulse val0=0 val1=my_vdd rise=tr fall=tf width=5n delay=1n\n\n";
+	netlist << "// Top level instances\n";
+	for( unsigned int s=0; s<subcircuits; ++s ){
+		netlist << "I" << s << " ( n" << s << " n" << s + 1 << " vdd! 0 ) cell_" << s
+			<< " wn=" << 130 + s%5*10 << "n rload=" << 1 + s%3 << "k\n";
+	}
+	netlist << "\n// Analyses and control statements\n";
+	netlist << "simulatorOptions options reltol=1e-3 vabstol=1e-6 iabstol=1e-12 temp=27\n";
+	netlist << "tran tran stop=sim_time maxstep=10p errpreset=moderate\n";
+	netlist << "saveOptions options save=selected\n";
+	netlist << "save n0 n" << subcircuits << "\n";
+	netlist.close();
+	return !netlist.fail();
+}
+
+/*
+ * @details Reads a count argument
+ *
+ * @param argument
+ * @param count read count
+ * @return false if the argument is not a number >= 1
+ */
+bool ReadCount( const std::string& argument, unsigned int& count ){
+	if( argument.empty() || !std::all_of( argument.begin(), argument.end(),
+			[]( const char c ){ return std::isdigit( static_cast<unsigned char>( c ) ); } ) ){
+		return false;
+	}
+	try{
+		unsigned long readCount = std::stoul( argument );
+		if( readCount<1 || readCount>std::numeric_limits<unsigned int>::max() ){
+			return false;
+		}
+		count = readCount;
+	}catch( std::out_of_range const& ){
+		return false;
+	}
+	return true;
+}
+
+/*
+ * @details main function of the netlist parsing benchmark
+ *
+ * @param argc Number of arguments <int>
+ * @param argv Program arguments <char**>
+ */
+int main(int argc, char** argv) {
+	LogIO log_io;
+	//argument processing
+	unsigned int subcircuits = kDefaultSubcircuits;
+	unsigned int repetitions = kDefaultRepetitions;
+	if( argc < 4 || argc > 6
+		|| ( argc > 4 && !ReadCount( argv[4], subcircuits ) )
+		|| ( argc > 5 && !ReadCount( argv[5], repetitions ) ) ){
+		log_io.ReportPlain2AllLogs( "First argument needed: cadence xml conf file." );
+		log_io.ReportPlain2AllLogs( "Second argument needed: technology xml conf file." );
+		log_io.ReportPlain2AllLogs( "Third argument needed: generated netlist file." );
+		log_io.ReportPlain2AllLogs( "Fourth argument (optional): generated subcircuits (>=1). Default: 2000" );
+		log_io.ReportPlain2AllLogs( "Fifth argument (optional): parsing repetitions (>=1). Default: 5" );
+		log_io.ReportError2AllLogs( "End of program." );
+		log_io.CloseStreams();
+		return 4;
+	}
+	std::string netlistFile = argv[3];
+	// netlist is parsed without alterations
+	AlterationMode alterationMode;
+	alterationMode.set_log_io( &log_io );
+	SimulationMode simulationMode;
+	simulationMode.set_log_io( &log_io );
+	simulationMode.set_alteration_mode( &alterationMode );
+	ExperimentEnvironment experimentEnvironment;
+	experimentEnvironment.set_log_io( &log_io );
+	experimentEnvironment.set_simulation_mode( &simulationMode );
+	if( !ReadParsingEnvironment( log_io, argv[1], argv[2], experimentEnvironment ) ){
+		log_io.CloseStreams();
+		return 1;
+	}
+	if( !WriteNetlist( netlistFile, subcircuits ) ){
+		log_io.ReportError2AllLogs( "Error writing " + netlistFile );
+		log_io.CloseStreams();
+		return 1;
+	}
+	std::vector<double> parsingTimes;
+	int statementCount = 0;
+	for( unsigned int r=0; r<repetitions; ++r ){
+		PostParsingStatementHandler postParsingStatementHandler;
+		postParsingStatementHandler.set_log_io( &log_io );
+		// configured as the main circuit of the experiments
+		CircuitStatement mainCircuit;
+		mainCircuit.set_id( 0 );
+		mainCircuit.set_circuit_id( 0 );
+		mainCircuit.set_log_io( &log_io );
+		mainCircuit.set_post_parsing_statement_handler( &postParsingStatementHandler );
+		mainCircuit.set_master_name( "circuit" );
+		mainCircuit.set_name( kMainCircuitStringId );
+		mainCircuit.set_considerate_dependencies( true );
+		mainCircuit.set_description( netlistFile );
+		mainCircuit.set_experiment_environment( &experimentEnvironment );
+		statementCount = 0;
+		bool parsingSpectreCode = false;
+		auto start = std::chrono::steady_clock::now();
+		bool parsed = mainCircuit.ParseNetlist( netlistFile, statementCount, parsingSpectreCode, false );
+		auto end = std::chrono::steady_clock::now();
+		if( !parsed ){
+			log_io.ReportError2AllLogs( "Error parsing " + netlistFile );
+			log_io.CloseStreams();
+			return 1;
+		}
+		parsingTimes.push_back( std::chrono::duration<double, std::milli>( end - start ).count() );
+		log_io.ReportPlainStandard( "Repetition " + number2String( r ) + ": "
+			+ number2String( parsingTimes.back() ) + " ms" );
+	}
+	std::sort( parsingTimes.begin(), parsingTimes.end() );
+	log_io.ReportPlainStandard( netlistFile + ": " + number2String( statementCount ) + " statements, best "
+		+ number2String( parsingTimes.front() ) + " ms, median "
+		+ number2String( parsingTimes.at( parsingTimes.size()/2 ) ) + " ms" );
+	log_io.CloseStreams();
+	return 0;
+}
@@ -0,0 +1,155 @@
+/**
+ * @file nutbin_reader_check.cpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * Checks the nutbin transient reader against the PSF ASCII readers:
+ * both files hold the same waveform, every magnitude must be read with the same values.
+ * Example: aux_resources/doc/raw_format_examples/nutbin.tran and psfascii.tran
+ *
+ * @arg First argument needed: nutbin transient file.
+ * @arg Second argument needed: PSF ASCII transient file of the same waveform.
+ * @arg Next arguments (optional): saved magnitudes in file order (PSF ASCII values are read
+ * by position), time is always compared. Default: _vip:p _vvdd:p _vvss:p ip vdd vss
+ *
+ */
+
+// c++ std libraries
+#include <string>
+#include <vector>
+#include <cmath>
+// Constants includes
+#include "global_functions_and_constants/global_constants.hpp"
+#include "global_functions_and_constants/global_template_functions.hpp"
+// Radiation simulator io includes
+#include "io_handling/log_io.hpp"
+#include "io_handling/raw_format_processor.hpp"
+// Metrics
+#include "metric_modeling/magnitude.hpp"
+
+static const std::vector<std::string> kDefaultMagnitudes = {
+	"_vip:p", "_vvdd:p", "_vvss:p", "ip", "vdd", "vss" };
+
+/*
+ * @details Reads a transient file into a new set of magnitudes
+ *
+ * @param log_io log manager
+ * @param transientFile transient file path
+ * @param names magnitude names, time first
+ * @param memoryMapped PSF ASCII reader selection (nutbin files are always mapped)
+ * @param magnitudes read magnitudes, owned by the caller
+ */
+bool ReadTransient( LogIO& log_io, const std::string& transientFile,
+	const std::vector<std::string>& names, const bool memoryMapped, std::vector<Metric*>& magnitudes ){
+	for( auto const& n : names ){
+		magnitudes.push_back( new Magnitude( n ) );
+	}
+	RAWFormatProcessor rfp;
+	rfp.set_log_io( &log_io );
+	rfp.set_metrics( &magnitudes );
+	rfp.set_transient_file_path( transientFile );
+	// only transient magnitudes, the spectre log is not read
+	rfp.set_log_file_path( transientFile );
+	rfp.set_memory_mapped_reader( memoryMapped );
+	return rfp.ProcessSpectreOutputs();
+}
+
+/*
+ * @details Compares two reads of the same waveform, returns the number of mismatches
+ *
+ * @param log_io log manager
+ * @param title reader compared against the nutbin reader
+ * @param reference magnitudes read by the nutbin reader
+ * @param checked magnitudes read by the checked reader
+ */
+unsigned int CompareTransients( LogIO& log_io, const std::string& title,
+	const std::vector<Metric*>& reference, const std::vector<Metric*>& checked ){
+	unsigned int mismatches = 0;
+	for( unsigned int m=0; m<reference.size(); ++m ){
+		auto pReference = static_cast<Magnitude*>( reference.at(m) );
+		auto pChecked = static_cast<Magnitude*>( checked.at(m) );
+		if( pReference->get_values_size()!=pChecked->get_values_size() ){
+			log_io.ReportError2AllLogs( title + ": " + pReference->get_name() + " has "
+				+ number2String( pChecked->get_values_size() ) + " points, nutbin has "
+				+ number2String( pReference->get_values_size() ) );
+			++mismatches;
+			continue;
+		}
+		unsigned int differentValues = 0;
+		double maxDifference = 0;
+		for( unsigned int i=0; i<pReference->get_values_size(); ++i ){
+			const double difference = std::fabs( pReference->get_values()[i] - pChecked->get_values()[i] );
+			if( pReference->get_values()[i]!=pChecked->get_values()[i] ){
+				++differentValues;
+				maxDifference = std::max( maxDifference, difference );
+			}
+		}
+		if( differentValues>0 ){
+			log_io.ReportError2AllLogs( title + ": " + pReference->get_name() + " differs in "
+				+ number2String( differentValues ) + " of " + number2String( pReference->get_values_size() )
+				+ " points, max difference " + number2String( maxDifference ) );
+			++mismatches;
+		}else{
+			log_io.ReportPlainStandard( title + ": " + pReference->get_name() + " "
+				+ number2String( pReference->get_values_size() ) + " points match" );
+		}
+	}
+	return mismatches;
+}
+
+/*
+ * @details main function of the nutbin reader check
+ *
+ * @param argc Number of arguments <int>
+ * @param argv Program arguments <char**>
+ */
+int main(int argc, char** argv) {
+	LogIO log_io;
+	//argument processing
+	if (argc < 3) {
+		log_io.ReportPlain2AllLogs( "First argument needed: nutbin transient file." );
+		log_io.ReportPlain2AllLogs( "Second argument needed: PSF ASCII transient file of the same waveform." );
+		log_io.ReportPlain2AllLogs( "Next arguments (optional): saved magnitudes in file order. Default: _vip:p _vvdd:p _vvss:p ip vdd vss" );
+		log_io.ReportError2AllLogs( "End of program." );
+		log_io.CloseStreams();
+		return 4;
+	}
+	std::string nutbinFile = argv[1];
+	std::string psfasciiFile = argv[2];
+	std::vector<std::string> names = { "time" };
+	if( argc>3 ){
+		names.insert( names.end(), argv + 3, argv + argc );
+	}else{
+		names.insert( names.end(), kDefaultMagnitudes.begin(), kDefaultMagnitudes.end() );
+	}
+	std::vector<Metric*> nutbinMagnitudes;
+	std::vector<Metric*> mappedMagnitudes;
+	std::vector<Metric*> streamedMagnitudes;
+	int result = 0;
+	if( !ReadTransient( log_io, nutbinFile, names, true, nutbinMagnitudes ) ){
+		log_io.ReportError2AllLogs( "Error reading the nutbin transient " + nutbinFile );
+		result = 1;
+	}else if( !ReadTransient( log_io, psfasciiFile, names, true, mappedMagnitudes )
+		|| !ReadTransient( log_io, psfasciiFile, names, false, streamedMagnitudes ) ){
+		log_io.ReportError2AllLogs( "Error reading the PSF ASCII transient " + psfasciiFile );
+		result = 1;
+	}else{
+		unsigned int mismatches = CompareTransients( log_io, "PSF ASCII mapped", nutbinMagnitudes, mappedMagnitudes );
+		mismatches += CompareTransients( log_io, "PSF ASCII stream", nutbinMagnitudes, streamedMagnitudes );
+		if( mismatches>0 ){
+			log_io.ReportError2AllLogs( number2String( mismatches ) + " magnitudes read differently." );
+			result = 2;
+		}else{
+			log_io.ReportPlainStandard( "nutbin and PSF ASCII readers match." );
+		}
+	}
+	deleteContentsOfVectorOfPointers( nutbinMagnitudes );
+	deleteContentsOfVectorOfPointers( mappedMagnitudes );
+	deleteContentsOfVectorOfPointers( streamedMagnitudes );
+	log_io.CloseStreams();
+	return result;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file processed_results_converter.cpp
+ *
+ * @date Created on: October 17, 2026
+ *
+ * @author Author: Fernando García <fgarcia@die.upm.es> <fernando.garca@gmail.com>
+ *
+ * @section DESCRIPTION
+ *
+ * Converts binary processed transients (.bdata) to the text formats.
+ *
+ * @arg First argument needed: binary processed transient file.
+ * @arg Second argument needed: output file.
+ * @arg Third argument (optional): output format. matlab/gnuplot/csv. Default: gnuplot
+ *
+ */
+
+// c++ std libraries
+#include <string>
+// Constants includes
+#include "global_functions_and_constants/global_constants.hpp"
+#include "global_functions_and_constants/files_folders_io_constants.hpp"
+// Radiation simulator io includes
+#include "io_handling/log_io.hpp"
+#include "io_handling/processed_results_file.hpp"
+
+static const std::string kMatlabFormat = "matlab";
+static const std::string kGnuPlotFormat = "gnuplot";
+static const std::string kCSVFormat = "csv";
+
+/*
+ * @details main function of the processed results converter
+ *
+ * @param argc Number of arguments <int>
+ * @param argv Program arguments <char**>
+ */
+int main(int argc, char** argv) {
+	LogIO log_io;
+	//argument processing
+	if (argc < 3 || argc > 4) {
+		log_io.ReportPlain2AllLogs( "First argument needed: binary processed transient file." );
+		log_io.ReportPlain2AllLogs( "Second argument needed: output file." );
+		log_io.ReportPlain2AllLogs( "Third argument (optional): output format. matlab/gnuplot/csv. Default: gnuplot " );
+		log_io.ReportError2AllLogs( "End of program." );
+		log_io.CloseStreams();
+		return 4;
+	}
+	std::string inputFile = argv[1];
+	std::string outputFile = argv[2];
+	int format = kGnuPlot;
+	if( argc==4 ){
+		std::string formatArg = argv[3];
+		if( formatArg.compare(kMatlabFormat)==0 ){
+			format = kMatlab;
+		}else if( formatArg.compare(kCSVFormat)==0 ){
+			format = kCSV;
+		}else if( formatArg.compare(kGnuPlotFormat)!=0 ){
+			log_io.ReportError2AllLogs( "Unknown format '" + formatArg + "'. matlab/gnuplot/csv." );
+			log_io.CloseStreams();
+			return 4;
+		}
+	}
+	ProcessedResultsFile processedResultsFile;
+	if( !processedResultsFile.Open( inputFile ) ){
+		log_io.ReportError2AllLogs( "Error reading the binary processed transient " + inputFile );
+		log_io.CloseStreams();
+		return 1;
+	}
+	if( !processedResultsFile.ExportAsText( outputFile, format ) ){
+		log_io.ReportError2AllLogs( "Error writing " + outputFile );
+		log_io.CloseStreams();
+		return 1;
+	}
+	log_io.ReportPlainStandard( inputFile + " converted to " + outputFile );
+	log_io.CloseStreams();
+	return 0;
+}